@@ -0,0 +1,300 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_CHECKSUM_HPP
+#define UTIL_CHECKSUM_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace ebi
+{
+  namespace util
+  {
+    const char MD5[] = "md5";
+    const char SHA256[] = "sha256";
+
+    /**
+     * Incremental digest of a stream of bytes. Feed it with `update` as the bytes are read, and call `hex_digest`
+     * once all of them have been seen.
+     */
+    class Checksum
+    {
+      public:
+        virtual ~Checksum() {}
+        virtual std::string const & name() const = 0;
+        virtual void update(char const * data, size_t size) = 0;
+        virtual std::string hex_digest() = 0;
+    };
+
+    namespace detail
+    {
+      inline uint32_t rotate_left(uint32_t x, int n) { return (x << n) | (x >> (32 - n)); }
+      inline uint32_t rotate_right(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+
+      inline std::string to_hex(unsigned char const * bytes, size_t size)
+      {
+          static char const digits[] = "0123456789abcdef";
+          std::string hex;
+          hex.reserve(size * 2);
+          for (size_t i = 0; i < size; ++i) {
+              hex.push_back(digits[bytes[i] >> 4]);
+              hex.push_back(digits[bytes[i] & 0x0f]);
+          }
+          return hex;
+      }
+
+      /**
+       * Common part of MD5 and SHA-256: both process 64-byte blocks and pad the message with the bit length, only
+       * the byte order of that length and the compression function differ.
+       */
+      template <typename Derived, bool BigEndianLength>
+      class BlockChecksum : public Checksum
+      {
+        public:
+          BlockChecksum() : buffered{0}, total_size{0} { }
+
+          virtual void update(char const * data, size_t size) override
+          {
+              auto bytes = reinterpret_cast<unsigned char const *>(data);
+              total_size += size;
+
+              if (buffered > 0) {
+                  size_t missing = std::min(size, block_size - buffered);
+                  std::memcpy(buffer + buffered, bytes, missing);
+                  buffered += missing;
+                  bytes += missing;
+                  size -= missing;
+                  if (buffered < block_size) {
+                      return;
+                  }
+                  static_cast<Derived*>(this)->process_block(buffer);
+                  buffered = 0;
+              }
+
+              for (; size >= block_size; bytes += block_size, size -= block_size) {
+                  static_cast<Derived*>(this)->process_block(bytes);
+              }
+
+              std::memcpy(buffer, bytes, size);
+              buffered = size;
+          }
+
+        protected:
+          static size_t const block_size = 64;
+
+          void pad()
+          {
+              uint64_t bit_length = total_size * 8;
+              unsigned char padding[block_size * 2] = {0x80};
+              size_t padding_size = (buffered < 56 ? 56 : 120) - buffered;
+              update(reinterpret_cast<char const *>(padding), padding_size);
+
+              unsigned char length[8];
+              for (int i = 0; i < 8; ++i) {
+                  length[BigEndianLength ? 7 - i : i] = static_cast<unsigned char>(bit_length >> (8 * i));
+              }
+              update(reinterpret_cast<char const *>(length), 8);
+          }
+
+        private:
+          unsigned char buffer[block_size];
+          size_t buffered;
+          uint64_t total_size;
+      };
+    }
+
+    /**
+     * MD5 as described in RFC 1321
+     */
+    class Md5 : public detail::BlockChecksum<Md5, false>
+    {
+      public:
+        Md5() : state{0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476} { }
+
+        virtual std::string const & name() const override
+        {
+            static std::string const md5_name{MD5};
+            return md5_name;
+        }
+
+        virtual std::string hex_digest() override
+        {
+            pad();
+            unsigned char digest[16];
+            for (int i = 0; i < 16; ++i) {
+                digest[i] = static_cast<unsigned char>(state[i / 4] >> (8 * (i % 4)));
+            }
+            return detail::to_hex(digest, sizeof(digest));
+        }
+
+        void process_block(unsigned char const * block)
+        {
+            static uint32_t const k[64] = {
+                0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+                0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+                0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+                0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+                0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+                0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+                0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+                0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391};
+            static int const shifts[64] = {
+                7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+                5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
+                4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+                6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21};
+
+            uint32_t words[16];
+            for (int i = 0; i < 16; ++i) {
+                words[i] = uint32_t(block[i * 4]) | (uint32_t(block[i * 4 + 1]) << 8)
+                           | (uint32_t(block[i * 4 + 2]) << 16) | (uint32_t(block[i * 4 + 3]) << 24);
+            }
+
+            uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+            for (int i = 0; i < 64; ++i) {
+                uint32_t f;
+                int g;
+                if (i < 16) {
+                    f = (b & c) | (~b & d);
+                    g = i;
+                } else if (i < 32) {
+                    f = (d & b) | (~d & c);
+                    g = (5 * i + 1) % 16;
+                } else if (i < 48) {
+                    f = b ^ c ^ d;
+                    g = (3 * i + 5) % 16;
+                } else {
+                    f = c ^ (b | ~d);
+                    g = (7 * i) % 16;
+                }
+                uint32_t rotated = b + detail::rotate_left(a + f + k[i] + words[g], shifts[i]);
+                a = d;
+                d = c;
+                c = b;
+                b = rotated;
+            }
+
+            state[0] += a;
+            state[1] += b;
+            state[2] += c;
+            state[3] += d;
+        }
+
+      private:
+        uint32_t state[4];
+    };
+
+    /**
+     * SHA-256 as described in FIPS 180-4
+     */
+    class Sha256 : public detail::BlockChecksum<Sha256, true>
+    {
+      public:
+        Sha256() : state{0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                         0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19} { }
+
+        virtual std::string const & name() const override
+        {
+            static std::string const sha256_name{SHA256};
+            return sha256_name;
+        }
+
+        virtual std::string hex_digest() override
+        {
+            pad();
+            unsigned char digest[32];
+            for (int i = 0; i < 32; ++i) {
+                digest[i] = static_cast<unsigned char>(state[i / 4] >> (24 - 8 * (i % 4)));
+            }
+            return detail::to_hex(digest, sizeof(digest));
+        }
+
+        void process_block(unsigned char const * block)
+        {
+            static uint32_t const k[64] = {
+                0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+                0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+                0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+                0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+                0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+                0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+                0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+                0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+            uint32_t words[64];
+            for (int i = 0; i < 16; ++i) {
+                words[i] = (uint32_t(block[i * 4]) << 24) | (uint32_t(block[i * 4 + 1]) << 16)
+                           | (uint32_t(block[i * 4 + 2]) << 8) | uint32_t(block[i * 4 + 3]);
+            }
+            for (int i = 16; i < 64; ++i) {
+                uint32_t s0 = detail::rotate_right(words[i - 15], 7) ^ detail::rotate_right(words[i - 15], 18)
+                              ^ (words[i - 15] >> 3);
+                uint32_t s1 = detail::rotate_right(words[i - 2], 17) ^ detail::rotate_right(words[i - 2], 19)
+                              ^ (words[i - 2] >> 10);
+                words[i] = words[i - 16] + s0 + words[i - 7] + s1;
+            }
+
+            uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+            uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+            for (int i = 0; i < 64; ++i) {
+                uint32_t s1 = detail::rotate_right(e, 6) ^ detail::rotate_right(e, 11) ^ detail::rotate_right(e, 25);
+                uint32_t choice = (e & f) ^ (~e & g);
+                uint32_t temp1 = h + s1 + choice + k[i] + words[i];
+                uint32_t s0 = detail::rotate_right(a, 2) ^ detail::rotate_right(a, 13) ^ detail::rotate_right(a, 22);
+                uint32_t majority = (a & b) ^ (a & c) ^ (b & c);
+                uint32_t temp2 = s0 + majority;
+                h = g;
+                g = f;
+                f = e;
+                e = d + temp1;
+                d = c;
+                c = b;
+                b = a;
+                a = temp1 + temp2;
+            }
+
+            state[0] += a;
+            state[1] += b;
+            state[2] += c;
+            state[3] += d;
+            state[4] += e;
+            state[5] += f;
+            state[6] += g;
+            state[7] += h;
+        }
+
+      private:
+        uint32_t state[8];
+    };
+
+    inline std::unique_ptr<Checksum> make_checksum(std::string const & algorithm)
+    {
+        if (algorithm == MD5) {
+            return std::unique_ptr<Checksum>{new Md5()};
+        } else if (algorithm == SHA256) {
+            return std::unique_ptr<Checksum>{new Sha256()};
+        }
+        throw std::invalid_argument{"Unsupported checksum algorithm: " + algorithm};
+    }
+  }
+}
+
+#endif // UTIL_CHECKSUM_HPP
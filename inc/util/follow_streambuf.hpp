@@ -0,0 +1,159 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_FOLLOW_STREAMBUF_HPP
+#define UTIL_FOLLOW_STREAMBUF_HPP
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#endif
+
+namespace ebi
+{
+  namespace util
+  {
+    size_t const default_follow_buffer_size = 1024 * 1024;
+
+    /**
+     * Input stream buffer that reads a file which is still being written. When the bytes written so far have been
+     * read, instead of reporting the end of the input it waits for the file to grow (using inotify when available),
+     * until `finished` tells that the producer of the file is done. Example usage:
+     * ```
+     * FollowStreambuf follow{"calls.vcf", []() { return boost::filesystem::exists("calls.vcf.done"); }};
+     * std::istream input{&follow};
+     * ```
+     * The reader just sees a slow input, so any state kept while reading it is preserved between waits. `finished`
+     * is checked only when there is nothing left to read, and once it returns true the rest of the file is read
+     * before reporting the end of the input. `before_wait`, if provided, is called every time the reader has to wait,
+     * e.g. to flush what it has written so far.
+     */
+    class FollowStreambuf : public std::streambuf
+    {
+      public:
+        using Finished = std::function<bool()>;
+        using BeforeWait = std::function<void()>;
+
+        FollowStreambuf(std::string const & path,
+                        Finished finished,
+                        std::chrono::milliseconds poll_interval = std::chrono::milliseconds{1000},
+                        size_t buffer_size = default_follow_buffer_size,
+                        BeforeWait before_wait = nullptr)
+                : path(path), finished(finished), poll_interval(poll_interval), buffer(buffer_size),
+                  before_wait(before_wait)
+        {
+            file = ::open(path.c_str(), O_RDONLY);
+            if (file < 0) {
+                throw std::runtime_error{"Couldn't open file " + path};
+            }
+#ifdef __linux__
+            notifier = inotify_init1(IN_NONBLOCK);
+            if (notifier >= 0 && inotify_add_watch(notifier, path.c_str(), IN_MODIFY | IN_CLOSE_WRITE) < 0) {
+                ::close(notifier);
+                notifier = -1;
+            }
+#endif
+        }
+
+        FollowStreambuf(FollowStreambuf const &) = delete;
+        FollowStreambuf & operator=(FollowStreambuf const &) = delete;
+
+        ~FollowStreambuf()
+        {
+            ::close(file);
+            if (notifier >= 0) {
+                ::close(notifier);
+            }
+        }
+
+      protected:
+        virtual int_type underflow() override
+        {
+            if (gptr() < egptr()) {
+                return traits_type::to_int_type(*gptr());
+            }
+
+            bool producer_finished = false;
+            while (true) {
+                ssize_t read = ::read(file, buffer.data(), buffer.size());
+                if (read > 0) {
+                    setg(buffer.data(), buffer.data(), buffer.data() + read);
+                    return traits_type::to_int_type(*gptr());
+                }
+                if (read < 0 && errno != EINTR) {
+                    throw std::runtime_error{"Couldn't read file " + path + ": " + std::strerror(errno)};
+                }
+                if (read == 0) {
+                    // the producer may have written its last bytes right before finishing, so read once more
+                    if (producer_finished) {
+                        return traits_type::eof();
+                    }
+                    producer_finished = finished();
+                    if (not producer_finished) {
+                        wait_for_growth();
+                    }
+                }
+            }
+        }
+
+      private:
+        /**
+         * Waits until the file is modified, or at most `poll_interval`, so that `finished` is checked periodically
+         * even if the producer stops writing
+         */
+        void wait_for_growth()
+        {
+            if (before_wait) {
+                before_wait();
+            }
+            if (notifier < 0) {
+                std::this_thread::sleep_for(poll_interval);
+                return;
+            }
+
+            pollfd events{notifier, POLLIN, 0};
+            if (::poll(&events, 1, static_cast<int>(poll_interval.count())) > 0) {
+                // only the fact that something happened matters, so the events are discarded
+                char discarded[4096];
+                while (::read(notifier, discarded, sizeof(discarded)) > 0) { }
+            }
+        }
+
+        std::string path;
+        Finished finished;
+        std::chrono::milliseconds poll_interval;
+        std::vector<char> buffer;
+        BeforeWait before_wait;
+        int file;
+        int notifier = -1;
+    };
+  }
+}
+
+#endif // UTIL_FOLLOW_STREAMBUF_HPP
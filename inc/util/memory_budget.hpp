@@ -0,0 +1,145 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_MEMORY_BUDGET_HPP
+#define UTIL_MEMORY_BUDGET_HPP
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ebi
+{
+  namespace util
+  {
+    /**
+     * Approximate memory of a node of std::map, std::multimap or std::multiset, besides its value
+     */
+    size_t const tree_node_overhead = 4 * sizeof(void *);
+
+    /**
+     * Approximate memory allocated by a string, besides the std::string itself. Short strings are stored inside it.
+     */
+    inline size_t heap_size(std::string const & text)
+    {
+        return text.capacity() < 16 ? 0 : text.capacity() + 1;
+    }
+
+    /**
+     * Central accounting of the memory used by the structures that grow with the input, such as the records kept to
+     * find duplicates, the contigs seen, the meta entries or the warnings already reported, so that all of them
+     * share a single limit.
+     *
+     * Those structures reserve an estimate of the memory of each entry before storing it, and release it when the
+     * entry is removed. When a reservation fails, they degrade (e.g. forgetting old entries) and explain how in a
+     * note, instead of exceeding the limit. Without a limit the reservations always succeed, but they are still
+     * accounted.
+     */
+    class MemoryBudget
+    {
+      public:
+        MemoryBudget() : limit{0}, used{0}, peak{0} { }
+
+        /**
+         * @param bytes: maximum amount of memory of all the reservations, 0 for no limit
+         */
+        void set_limit(size_t bytes)
+        {
+            limit = bytes;
+        }
+
+        size_t get_limit() const
+        {
+            return limit;
+        }
+
+        /**
+         * @return false, reserving nothing, if the reservation would exceed the limit
+         */
+        bool reserve(size_t bytes)
+        {
+            size_t current = used.load();
+            do {
+                if (limit > 0 && current + bytes > limit) {
+                    return false;
+                }
+            } while (not used.compare_exchange_weak(current, current + bytes));
+
+            size_t current_peak = peak.load();
+            while (current + bytes > current_peak
+                   && not peak.compare_exchange_weak(current_peak, current + bytes)) {
+            }
+            return true;
+        }
+
+        void release(size_t bytes)
+        {
+            used -= bytes;
+        }
+
+        size_t get_used() const
+        {
+            return used;
+        }
+
+        size_t get_peak() const
+        {
+            return peak;
+        }
+
+        /**
+         * Explains how a structure degraded after a reservation failed. Repeated notes are only kept once, but the
+         * structures should add each note only once, as this is slower than reserving.
+         */
+        void add_note(std::string const & note)
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            for (auto & existing : notes) {
+                if (existing == note) {
+                    return;
+                }
+            }
+            notes.push_back(note);
+        }
+
+        std::vector<std::string> get_notes() const
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            return notes;
+        }
+
+      private:
+        std::atomic<size_t> limit;
+        std::atomic<size_t> used;
+        std::atomic<size_t> peak;
+
+        mutable std::mutex mutex;
+        std::vector<std::string> notes;
+    };
+
+    /**
+     * Budget shared by every validation in the process
+     */
+    inline MemoryBudget & memory_budget()
+    {
+        static MemoryBudget budget;
+        return budget;
+    }
+  }
+}
+
+#endif // UTIL_MEMORY_BUDGET_HPP
@@ -0,0 +1,81 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_SERIALIZATION_HPP
+#define UTIL_SERIALIZATION_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace ebi
+{
+  namespace util
+  {
+    /**
+     * Helpers to write and read the binary files that keep the state of a validation (cached headers, checkpoints).
+     *
+     * Numbers are written with the native byte order, as these files are only meant to be read again by the same
+     * build of the validator. Readers throw std::runtime_error when the input ends too soon.
+     */
+    inline void write_size(std::ostream &output, size_t size)
+    {
+        uint64_t value = size;
+        output.write(reinterpret_cast<char const *>(&value), sizeof(value));
+    }
+
+    inline void write_string(std::ostream &output, std::string const &text)
+    {
+        write_size(output, text.size());
+        output.write(text.data(), text.size());
+    }
+
+    inline size_t read_size(std::istream &input)
+    {
+        uint64_t value;
+        if (not input.read(reinterpret_cast<char *>(&value), sizeof(value))) {
+            throw std::runtime_error{"Unexpected end of a saved validation state"};
+        }
+        return value;
+    }
+
+    inline std::string read_string(std::istream &input)
+    {
+        size_t size = read_size(input);
+        std::string text(size, '\0');
+        if (size > 0 && not input.read(&text[0], size)) {
+            throw std::runtime_error{"Unexpected end of a saved validation state"};
+        }
+        return text;
+    }
+
+    /**
+     * Checks the tag written at the beginning of a file, which changes whenever the format of the file changes
+     *
+     * @throw std::runtime_error if the tag doesn't match
+     */
+    inline void read_magic(std::istream &input, std::string const &magic)
+    {
+        std::string read(magic.size(), '\0');
+        if (not input.read(&read[0], read.size()) || read != magic) {
+            throw std::runtime_error{"The saved validation state was not written by this version of the validator"};
+        }
+    }
+  }
+}
+
+#endif // UTIL_SERIALIZATION_HPP
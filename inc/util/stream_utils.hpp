@@ -48,16 +48,19 @@ namespace ebi
     template <typename Container>
     Container &readline(std::istream & stream, Container & container)
     {
-        char c;
         container.clear();
 
-        // using operator bool: http://www.cplusplus.com/reference/ios/ios/fail/
-        // `stream.get()` sets failbit as well on eof
-        while (stream && stream.get(c)) {
-            container.push_back(c);
-            if (c == '\n') {
-                break;
-            }
+        // std::getline finds the newline in the buffer of the stream, instead of reading one character at a time
+        thread_local std::string line;
+        if (not std::getline(stream, line)) {
+            return container;
+        }
+        container.insert(container.end(), line.begin(), line.end());
+        if (stream.eof()) {
+            // like reading one more character, the last line without a newline leaves the stream failed
+            stream.setstate(std::ios::failbit);
+        } else {
+            container.push_back('\n');
         }
 
         return container;
@@ -0,0 +1,95 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_TEE_STREAMBUF_HPP
+#define UTIL_TEE_STREAMBUF_HPP
+
+#include <functional>
+#include <streambuf>
+#include <vector>
+
+namespace ebi
+{
+  namespace util
+  {
+    size_t const default_tee_buffer_size = 1024 * 1024;
+
+    /**
+     * Input stream buffer that reads from another stream buffer and hands every chunk of bytes to a list of sinks
+     * before making it available to the reader.
+     *
+     * This allows doing several things with the same bytes (validating and forwarding them to another program, for
+     * instance) while reading the input only once. Example usage:
+     * ```
+     * TeeStreambuf tee{*std::cin.rdbuf()};
+     * tee.add_sink([](char const * data, size_t size) { std::cout.write(data, size); });
+     * std::istream input{&tee};
+     * ```
+     * Sinks receive the bytes in the same order as they are read, exactly once, regardless of how the reader
+     * consumes them.
+     */
+    class TeeStreambuf : public std::streambuf
+    {
+      public:
+        using Sink = std::function<void(char const * data, size_t size)>;
+
+        TeeStreambuf(std::streambuf & source, size_t buffer_size = default_tee_buffer_size)
+                : source(source), buffer(buffer_size), sinks{} { }
+
+        void add_sink(Sink sink)
+        {
+            sinks.push_back(sink);
+        }
+
+        /**
+         * Reads the rest of the source, so that the sinks receive all of it even if the reader stopped early.
+         */
+        void drain()
+        {
+            do {
+                setg(buffer.data(), egptr(), egptr());
+            } while (underflow() != traits_type::eof());
+        }
+
+      protected:
+        virtual int_type underflow() override
+        {
+            if (gptr() < egptr()) {
+                return traits_type::to_int_type(*gptr());
+            }
+
+            std::streamsize read = source.sgetn(buffer.data(), buffer.size());
+            if (read <= 0) {
+                return traits_type::eof();
+            }
+
+            for (auto & sink : sinks) {
+                sink(buffer.data(), static_cast<size_t>(read));
+            }
+
+            setg(buffer.data(), buffer.data(), buffer.data() + read);
+            return traits_type::to_int_type(*gptr());
+        }
+
+      private:
+        std::streambuf & source;
+        std::vector<char> buffer;
+        std::vector<Sink> sinks;
+    };
+  }
+}
+
+#endif // UTIL_TEE_STREAMBUF_HPP
@@ -0,0 +1,113 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_BLOCK_MANIFEST_HPP
+#define VCF_BLOCK_MANIFEST_HPP
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "vcf/validator.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Minimum amount of lines in a block. It is not smaller than the default capacity of RecordCache, so the
+     * duplicates found in a block only depend on that block and the previous one.
+     */
+    size_t const block_min_lines = 1000;
+
+    /**
+     * Maximum amount of lines in a block, in case no line hash marks a boundary
+     */
+    size_t const block_max_lines = 16 * 1024;
+
+    /**
+     * After the minimum size, a block ends after a line whose hash has these bits set to 0, which happens on average
+     * once every 2048 lines. As the boundaries depend on the content of the lines and not on their position, an
+     * inserted or removed line only changes the block where it is.
+     */
+    size_t const block_boundary_mask = 2048 - 1;
+
+    /**
+     * Body lines validated together, identified by the hash of their content, and the errors and warnings found
+     * while validating them, serialized with their line numbers. The states of the sortedness checks and of the
+     * checks between records before the first line (see Parser::save_sorting and Parser::save_record_checks) tell
+     * whether the lines before the block still lead to the same results.
+     */
+    struct ValidatedBlock
+    {
+        std::string hash;
+        size_t first_line;
+        size_t lines;
+        std::vector<std::string> errors;
+        std::vector<std::string> warnings;
+        std::string sorting_state;
+        std::string record_checks_state;
+    };
+
+    /**
+     * Results of a validation split into blocks, so that the next validation of a similar file only validates the
+     * blocks that changed. The key identifies the header, the type of parser and the settings of the validation:
+     * the blocks of a manifest with another key are never reused.
+     */
+    struct BlockManifest
+    {
+        std::string key;
+        std::vector<ValidatedBlock> blocks;
+    };
+
+    void write_block_manifest(std::string const &path, BlockManifest const &manifest);
+
+    /**
+     * @throw std::runtime_error if the file can't be read or was not written by this version of the validator
+     */
+    BlockManifest read_block_manifest(std::string const &path);
+
+    /**
+     * Validation that splits the body into content-defined blocks and fills `manifest` with the hash and the errors
+     * of each one.
+     *
+     * If a `previous` manifest with the same key is provided, the input is read twice: first to split it into
+     * blocks, then to validate it. Each block that is identical to a block of the previous validation, preceded by
+     * the same block as then, and reached with the same state of the sortedness checks (e.g. no contig was added or
+     * removed before it) and of the checks between records (e.g. the same breakend mates are still expected), is
+     * not validated: its errors are reported again with their line numbers moved to the new position. The other
+     * blocks are validated, after restoring both states before the block that precedes them and validating that
+     * block without reporting it, so that the duplicates, sorting and cross-record checks see the same neighbours.
+     * In that case the input must be seekable.
+     *
+     * `settings` must describe any option that changes the results, such as the ploidy or the selected samples.
+     *
+     * @return whether no errors were found, either in the validated blocks or in the reused ones
+     */
+    bool is_valid_vcf_file_blocks(std::istream &input,
+                                  const std::string &sourceName,
+                                  ValidationLevel validationLevel,
+                                  Ploidy ploidy,
+                                  std::vector<std::unique_ptr<ReportWriter>> &outputs,
+                                  std::string const &settings,
+                                  BlockManifest &manifest,
+                                  BlockManifest const *previous = nullptr,
+                                  ValidationOptions const &validationOptions = ValidationOptions{});
+  }
+}
+
+#endif // VCF_BLOCK_MANIFEST_HPP
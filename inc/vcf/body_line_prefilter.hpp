@@ -0,0 +1,39 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_BODY_LINE_PREFILTER_HPP
+#define VCF_BODY_LINE_PREFILTER_HPP
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Checks whether a line of the body has one of the most common shapes, all of them accepted by the grammar of
+     * every VCF version: an alphanumeric CHROM, a numeric POS, bases in REF and ALT, simple QUAL, FILTER and INFO
+     * values, and either no FORMAT or a FORMAT followed by samples without empty subfields.
+     *
+     * It is much cheaper than the parser, because it only looks up the class of each byte in a table, but it's
+     * conservative: a line that is not accepted may still be right, and has to be parsed to know it.
+     *
+     * @param begin: first character of the line
+     * @param end: one past the last character of the line, which must be a '\n'
+     */
+    bool is_well_formed_body_line(char const * begin, char const * end);
+  }
+}
+
+#endif // VCF_BODY_LINE_PREFILTER_HPP
@@ -0,0 +1,113 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_CHECKPOINT_HPP
+#define VCF_CHECKPOINT_HPP
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "vcf/validator.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Megabytes of input validated between two checkpoints, if not specified
+     */
+    size_t const default_checkpoint_interval = 1024;
+
+    struct CheckpointOptions
+    {
+        std::string path;       ///< file where the checkpoints are written, each one replacing the previous
+        size_t interval;        ///< bytes of input validated between two checkpoints
+        std::string settings;   ///< options that change the results, such as the ploidy or the selected samples
+    };
+
+    /**
+     * State of an interrupted validation: where to continue reading the input, and the saved state of the parser
+     * (and its type, which depends on the validation level and VCF version, and its grammar) and of each report.
+     * The settings of the validation and the digest of the input before the offset tell whether the validation can
+     * be resumed with some options and input.
+     */
+    struct Checkpoint
+    {
+        std::string parser_type;
+        std::string parser_grammar;
+        std::string settings;
+        std::streamoff input_offset;
+        std::string input_digest;
+        std::string parser_state;
+        std::vector<std::string> report_states;
+    };
+
+    /**
+     * Writes the checkpoint to a temporary file and then renames it, so that an interruption while writing it
+     * leaves the previous checkpoint intact
+     *
+     * @param input_digest digest of the input before `input_offset`, see `input_digest`
+     */
+    void write_checkpoint(CheckpointOptions const &options,
+                          std::streamoff input_offset,
+                          std::string const &input_digest,
+                          Parser const &validator,
+                          std::vector<std::unique_ptr<ReportWriter>> &outputs);
+
+    /**
+     * MD5 of the first `size` bytes of the input, leaving it at the same position. It tells whether the part of an
+     * input validated before a checkpoint is still the same when the validation is resumed.
+     *
+     * @throw std::runtime_error if the input is not seekable
+     */
+    std::string input_digest(std::istream &input, std::streamoff size);
+
+    /**
+     * @throw std::runtime_error if the file can't be read or was not written by this version of the validator
+     */
+    Checkpoint read_checkpoint(std::string const &path);
+
+    /**
+     * Reopens the reports of an interrupted validation. Only text reports can be continued.
+     */
+    std::vector<std::unique_ptr<ReportWriter>> resume_outputs(Checkpoint const &checkpoint);
+
+    /**
+     * Validation that writes a checkpoint every `options.interval` bytes of input, after a complete line. If it is
+     * interrupted, it can be resumed from the last checkpoint with `resume` (and the reports from `resume_outputs`):
+     * the header is not read again, and the body is read from the saved offset, so the input must be seekable.
+     *
+     * The checkpoint file is removed when the validation finishes.
+     *
+     * @throw std::invalid_argument if the checkpoint to resume was written by another kind of parser, with other
+     * settings, or for an input whose bytes before the saved offset are not the same
+     *
+     * @return whether no errors were found in the whole input, including the part validated before resuming
+     */
+    bool is_valid_vcf_file_checkpointed(std::istream &input,
+                                        const std::string &sourceName,
+                                        ValidationLevel validationLevel,
+                                        Ploidy ploidy,
+                                        std::vector<std::unique_ptr<ReportWriter>> &outputs,
+                                        CheckpointOptions const &options,
+                                        Checkpoint const *resume = nullptr,
+                                        ValidationOptions const &validationOptions = ValidationOptions{});
+  }
+}
+
+#endif // VCF_CHECKPOINT_HPP
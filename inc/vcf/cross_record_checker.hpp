@@ -0,0 +1,143 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_CROSS_RECORD_CHECKER_HPP
+#define VCF_CROSS_RECORD_CHECKER_HPP
+
+#include <deque>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "vcf/error.hpp"
+#include "vcf/file_structure.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Checks the rules that involve several records of a sorted body:
+     * - a gVCF reference block (ALT <*> with INFO END) should not overlap the following records
+     * - the mate of a breakend, given by INFO MATEID and the position in the ALT, should be present and point back
+     * - in VCFv4.3, an ID should not be used in more than one record
+     *
+     * The rules that the records read so far can't resolve are kept in tables by contig and position, and dropped as
+     * soon as the input moves past their position. This way the memory depends on the records around the current one,
+     * instead of on the size of the input. Because of that, repeated IDs are only found if their records are less than
+     * `id_window` positions apart.
+     *
+     * Everything found is a warning: an unsorted input makes these rules meaningless, and that is already an error.
+     * The memory of the tables is reserved in util::memory_budget(). If the budget is exhausted, the new rules are not
+     * checked.
+     */
+    class CrossRecordChecker
+    {
+      public:
+        static size_t const default_id_window = 1000;
+
+        CrossRecordChecker(size_t id_window = default_id_window);
+        ~CrossRecordChecker();
+
+        CrossRecordChecker(CrossRecordChecker const &) = delete;
+        CrossRecordChecker & operator=(CrossRecordChecker const &) = delete;
+
+        /**
+         * Checks a record against the previous ones and remembers what it expects from the next ones
+         *
+         * @return the warnings of this record and of the previous records whose expectations can't be met anymore
+         */
+        std::vector<std::unique_ptr<Error>> check(Record const & record);
+
+        /**
+         * Forgets every record, e.g. to check an unrelated part of the input
+         */
+        void clear();
+
+        /**
+         * Ends the input: the mates still expected can't be found anymore, either because they were after the last
+         * record of their contig or because their contig was never read
+         *
+         * @return the warnings of the records whose mates are missing, by line
+         */
+        std::vector<std::unique_ptr<Error>> finish();
+
+        /**
+         * Writes the rules still waiting for the next records, to continue checking them after a restart. Their lines
+         * are written relative to `first_line`, so that the states before the same records in two positions of an
+         * input can be compared.
+         */
+        void write_state(std::ostream & output, size_t first_line = 0) const;
+
+        /**
+         * Restores a state written by `write_state`, moving its lines to be relative to `first_line`. Nothing is
+         * modified unless the whole state is read correctly.
+         *
+         * @throw std::runtime_error if the input is truncated
+         */
+        void read_state(std::istream & input, size_t first_line = 0);
+
+      private:
+        /**
+         * A breakend mate that should be found at a position: a record with ID `mate_id`, pointing back to `id`
+         */
+        struct PendingMate
+        {
+            std::string id;
+            std::string mate_id;
+            size_t line;
+        };
+
+        size_t id_window;
+
+        std::unordered_map<std::string, size_t> contig_ids;     ///< index of each contig name in the vectors below
+        std::vector<std::string> contig_names;
+        std::vector<bool> contig_seen;                          ///< whether each contig has been read since the last clear
+        std::vector<std::multimap<size_t, PendingMate>> pending_mates;  ///< by contig, then by expected position
+
+        size_t current_contig;
+        size_t first_contig;        ///< where the input started, the mates expected before it can't be checked
+        size_t first_position;
+
+        std::multimap<size_t, size_t> reference_blocks;        ///< end -> line, of the current contig
+        std::unordered_map<std::string, size_t> id_lines;       ///< line of each ID of the current window
+        std::deque<std::pair<size_t, std::string>> id_positions;    ///< IDs of the current window by position
+
+        size_t reserved;            ///< memory of the tables, reserved in util::memory_budget()
+        bool degraded;              ///< whether the memory budget has already prevented storing some rules
+
+        static size_t memory(PendingMate const & mate);
+
+        size_t intern(std::string const & contig);
+        bool reserve(size_t bytes);
+        void release(size_t bytes);
+
+        void move_to(size_t contig, size_t position, std::vector<std::unique_ptr<Error>> & warnings);
+        void expire_mates(size_t contig, size_t before_position, std::vector<std::unique_ptr<Error>> & warnings);
+
+        void check_reference_blocks(Record const & record, std::vector<std::unique_ptr<Error>> & warnings);
+        void check_ids(Record const & record, std::vector<std::unique_ptr<Error>> & warnings);
+        void check_mates(Record const & record, std::vector<std::unique_ptr<Error>> & warnings);
+
+        void forget_ids();
+    };
+  }
+}
+
+#endif // VCF_CROSS_RECORD_CHECKER_HPP
@@ -0,0 +1,118 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_DAEMON_HPP
+#define VCF_DAEMON_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "vcf/header_cache.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    const char default_daemon_socket[] = "/tmp/vcf_validatord.sock";
+    size_t const default_daemon_threads = 4;
+
+    /**
+     * Validation requested to the daemon. The fields have the same meaning as the options of vcf_validator.
+     */
+    struct DaemonRequest
+    {
+        std::string input;              ///< absolute path readable by the daemon, or "stdin" to send the input bytes
+        std::string level;
+        long ploidy;
+        std::string special_ploidy;
+    };
+
+    /**
+     * Service that validates VCF files sent by local clients through a UNIX domain socket.
+     *
+     * Each connection is a single validation: the client writes a request (a "key=value" line per field of
+     * DaemonRequest, and an empty line) followed by the input if the input is "stdin". The daemon answers with one
+     * line per result, with a tag and a tab before its content:
+     *  - "report": a line of the text report, exactly as vcf_validator writes it
+     *  - "result": "valid" or "invalid", always the last line of a finished validation
+     *  - "failure": the reason why the validation couldn't run, instead of "result"
+     *
+     * Connections are queued and validated by a pool of threads that share a header cache, so files with the same
+     * header skip validating it after the first one.
+     *
+     * The daemon reads files with its own permissions, so only the user that started it can connect: the socket is
+     * only accessible to that user, and the connections of other users are answered with a "failure".
+     */
+    class Daemon
+    {
+      public:
+        /**
+         * Listens on `socket_path`, replacing the socket left by a previous daemon that is not running anymore
+         *
+         * @throw std::runtime_error if the socket can't be created, another daemon is listening on it, or the path
+         * exists and is not a socket
+         */
+        Daemon(std::string const & socket_path, size_t threads, std::unique_ptr<HeaderCache> headerCache = nullptr);
+
+        ~Daemon();
+
+        /**
+         * Accepts connections until `stop` is called
+         */
+        void run();
+
+        /**
+         * Stops accepting connections, finishes the queued ones and makes `run` return. Can be called from any thread.
+         */
+        void stop();
+
+      private:
+        void work();
+        void serve(int connection);
+
+        std::string socket_path;
+        int listener;
+        std::unique_ptr<HeaderCache> headerCache;
+        std::vector<std::thread> workers;
+        std::deque<int> pending;
+        std::mutex pending_mutex;
+        std::condition_variable pending_changed;
+        std::atomic<bool> stopping;
+    };
+
+    /**
+     * Runs a validation in a daemon listening on `socket_path`. If the request's input is "stdin", `input` is sent
+     * through the socket. Each line of the text report is handed to `report` as soon as it is received.
+     *
+     * @return whether the input is valid
+     * @throw std::runtime_error if the daemon can't be reached or couldn't validate the input
+     */
+    bool validate_in_daemon(std::string const & socket_path,
+                            DaemonRequest const & request,
+                            std::istream & input,
+                            std::function<void(std::string const &)> report);
+  }
+}
+
+#endif // VCF_DAEMON_HPP
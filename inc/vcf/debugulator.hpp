@@ -25,6 +25,8 @@
 
 #include "util/stream_utils.hpp"
 #include "vcf/fixer.hpp"
+#include "vcf/line_index.hpp"
+#include "vcf/recheck.hpp"
 #include "vcf/report_reader.hpp"
 
 namespace ebi
@@ -36,9 +38,21 @@ namespace ebi
 
       size_t const default_line_buffer_size = 64 * 1024;
 
+      /**
+       * Writes the input into the output, fixing the errors of the report. If a manifest is provided, the ranges of
+       * lines that were changed or removed are described in it, with their positions in the output and the position
+       * of the `manifest->context_lines` lines before them.
+       *
+       * If a line index of the input is provided, the lines between the errors are copied in big chunks, from the
+       * closest indexed line before each error, instead of reading them one by one.
+       *
+       * @return amount of errors that couldn't be fixed
+       */
       size_t fix_vcf_file(std::istream &input,
                         ebi::vcf::ReportReader &errorDAO,
-                        std::ostream &output);
+                        std::ostream &output,
+                        FixManifest *manifest = nullptr,
+                        LineIndex const *index = nullptr);
     }
   }
 }
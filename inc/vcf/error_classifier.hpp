@@ -0,0 +1,127 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_ERROR_CLASSIFIER_HPP
+#define VCF_ERROR_CLASSIFIER_HPP
+
+#include <string>
+#include <vector>
+
+#include "vcf/error.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Tells the dynamic type of an Error as a number and as a name, so that errors can be grouped by class.
+     *
+     * As the visitor interface returns `void`, the last class visited is stored in `current`.
+     *
+     * Use this class like this:
+     * ~~~
+     * ErrorClassifier classifier;
+     * counts[classifier.classify(error)]++;
+     * std::cout << classifier.name(error) << std::endl;
+     * ~~~
+     */
+    class ErrorClassifier : public ErrorVisitor
+    {
+      public:
+        ErrorClassifier() : current{0} {}
+
+        /**
+         * Names of every class of Error, indexed by the value returned by `classify`
+         */
+        static std::vector<std::string> const & names()
+        {
+            static std::vector<std::string> const class_names{
+                "Error", "MetaSectionError", "HeaderSectionError", "BodySectionError", "NoMetaDefinitionError",
+                "FileformatError", "ChromosomeBodyError", "PositionBodyError", "IdBodyError",
+                "ReferenceAlleleBodyError", "AlternateAllelesBodyError", "QualityBodyError", "FilterBodyError",
+                "InfoBodyError", "FormatBodyError", "SamplesBodyError", "SamplesFieldBodyError",
+                "NormalizationError", "DuplicationError"};
+            return class_names;
+        }
+
+        size_t classify(Error &error)
+        {
+            error.apply_visitor(*this);
+            return current;
+        }
+
+        std::string const & name(Error &error)
+        {
+            return names()[classify(error)];
+        }
+
+        /**
+         * Same value as `classify`, for an error of static type ErrorType that doesn't need to be built. It is a
+         * constant expression, so it can be a `case` label.
+         */
+        template <typename ErrorType>
+        static constexpr size_t index()
+        {
+            return index_of(static_cast<ErrorType *>(nullptr));
+        }
+
+        virtual void visit(Error &error) { current = index<Error>(); }
+        virtual void visit(MetaSectionError &error) { current = index<MetaSectionError>(); }
+        virtual void visit(HeaderSectionError &error) { current = index<HeaderSectionError>(); }
+        virtual void visit(BodySectionError &error) { current = index<BodySectionError>(); }
+        virtual void visit(NoMetaDefinitionError &error) { current = index<NoMetaDefinitionError>(); }
+        virtual void visit(FileformatError &error) { current = index<FileformatError>(); }
+        virtual void visit(ChromosomeBodyError &error) { current = index<ChromosomeBodyError>(); }
+        virtual void visit(PositionBodyError &error) { current = index<PositionBodyError>(); }
+        virtual void visit(IdBodyError &error) { current = index<IdBodyError>(); }
+        virtual void visit(ReferenceAlleleBodyError &error) { current = index<ReferenceAlleleBodyError>(); }
+        virtual void visit(AlternateAllelesBodyError &error) { current = index<AlternateAllelesBodyError>(); }
+        virtual void visit(QualityBodyError &error) { current = index<QualityBodyError>(); }
+        virtual void visit(FilterBodyError &error) { current = index<FilterBodyError>(); }
+        virtual void visit(InfoBodyError &error) { current = index<InfoBodyError>(); }
+        virtual void visit(FormatBodyError &error) { current = index<FormatBodyError>(); }
+        virtual void visit(SamplesBodyError &error) { current = index<SamplesBodyError>(); }
+        virtual void visit(SamplesFieldBodyError &error) { current = index<SamplesFieldBodyError>(); }
+        virtual void visit(NormalizationError &error) { current = index<NormalizationError>(); }
+        virtual void visit(DuplicationError &error) { current = index<DuplicationError>(); }
+
+      private:
+        size_t current;
+
+        static constexpr size_t index_of(Error *) { return 0; }
+        static constexpr size_t index_of(MetaSectionError *) { return 1; }
+        static constexpr size_t index_of(HeaderSectionError *) { return 2; }
+        static constexpr size_t index_of(BodySectionError *) { return 3; }
+        static constexpr size_t index_of(NoMetaDefinitionError *) { return 4; }
+        static constexpr size_t index_of(FileformatError *) { return 5; }
+        static constexpr size_t index_of(ChromosomeBodyError *) { return 6; }
+        static constexpr size_t index_of(PositionBodyError *) { return 7; }
+        static constexpr size_t index_of(IdBodyError *) { return 8; }
+        static constexpr size_t index_of(ReferenceAlleleBodyError *) { return 9; }
+        static constexpr size_t index_of(AlternateAllelesBodyError *) { return 10; }
+        static constexpr size_t index_of(QualityBodyError *) { return 11; }
+        static constexpr size_t index_of(FilterBodyError *) { return 12; }
+        static constexpr size_t index_of(InfoBodyError *) { return 13; }
+        static constexpr size_t index_of(FormatBodyError *) { return 14; }
+        static constexpr size_t index_of(SamplesBodyError *) { return 15; }
+        static constexpr size_t index_of(SamplesFieldBodyError *) { return 16; }
+        static constexpr size_t index_of(NormalizationError *) { return 17; }
+        static constexpr size_t index_of(DuplicationError *) { return 18; }
+    };
+  }
+}
+
+#endif // VCF_ERROR_CLASSIFIER_HPP
@@ -17,16 +17,28 @@
 #ifndef VCF_ERROR_POLICY_HPP
 #define VCF_ERROR_POLICY_HPP
 
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "parsing_state.hpp"
 #include "error.hpp"
+#include "error_classifier.hpp"
 
 namespace ebi
 {
   namespace vcf
   {
-    
+    /**
+     * Amount of errors and warnings found, indexed by the class of the error as in ErrorClassifier::names()
+     */
+    struct ErrorCounts
+    {
+        std::vector<size_t> errors;
+        std::vector<size_t> warnings;
+    };
+
     /**
      * Error management policy that aborts execution when an error is found
      */
@@ -35,6 +47,16 @@ namespace ebi
       public:
         void handle_error(ParsingState &state, Error *error);
         void handle_warning(ParsingState &state, Error *error);
+        ErrorCounts const & get_counts() const;
+
+        /**
+         * Handles an error built from the arguments of its constructor
+         */
+        template <typename ErrorType, typename... Args>
+        void handle_new_error(ParsingState &state, Args &&... args)
+        {
+            handle_error(state, new ErrorType{std::forward<Args>(args)...});
+        }
     };
 
     /**
@@ -45,6 +67,47 @@ namespace ebi
       public:
         void handle_error(ParsingState &state, Error *error);
         void handle_warning(ParsingState &state, Error *error);
+        ErrorCounts const & get_counts() const;
+
+        /**
+         * Handles an error built from the arguments of its constructor
+         */
+        template <typename ErrorType, typename... Args>
+        void handle_new_error(ParsingState &state, Args &&... args)
+        {
+            handle_error(state, new ErrorType{std::forward<Args>(args)...});
+        }
+    };
+
+    /**
+     * Error management policy that counts the errors and warnings of each class, keeping only the first one of
+     * each class to be reported. The others are freed as soon as they are found.
+     */
+    class CountErrorPolicy
+    {
+      public:
+        CountErrorPolicy();
+
+        void handle_error(ParsingState &state, Error *error);
+        void handle_warning(ParsingState &state, Error *error);
+        ErrorCounts const & get_counts() const;
+
+        /**
+         * Counts an error of the syntax, built from the arguments of its constructor only if it is the first one of
+         * its class, so that the rest don't allocate anything
+         */
+        template <typename ErrorType, typename... Args>
+        void handle_new_error(ParsingState &state, Args &&... args)
+        {
+            state.m_is_valid = false;
+            if (counts.errors[ErrorClassifier::index<ErrorType>()]++ == 0) {
+                state.add_error(std::unique_ptr<Error>{new ErrorType{std::forward<Args>(args)...}});
+            }
+        }
+
+      private:
+        ErrorClassifier classifier;
+        ErrorCounts counts;
     };
 
   }
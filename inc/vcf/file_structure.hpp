@@ -29,7 +29,9 @@
 
 #include "util/stream_utils.hpp"
 #include "vcf/error.hpp"
+#include "vcf/meta_key_values.hpp"
 #include "vcf/ploidy.hpp"
+#include "vcf/sample_selection.hpp"
 #include "vcf/string_constants.hpp"
 
 namespace ebi
@@ -39,6 +41,7 @@ namespace ebi
     struct Source;
     struct MetaEntry;
     struct Record;
+    class ReferenceFasta;
     
     typedef std::multimap<std::string, MetaEntry>::iterator meta_iterator;
 
@@ -216,7 +219,7 @@ namespace ebi
         Structure structure; // Union discriminant
 
         boost::variant< std::string, 
-                        std::map<std::string, std::string> > value;
+                        MetaKeyValues > value;
 
         std::shared_ptr<Source> source;
         
@@ -226,12 +229,12 @@ namespace ebi
         
         MetaEntry(size_t line,
                   std::string const & id,
-                  std::string const & plain_value,
+                  std::string plain_value,
                   std::shared_ptr<Source> source);
         
         MetaEntry(size_t line,
                   std::string const & id,
-                  std::map<std::string, std::string> const & key_values,
+                  MetaKeyValues key_values,
                   std::shared_ptr<Source> source);
         
         bool operator==(MetaEntry const &) const;
@@ -247,6 +250,27 @@ namespace ebi
         void check_value();
     };
     
+    /**
+     * Number and Type of an INFO or FORMAT field, as described in the meta section
+     */
+    struct FieldMeta
+    {
+        bool in_meta;           ///< whether the meta section describes the field, otherwise it's checked as a predefined tag
+        std::string number;
+        std::string type;
+    };
+
+    /**
+     * Checks of a FORMAT column that only depend on its fields and the meta section. Almost all the records of a file
+     * share a handful of FORMAT columns, so each plan is resolved once and reused by all the records that have it.
+     */
+    struct FormatPlan
+    {
+        bool gt_misplaced;              ///< GT is in the FORMAT column, but not first
+        bool has_duplicates;            ///< some field is listed more than once
+        std::vector<FieldMeta> fields;  ///< description of each field, in the order of the FORMAT column
+    };
+
     struct Source 
     {
         std::string name;           /**< Name of the source to interact with (file, stdin...) */
@@ -256,6 +280,12 @@ namespace ebi
 
         std::multimap<std::string, MetaEntry> meta_entries; /**< Entries in the file meta-data */
         std::vector<std::string> samples_names; /**< Names of the sequenced samples */
+
+        SampleSelection sample_selection;       /**< Samples whose columns are validated */
+        std::vector<bool> validated_samples;    /**< Whether each sample is validated, all of them if empty */
+        bool collect_all_errors = false;        /**< Whether all the checks of a record run, instead of stopping at the first error */
+        bool record_blocks = false;             /**< Whether the position, sorting and contig checks run over blocks of records, see RecordBlock */
+        std::shared_ptr<ReferenceFasta const> reference;    /**< Sequence of the assembly to check the REF alleles against, if provided */
         
         Source(std::string const & name,
                unsigned const input_format,
@@ -263,7 +293,41 @@ namespace ebi
                Ploidy ploidy,
                std::multimap<std::string, MetaEntry> const & meta_entries = {},
                std::vector<std::string> const & samples_names = {});
-        
+
+        /**
+         * Stores the names of the samples and which of them are validated according to `sample_selection`.
+         *
+         * The names are taken by value, so the callers that don't need them anymore can move them in: a header line
+         * can list hundreds of thousands of samples.
+         */
+        void set_samples_names(std::vector<std::string> names);
+
+        bool is_sample_validated(size_t index) const
+        {
+            return validated_samples.empty() || index >= validated_samples.size() || validated_samples[index];
+        }
+
+        /**
+         * Plan of the checks of a FORMAT column, resolved against the meta section the first time it's requested
+         */
+        FormatPlan const & get_format_plan(std::vector<std::string> const & format);
+
+        /**
+         * Description of an INFO field in the meta section, or nullptr if it's not there. If several INFO entries
+         * have the same ID, the first one is used.
+         */
+        FieldMeta const * find_info_meta(std::string const & id);
+
+        /**
+         * Forgets the plans and INFO descriptions resolved so far. It must be called whenever `meta_entries` is
+         * modified, so that they are resolved again against the new entries.
+         */
+        void meta_entries_changed();
+
+      private:
+        std::map<std::vector<std::string>, FormatPlan> format_plans;
+        std::map<std::string, FieldMeta> info_meta;
+        bool info_meta_resolved = false;
     };
     
     struct Record 
@@ -298,13 +362,42 @@ namespace ebi
                 std::multimap<std::string, std::string> const & info,
                 std::vector<std::string> const & format,
                 std::vector<std::string> const & samples,
-                std::shared_ptr<Source> source);
+                std::shared_ptr<Source> source,
+                std::vector<std::unique_ptr<Error>> * collected_errors = nullptr);
         
         bool operator==(Record const &) const;
 
         bool operator!=(Record const &) const;
+
+        /**
+         * Whether the record is a gVCF reference block, i.e. its only alternate allele is <*>
+         */
+        bool is_reference_block() const;
         
     private:
+
+        /**
+         * Check of a FORMAT field in the samples of a reference block, resolved once per record
+         */
+        struct ReferenceBlockField
+        {
+            enum class Kind { any, integer, non_negative_integer, floating, character };
+
+            long number;    ///< expected amount of values, or -1 if any amount is valid
+            Kind kind;
+        };
+
+        /**
+         * If not null, the errors of the checks are appended here instead of thrown. Only set in the constructor.
+         */
+        std::vector<std::unique_ptr<Error>> * collected_errors;
+
+        /**
+         * Runs a check. If the errors are being collected, the error of a failed check is kept and the following
+         * checks still run; otherwise it is thrown.
+         */
+        template <typename Check>
+        void run_check(Check check) const;
         
         void set_types();
         
@@ -350,6 +443,13 @@ namespace ebi
          */
         void check_ids_no_duplicates() const;
 
+        /**
+         * Checks that the reference allele matches the reference sequence of the source, if it was provided
+         *
+         * @throw ReferenceAlleleBodyError
+         */
+        void check_reference_allele() const;
+
         /**
          * Checks the structure of an alternate allele and its accordance to the meta section
          * 
@@ -462,6 +562,7 @@ namespace ebi
         /**
          * Checks that the samples in the record:
          * - Are the same number as specified in the Source object
+         * and, for those selected for validation in the Source object:
          * - Their allele indexes are not greater than the total number of alleles
          * - The number and type of the fields match the FORMAT meta information
          * 
@@ -476,18 +577,28 @@ namespace ebi
          */
         void check_samples_count() const;
 
-        /**
-         * Returns a vector of MetaEntry objects in the same order as they are displayed in the samples
-         */
-        std::vector<MetaEntry> get_meta_entry_objects() const;
-
         /**
          * Checks the sample contents and accordance to the meta section
          * 
          * @throw SamplesBodyError
          * @throw SamplesFieldBodyError
          */
-        void check_sample(size_t i, std::vector<MetaEntry> const & format_meta) const;
+        void check_sample(size_t i, FormatPlan const & plan) const;
+
+        /**
+         * Resolves the checks of the FORMAT fields of a reference block, whose samples are usually a handful of small
+         * numbers that can be checked without splitting them into strings.
+         *
+         * @return false if some field needs the general checks of check_sample
+         */
+        bool get_reference_block_fields(FormatPlan const & plan, std::vector<ReferenceBlockField> & fields) const;
+
+        /**
+         * Checks a sample of a reference block on its text. It only accepts samples that check_sample accepts, so the
+         * ones rejected here are checked again with check_sample, which reports the error.
+         */
+        bool is_valid_reference_block_sample(std::string const & sample,
+                                             std::vector<ReferenceBlockField> const & fields) const;
 
         /**
          * Checks that the number of subfields in the sample is not greater than the number in the FORMAT column
@@ -501,7 +612,7 @@ namespace ebi
          * 
          * @throw SamplesFieldBodyError
          */
-        void check_sample_subfields_cardinality_type(size_t i, std::vector<std::string> const & subfields, std::vector<MetaEntry> const & format_meta) const;
+        void check_sample_subfields_cardinality_type(size_t i, std::vector<std::string> const & subfields, FormatPlan const & plan) const;
 
         /**
          * Strict validation of predefined FORMAT tags
@@ -0,0 +1,63 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_HEADER_CACHE_HPP
+#define VCF_HEADER_CACHE_HPP
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "vcf/validator.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Directory of parser states reached after validating the meta and header sections, so that files sharing the
+     * same header (e.g. one file per chromosome) only go through the meta section grammar once.
+     *
+     * Each state is stored in a binary file named after the SHA-256 of the meta and header lines and the type of
+     * parser. Only headers without errors nor warnings are stored, so restoring one never needs to report anything.
+     */
+    class HeaderCache
+    {
+      public:
+        /**
+         * @throw std::invalid_argument if the directory doesn't exist
+         */
+        explicit HeaderCache(std::string const & directory);
+
+        /**
+         * Validates the meta and header sections, starting with the line already read in `line`, or restores the
+         * state of a previous validation of the same lines. Either way, leaves the first line of the body in `line`.
+         *
+         * @return the amount of lines in the meta and header sections
+         */
+        size_t validate_header(std::vector<char> &line,
+                               std::istream &input,
+                               Parser &validator,
+                               std::vector<std::unique_ptr<ReportWriter>> &outputs);
+
+      private:
+        std::string directory;
+    };
+  }
+}
+
+#endif // VCF_HEADER_CACHE_HPP
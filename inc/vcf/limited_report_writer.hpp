@@ -0,0 +1,82 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_LIMITED_REPORT_WRITER_HPP
+#define VCF_LIMITED_REPORT_WRITER_HPP
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "vcf/error_classifier.hpp"
+#include "vcf/report_writer.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Limits of the amount of errors of a validation, 0 meaning no limit
+     */
+    struct ErrorLimits
+    {
+        size_t max_errors;      ///< errors found before stopping the validation
+        size_t max_per_class;   ///< errors (and warnings) reported for each class in ErrorClassifier::names()
+    };
+
+    /**
+     * Thrown when the validation finds the maximum amount of errors. The report has already been marked as
+     * truncated when this is thrown.
+     */
+    class ErrorLimitReached : public std::runtime_error
+    {
+      public:
+        using std::runtime_error::runtime_error;
+    };
+
+    /**
+     * Forwards the errors to other reports until they reach some ErrorLimits.
+     *
+     * When a class of errors (or warnings) reaches `max_per_class`, a message is written and the next ones of
+     * that class are not reported. When `max_errors` errors have been found, counting the ones not reported, a
+     * message is written and ErrorLimitReached is thrown, which stops the validation without reading the rest
+     * of the input.
+     */
+    class LimitedReportWriter : public ReportWriter
+    {
+      public:
+        LimitedReportWriter(std::vector<std::unique_ptr<ReportWriter>> outputs, ErrorLimits limits);
+
+        virtual void write_error(Error &error) override;
+        virtual void write_warning(Error &error) override;
+        virtual void write_message(std::string const &message) override;
+        virtual void flush() override;
+
+      private:
+        std::vector<std::unique_ptr<ReportWriter>> outputs;
+        ErrorLimits limits;
+        ErrorClassifier classifier;
+        size_t errors;
+        std::vector<size_t> error_counts;     ///< by class, to apply max_per_class
+        std::vector<size_t> warning_counts;
+
+        bool is_reported(Error &error, std::vector<size_t> &counts, std::string const &kind);
+    };
+  }
+}
+
+#endif // VCF_LIMITED_REPORT_WRITER_HPP
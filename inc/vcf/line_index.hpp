@@ -0,0 +1,126 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_LINE_INDEX_HPP
+#define VCF_LINE_INDEX_HPP
+
+#include <iostream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "vcf/report_writer.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Lines between two entries of the index, so that reaching any line reads at most this amount of lines
+     */
+    size_t const default_line_index_interval = 4096;
+
+    /**
+     * Byte offsets where some lines of a file start: every `interval` lines, and the lines with errors
+     */
+    struct LineIndex
+    {
+        size_t interval;                            ///< 0 if only the lines with errors are indexed
+        std::streamoff input_size;                  ///< to detect that the index doesn't belong to a file
+        std::map<size_t, std::streamoff> offsets;   ///< by line number, the first line being the number 1
+
+        /**
+         * @return the last indexed line that is not after `line`, with its offset, or the first line of the file
+         */
+        std::pair<size_t, std::streamoff> find(size_t line) const;
+    };
+
+    void write_line_index(std::string const &path, LineIndex const &index);
+
+    /**
+     * @throw std::runtime_error if the file can't be read or was not written by this version of the validator
+     */
+    LineIndex read_line_index(std::string const &path);
+
+    /**
+     * Builds a LineIndex from the bytes of the input as they are read, for instance as a sink of a TeeStreambuf:
+     * ```
+     * LineIndexBuilder builder{default_line_index_interval};
+     * tee.add_sink([&builder](char const * data, size_t size) { builder.update(data, size); });
+     * ```
+     * The offsets of the lines that are not multiple of the interval are only kept while they may still be
+     * requested with `add_line`, which is while the reader has not read past the last chunk given to `update`.
+     */
+    class LineIndexBuilder
+    {
+      public:
+        LineIndexBuilder(size_t interval);
+
+        void update(char const * data, size_t size);
+
+        /**
+         * Indexes a line that was read recently, such as the line of an error. Older lines are ignored, they can be
+         * reached from the previous entry of the index.
+         */
+        void add_line(size_t line);
+
+        LineIndex const & get_index();
+
+      private:
+        LineIndex index;
+        size_t lines;               ///< lines started so far
+        bool at_line_start;
+
+        std::vector<std::streamoff> recent_offsets;    ///< lines started in the last chunk, and the one before them
+        size_t recent_first_line;
+    };
+
+    /**
+     * Report that doesn't write anything, but adds to a LineIndexBuilder the lines with errors
+     */
+    class LineIndexReportWriter : public ReportWriter
+    {
+      public:
+        LineIndexReportWriter(LineIndexBuilder &builder) : builder(builder) { }
+
+        virtual void write_error(Error &error) override
+        {
+            builder.add_line(error.line);
+        }
+
+        virtual void write_warning(Error &error) override { }
+
+      private:
+        LineIndexBuilder &builder;
+    };
+
+    /**
+     * Writes the lines from `first_line` to `last_line` (both included) of the input, seeking to the closest entry
+     * of the index before them
+     *
+     * @return amount of lines written, less than requested if the input ends before
+     * @throw std::invalid_argument if the input is not seekable or its size is not the one in the index
+     */
+    size_t extract_lines(std::istream &input,
+                         LineIndex const &index,
+                         size_t first_line,
+                         size_t last_line,
+                         std::ostream &output);
+  }
+}
+
+#endif // VCF_LINE_INDEX_HPP
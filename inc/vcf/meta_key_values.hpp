@@ -0,0 +1,122 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_META_KEY_VALUES_HPP
+#define VCF_META_KEY_VALUES_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Key-value pairs of a meta entry, such as the ID, Number, Type and Description of an INFO line.
+     *
+     * Headers may have millions of entries (mostly contigs), so the pairs are not kept in the nodes of a std::map,
+     * which take several times the memory of the text: they are stored in a single string, as "key\0value\0" sorted
+     * by key. An entry only has a handful of keys, so scanning that string finds one as fast as a tree would.
+     *
+     * Reading works like a const std::map<std::string, std::string>, except that operator[] returns an empty value
+     * for a missing key instead of inserting it, and the iterators return the pairs by value.
+     */
+    class MetaKeyValues
+    {
+      public:
+        typedef std::pair<std::string, std::string> value_type;
+
+        class const_iterator
+        {
+          public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef MetaKeyValues::value_type value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef value_type const * pointer;
+            typedef value_type reference;
+
+            explicit const_iterator(char const * position) : position{position} { }
+
+            value_type operator*() const;
+            const_iterator & operator++();
+            const_iterator operator++(int);
+
+            bool operator==(const_iterator const & other) const { return position == other.position; }
+            bool operator!=(const_iterator const & other) const { return position != other.position; }
+
+          private:
+            char const * position;
+        };
+
+        MetaKeyValues() = default;
+        MetaKeyValues(std::initializer_list<value_type> key_values);
+        MetaKeyValues(std::map<std::string, std::string> const & key_values);
+
+        /**
+         * Adds a pair, or replaces the value if the key is already there
+         */
+        void set(std::string const & key, std::string const & value);
+
+        size_t count(std::string const & key) const;
+
+        /**
+         * @return the value of the key, or an empty string if it isn't there
+         */
+        std::string operator[](std::string const & key) const;
+
+        /**
+         * @throw std::out_of_range if the key isn't there
+         */
+        std::string at(std::string const & key) const;
+
+        /**
+         * Checks whether the key is there with this value, without copying it out
+         */
+        bool has_value(std::string const & key, std::string const & value) const;
+
+        size_t size() const;
+        bool empty() const { return text.empty(); }
+
+        const_iterator begin() const { return const_iterator{text.data()}; }
+        const_iterator end() const { return const_iterator{text.data() + text.size()}; }
+
+        /**
+         * Approximate memory allocated for the pairs, besides the object itself
+         */
+        size_t memory() const;
+
+        bool operator==(MetaKeyValues const & other) const { return text == other.text; }
+        bool operator!=(MetaKeyValues const & other) const { return text != other.text; }
+
+      private:
+        std::string text;
+
+        /**
+         * @return the start of the value of the key, or nullptr if it isn't there
+         */
+        char const * find_value(std::string const & key) const;
+    };
+
+    std::ostream & operator<<(std::ostream & os, MetaKeyValues const & key_values);
+  }
+}
+
+#endif // VCF_META_KEY_VALUES_HPP
@@ -17,6 +17,7 @@
 #define VCF_NORMALIZER_HPP
 
 #include "file_structure.hpp"
+#include "reference_fasta.hpp"
 
 namespace ebi
 {
@@ -65,9 +66,20 @@ namespace ebi
      * These actions are performed trimming the trailing context first, and then the leading context. 
      * This is NOT compliant with the VCF specification. See `normalize_right_alignment` for more information.
      * 
-     * Please note that this is a naive normalization, the best we can do without the FASTA file.
+     * Please note that this is a naive normalization, the best we can do without the FASTA file. With the FASTA
+     * file, see `normalize_left_alignment`.
      */
     std::vector<RecordCore> normalize(const Record &record/* , ParsingState?*/);
+
+    /**
+     * Normalizes a record as `normalize` does, and then shifts every insertion and deletion to the leftmost position
+     * where the reference sequence gives the same result, e.g. deleting any of the bases of a repeat. This way the
+     * duplicates are found even if the files align the indels differently.
+     *
+     * The indels in contigs that are not in the reference, or whose bases are not only A, C, G, T and N, are kept as
+     * `normalize` leaves them.
+     */
+    std::vector<RecordCore> normalize_left_alignment(const Record &record, const ReferenceFasta &reference);
     
     /**
      * This differs from the regular normalize, in that this is more VCF specification-compliant.
@@ -39,11 +39,12 @@ namespace ebi
 
         OdbReportRW(const std::string &db_name);
         virtual ~OdbReportRW();
-        void flush();   // before reading, make sure you destroy or flush the writer OdbReportRW
+        virtual void flush() override;   // before reading, make sure you destroy or flush the writer OdbReportRW
 
         // ReportWriter implementation
         virtual void write_error(Error &error) override;
         virtual void write_warning(Error &error) override;
+        virtual void write_batch(std::vector<std::unique_ptr<Error>> const &errors, Severity severity) override;
 
         // ReportReader implementation
         virtual size_t count_warnings() override;
@@ -59,6 +60,8 @@ namespace ebi
         const size_t transaction_size;
 
         void write(Error &error);
+        void start_writing();
+        void finish_writing(size_t written);
         void for_each(std::function<void(std::shared_ptr<Error>)> user_function, odb::query<Error> query);
         size_t count(odb::query<ErrorCount> query);
     };
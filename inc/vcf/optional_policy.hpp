@@ -17,9 +17,14 @@
 #ifndef VCF_OPTIONAL_POLICY_HPP
 #define VCF_OPTIONAL_POLICY_HPP
 
+#include <set>
+#include <string>
+
+#include "cross_record_checker.hpp"
 #include "file_structure.hpp"
 #include "parsing_state.hpp"
 #include "record.hpp"
+#include "record_block.hpp"
 #include "error.hpp"
 
 namespace ebi
@@ -34,8 +39,15 @@ namespace ebi
     {
       public:
         void optional_check_meta_section(ParsingState const & state) const {}
-        void optional_check_body_entry(ParsingState & state, Record & record) {}
-        void optional_check_body_section(ParsingState const & state) const {}
+        std::vector<std::unique_ptr<Error>> optional_check_body_entry(ParsingState & state, Record & record) { return {}; }
+        void optional_check_body_block(ParsingState & state, RecordBlock const & block) {}
+        std::vector<std::unique_ptr<Error>> optional_check_body_entry(ParsingState & state, RecordBlock const & block, size_t index) { return {}; }
+        std::vector<std::unique_ptr<Error>> optional_check_body_records(Record const & record) { return {}; }
+        void optional_clear_body_records() {}
+        std::vector<std::unique_ptr<Error>> optional_check_body_section(ParsingState const & state) { return {}; }
+
+        void write_state(std::ostream & output, size_t first_line = 0) const {}
+        void read_state(std::istream & input, size_t first_line = 0) {}
     };
     
     /**
@@ -45,10 +57,73 @@ namespace ebi
     {
       public:
         void optional_check_meta_section(ParsingState const & state) const;
-        void optional_check_body_entry(ParsingState & state, Record const & record) ;//const;
-        void optional_check_body_section(ParsingState const & state) const;
+        /**
+         * Checks the rules of a single record, throwing the first warning found
+         *
+         * @return the warnings found when all of them are collected, as then every check runs
+         */
+        std::vector<std::unique_ptr<Error>> optional_check_body_entry(ParsingState & state, Record const & record) ;//const;
+
+        /**
+         * Looks up the positions and the contigs of a block of records at once (see Source::record_blocks), before
+         * `optional_check_body_entry` checks each record of the block
+         */
+        void optional_check_body_block(ParsingState & state, RecordBlock const & block);
+
+        /**
+         * Checks the rules of the record at `index` in the block passed to `optional_check_body_block`, like the
+         * overload for a single record
+         */
+        std::vector<std::unique_ptr<Error>> optional_check_body_entry(ParsingState & state, RecordBlock const & block,
+                                                                      size_t index);
+
+        /**
+         * Checks the rules that involve the previous records, see CrossRecordChecker
+         *
+         * @return the warnings found, as several of them may be found at once
+         */
+        std::vector<std::unique_ptr<Error>> optional_check_body_records(Record const & record);
+
+        /**
+         * Forgets the previous records, when the next record doesn't follow them in the input
+         */
+        void optional_clear_body_records();
+
+        /**
+         * Checks the rules that were still waiting for the next records when the input ended
+         *
+         * @return the warnings found
+         */
+        std::vector<std::unique_ptr<Error>> optional_check_body_section(ParsingState const & state);
+
+        /**
+         * Writes the rules between records still waiting for the next records, to continue after a restart. The
+         * lines are relative to `first_line`, see CrossRecordChecker::write_state.
+         */
+        void write_state(std::ostream & output, size_t first_line = 0) const;
+        void read_state(std::istream & input, size_t first_line = 0);
 
       private:
+        CrossRecordChecker cross_record_checker;
+
+        /**
+         * Contigs already looked up in the reference sequence, so that a missing one is reported only once
+         */
+        std::set<std::string> reference_checked_contigs;
+
+        /**
+         * Whether each record of the block passed to `optional_check_body_block` is at position zero, and whether each
+         * contig of the block is described in the meta section
+         */
+        std::vector<bool> block_positions_zero;
+        std::vector<bool> block_contigs_described;
+
+        /**
+         * Checks the rules of a single record, which is the record at `index` of `block` if it is not null
+         */
+        std::vector<std::unique_ptr<Error>> check_body_entry(ParsingState & state, Record const & record,
+                                                             RecordBlock const * block, size_t index);
+
         void check_body_entry_ploidy(ParsingState & state, Record const & record);
         void check_body_entry_position_zero(ParsingState & state, Record const & record) const;
         void check_body_entry_id_commas(ParsingState & state, Record const & record) const;
@@ -62,6 +137,8 @@ namespace ebi
         void check_body_entry_info_svlen(ParsingState & state, Record const & record) const;
         void check_body_entry_info_confidence_interval(ParsingState & state, Record const & record) const;
         void check_contig_meta(ParsingState & state, Record const & record) const;
+        bool is_contig_described(ParsingState & state, std::string const & contig) const;
+        void check_contig_reference(ParsingState & state, Record const & record);
         void check_alternate_allele_meta(ParsingState & state, Record const & record) const;
         void check_filter_meta(ParsingState & state, Record const & record) const;
         void check_info_meta(ParsingState & state, Record const & record) const;
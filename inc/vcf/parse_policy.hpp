@@ -23,6 +23,7 @@
 
 #include "parsing_state.hpp"
 #include "file_structure.hpp"
+#include "record_block.hpp"
 #include "util/string_utils.hpp"
 #include "error.hpp"
 
@@ -53,11 +54,20 @@ namespace ebi
         void handle_header_line(ParsingState const & state) {}
         
         void handle_column_end(ParsingState const & state, size_t n_columns) {}
-        void handle_body_line(ParsingState & state) {}
+        std::vector<std::unique_ptr<Error>> handle_body_line(ParsingState & state) { return {}; }
+        std::vector<std::unique_ptr<Error>> handle_body_block(ParsingState & state, RecordBlock const & block) { return {}; }
         
         std::string current_token() const { return ""; }
         
         std::vector<std::string> column_tokens(std::string const & column) const { return {}; }
+
+        /**
+         * No record is built from a body line, so a well-formed one doesn't need to be parsed
+         */
+        bool skips_well_formed_body_lines() const { return true; }
+
+        void write_state(std::ostream & output) const {}
+        void read_state(std::istream & input) {}
     };
 
     /**
@@ -66,6 +76,7 @@ namespace ebi
     class StoreParsePolicy
     {
       public:
+        ~StoreParsePolicy();
 
         void handle_token_begin(ParsingState const & state);
         void handle_token_char(ParsingState const & state, char c);
@@ -84,20 +95,64 @@ namespace ebi
         void handle_header_line(ParsingState & state);
         
         void handle_column_end(ParsingState const & state, size_t n_columns);
-        void handle_body_line(ParsingState & state);
+        /**
+         * Builds the record of a body line, throwing the first error found. If the records are checked by blocks (see
+         * Source::record_blocks), the record is added to `ParsingState::record_block` instead of being checked
+         * for sorting right away.
+         *
+         * @return the errors found when all of them are collected, in which case the record is discarded
+         */
+        std::vector<std::unique_ptr<Error>> handle_body_line(ParsingState & state);
+
+        /**
+         * Checks the sorting of a block of records built by `handle_body_line`, in order. A record with an error is
+         * discarded, as if `handle_body_line` had thrown it.
+         *
+         * @return the errors found, at most one per record and in the order of the records
+         */
+        std::vector<std::unique_ptr<Error>> handle_body_block(ParsingState & state, RecordBlock const & block);
         
         std::string current_token() const;
         
         std::vector<std::string> column_tokens(std::string const & column) const;
 
+        /**
+         * Every body line is parsed, to build its record
+         */
+        bool skips_well_formed_body_lines() const { return false; }
+
+        /**
+         * Writes the state of the sortedness checks, which is kept across lines
+         */
+        void write_state(std::ostream & output) const;
+        void read_state(std::istream & input);
+
       private:
 
-        void check_sorted(ParsingState &state, size_t position);
+        /**
+         * Checks that the contig of a record is contiguous and its position sorted, throwing the error of its line
+         */
+        void check_sorted(std::string const & contig, size_t position, size_t line);
+
+        /**
+         * Checks that a position is not lower than the previous one of the same contig
+         */
+        void check_sorted_position(std::string const & contig, size_t position, size_t line);
+
+        /**
+         * Reserves in util::memory_budget() the memory of a new entry of `finished_contigs`
+         */
+        bool reserve_contig(std::string const & contig);
 
         /**
          * Token being currently parsed
          */
         std::string m_current_token;
+
+        /**
+         * Whether the token being currently parsed belongs to a sample that is not validated
+         */
+        bool m_skip_token = false;
         
         /**
          * Token that acts as type ID for the whole line, like ALT/FILTER in meta entries
@@ -135,7 +190,12 @@ namespace ebi
         /**
          * Position previously read within a contig.
          */
-        size_t previous_position;
+        size_t previous_position = 0;
+
+        /**
+         * Memory of `finished_contigs`, reserved in util::memory_budget()
+         */
+        size_t contigs_memory = 0;
     };
       
   }
@@ -17,14 +17,17 @@
 #ifndef VCF_PARSING_STATE_HPP
 #define VCF_PARSING_STATE_HPP
 
+#include <iostream>
 #include <map>
 #include <memory>
+#include <set>
 #include <stdexcept>
 #include <string>
 #include <vector>
 #include "file_structure.hpp"
 #include "error.hpp"
 #include "normalizer.hpp"
+#include "record_block.hpp"
 
 namespace ebi
 {
@@ -45,14 +48,28 @@ namespace ebi
         std::vector<std::unique_ptr<Error>> errors;
         std::vector<std::unique_ptr<Error>> warnings;
 
-        std::multimap<std::string, std::string> defined_metadata;
+        /**
+         * Records still waiting for the checks of their block, if Source::record_blocks is set
+         */
+        RecordBlock record_block;
+
+        /**
+         * IDs found described in the meta section, by meta type. Every record looks up its contig, filters, INFO and
+         * FORMAT fields, so they are sorted instead of searched one by one.
+         */
+        std::map<std::string, std::set<std::string>> defined_metadata;
+
+        /**
+         * Memory of the meta entries and `defined_metadata`, reserved in util::memory_budget()
+         */
+        size_t meta_memory;
 
         ParsingState(std::shared_ptr<Source> source);
-        virtual ~ParsingState() = default;
+        virtual ~ParsingState();
 
         void set_version(Version version);
         
-        void add_meta(MetaEntry const & meta);
+        void add_meta(MetaEntry meta);
 
         void set_record(std::unique_ptr<Record> record);
         void add_error(std::unique_ptr<Error> error);
@@ -61,11 +78,25 @@ namespace ebi
         
         std::vector<std::string> const & samples() const;
         
-        void set_samples(std::vector<std::string> & samples);
+        void set_samples(std::vector<std::string> samples);
         
         bool is_well_defined_meta(std::string const & meta_type, std::string const & id) const;
         
         void add_well_defined_meta(std::string const & meta_type, std::string const & id);
+
+        /**
+         * Writes the position of the parser and what it learned from the meta and header sections. The position is a
+         * state of the machine of `grammar`, so the grammar is written too.
+         */
+        void write_state(std::ostream & output, std::string const & grammar) const;
+
+        /**
+         * Restores a state written by `write_state`. Nothing is modified unless the whole state is read correctly.
+         *
+         * @throw std::runtime_error if the input is truncated, was not written by `write_state` or was written by a
+         * parser with another grammar
+         */
+        void read_state(std::istream & input, std::string const & grammar);
     };
   }
 }
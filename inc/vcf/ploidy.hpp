@@ -17,7 +17,8 @@
 #ifndef VCF_VALIDATOR_PLOIDY_HPP
 #define VCF_VALIDATOR_PLOIDY_HPP
 
-#include<map>
+#include <map>
+#include <string>
 
 namespace ebi
 {
@@ -65,6 +66,14 @@ namespace ebi
         size_t default_ploidy;
         std::map<std::string, size_t> contig_ploidies;
     };
+
+    /**
+     * Builds a Ploidy from the default ploidy and a comma-separated list of CHROM=PLOIDY pairs, such as
+     * "Y=1,MyTriploidContig=3" (can be empty)
+     *
+     * @throw std::invalid_argument if a ploidy is not a number strictly greater than 0, or a pair is malformed
+     */
+    Ploidy parse_ploidy(long default_ploidy, std::string const &special_ploidies);
   }
 }
 
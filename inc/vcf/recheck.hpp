@@ -0,0 +1,96 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_RECHECK_HPP
+#define VCF_RECHECK_HPP
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "vcf/validator.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Lines validated before and after each fixed range. It matches the default capacity of RecordCache, so that
+     * the duplicates check sees the same neighbours as in a complete validation of a sorted file.
+     */
+    size_t const default_recheck_context_lines = 1000;
+
+    /**
+     * Consecutive lines of the input that the debugulator changed or removed, located in its output
+     */
+    struct FixedRange
+    {
+        enum class Kind { changed, removed };
+
+        Kind kind;
+        size_t output_line;             ///< first changed line, or the line that follows the removed ones
+        std::streamoff output_offset;   ///< byte where `output_line` starts
+        size_t output_lines;            ///< changed lines written, 0 if they were removed
+        size_t input_line;              ///< first line of the range in the input of the debugulator
+        size_t input_lines;
+        size_t context_line;            ///< first line to validate again, some lines before `output_line`
+        std::streamoff context_offset;  ///< byte where `context_line` starts
+    };
+
+    /**
+     * Description of the lines modified by the debugulator, to validate again only those lines and their neighbours
+     */
+    struct FixManifest
+    {
+        std::streamoff output_size;     ///< to detect that the manifest doesn't belong to a file
+        size_t context_lines;
+        std::vector<FixedRange> ranges;
+    };
+
+    /**
+     * Writes the manifest as text, with one tab-separated range per line
+     */
+    void write_fix_manifest(std::ostream &output, FixManifest const &manifest);
+
+    /**
+     * @throw std::runtime_error if the input is not a manifest written by `write_fix_manifest`
+     */
+    FixManifest read_fix_manifest(std::istream &input);
+
+    /**
+     * Validation of a file fixed by the debugulator, reading only the lines around the ranges of the manifest: the
+     * meta and header sections are validated completely (or restored from the header cache), then each fixed range
+     * is validated together with `manifest.context_lines` lines before and after it, so that the sorting and
+     * duplicates checks see its neighbours. Line numbers in the reported errors are the ones of the whole file.
+     *
+     * If the meta or header sections were changed, the definitions used by every record may be different, so the
+     * whole body is validated.
+     *
+     * @return whether no errors were found in the validated lines
+     * @throw std::invalid_argument if the input is not seekable or its size is not the one in the manifest
+     */
+    bool is_valid_vcf_file_recheck(std::istream &input,
+                                   const std::string &sourceName,
+                                   ValidationLevel validationLevel,
+                                   Ploidy ploidy,
+                                   std::vector<std::unique_ptr<ReportWriter>> &outputs,
+                                   FixManifest const &manifest,
+                                   ValidationOptions const &validationOptions = ValidationOptions{});
+  }
+}
+
+#endif // VCF_RECHECK_HPP
@@ -0,0 +1,69 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_RECORD_BLOCK_HPP
+#define VCF_RECORD_BLOCK_HPP
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "vcf/file_structure.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Records of consecutive lines, with the fields checked by blocks stored as one array per field, so that those
+     * checks are a loop over contiguous values instead of a visit to every Record. The records themselves are kept for
+     * the rest of their checks, which run after the checks of the block and in the same order as without blocks.
+     *
+     * The contigs are interned in each block: consecutive records of the same contig have the same id, and only a
+     * change of id needs to look at the names.
+     */
+    struct RecordBlock
+    {
+        static size_t const default_capacity = 1024;
+
+        std::vector<std::unique_ptr<Record>> records;
+        std::vector<size_t> lines;
+        std::vector<size_t> positions;
+        std::vector<size_t> contig_ids;         ///< index of the contig of each record in `contig_names`
+        std::vector<std::string> contig_names;
+
+        RecordBlock(size_t capacity = default_capacity);
+
+        void add(std::unique_ptr<Record> record);
+
+        /**
+         * Forgets the records and the contigs, to start the next block
+         */
+        void clear();
+
+        size_t size() const { return lines.size(); }
+        bool empty() const { return lines.empty(); }
+        bool full() const { return lines.size() >= capacity; }
+
+      private:
+        size_t capacity;
+        std::unordered_map<std::string, size_t> contig_ids_by_name;
+    };
+  }
+}
+
+#endif // VCF_RECORD_BLOCK_HPP
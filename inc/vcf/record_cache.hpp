@@ -20,6 +20,8 @@
 
 #include <set>
 #include <sstream>
+#include "util/memory_budget.hpp"
+#include "util/serialization.hpp"
 #include "normalizer.hpp"
 #include "file_structure.hpp"
 
@@ -33,6 +35,9 @@ namespace ebi
      *
      * To limit memory usage, this class can be configured to store only the last `n` elements. This will only detect
      * duplicates if the input is almost sorted (i.e. if no element is unsorted out of its place more than `n` elements)
+     *
+     * The memory of the elements is reserved in util::memory_budget(). If the budget is exhausted, the cache holds
+     * less elements than its capacity.
      */
     class RecordCache
     {
@@ -47,7 +52,15 @@ namespace ebi
          * @param capacity: maximum amount of RecordCores that this instance can hold at any time.
          * A value of 0 disables the limit, thus storing every RecordCore received. Use with caution.
          */
-        RecordCache(size_t capacity) : capacity{capacity}, unlimited{capacity == 0} { }
+        RecordCache(size_t capacity) : capacity{capacity}, unlimited{capacity == 0}, reserved{0}, degraded{false} { }
+
+        RecordCache(RecordCache const &) = delete;
+        RecordCache & operator=(RecordCache const &) = delete;
+
+        ~RecordCache()
+        {
+            util::memory_budget().release(reserved);
+        }
 
         /**
          * For a given Record, returns a vector of RecordCores that are duplicates.
@@ -59,10 +72,21 @@ namespace ebi
          * 
          * Nonetheless, if the capacity is too small, it may cause incorrect reporting, such as reporting several times
          * the first occurrence or failing to report duplicates that are farther apart than the capacity.
+         *
+         * If the source of the record has a reference sequence, the indels are left-aligned with it before comparing.
+         * A gVCF reference block has nothing to normalize, so it is compared as it is.
          */
         std::vector<std::unique_ptr<Error>> check_duplicates(const Record &record)
         {
-            auto record_cores = normalize(record);
+            std::vector<RecordCore> record_cores;
+            if (record.is_reference_block()) {
+                record_cores.emplace_back(record.line, record.chromosome, record.position, record.reference_allele,
+                                          record.alternate_alleles[0]);
+            } else if (record.source != nullptr && record.source->reference != nullptr) {
+                record_cores = normalize_left_alignment(record, *record.source->reference);
+            } else {
+                record_cores = normalize(record);
+            }
             std::vector<std::unique_ptr<Error>> duplicates{};
 
             for (RecordCore &record_core: record_cores) {
@@ -87,7 +111,15 @@ namespace ebi
                     duplicates.emplace_back(new DuplicationError{record_core.line, ss.str()});
                 }
 
-                cache.insert(range.second, record_core);
+                size_t size_before_reserve = cache.size();
+                if (reserve(record_core)) {
+                    if (cache.size() == size_before_reserve) {
+                        cache.insert(range.second, record_core);
+                    } else {
+                        // the elements removed to make room may include the hint
+                        cache.insert(record_core);
+                    }
+                }
             }
 
             shrink_to_fit();
@@ -99,14 +131,49 @@ namespace ebi
          */
         void shrink_to_fit()
         {
-            if (not unlimited) {
-                size_t count = cache.size();
-                if (count > capacity) {
-                    auto erase_until = cache.begin();
-                    for (size_t j = 0; j < count - capacity; ++j) {
-                        erase_until++;
-                    }
-                    cache.erase(cache.begin(), erase_until);
+            if (not unlimited && cache.size() > capacity) {
+                erase_first(cache.size() - capacity);
+            }
+        }
+
+        /**
+         * Forgets every element, e.g. to check the duplicates of an unrelated part of the input
+         */
+        void clear()
+        {
+            erase_first(cache.size());
+        }
+
+        /**
+         * Writes the records in the cache, to continue checking duplicates after a restart
+         */
+        void write_state(std::ostream &output) const
+        {
+            util::write_size(output, cache.size());
+            for (auto &record_core : cache) {
+                util::write_size(output, record_core.line);
+                util::write_string(output, record_core.chromosome);
+                util::write_size(output, record_core.position);
+                util::write_string(output, record_core.reference_allele);
+                util::write_string(output, record_core.alternate_allele);
+            }
+        }
+
+        void read_state(std::istream &input)
+        {
+            std::vector<RecordCore> records;
+            for (size_t count = util::read_size(input); count > 0; --count) {
+                size_t line = util::read_size(input);
+                std::string chromosome = util::read_string(input);
+                size_t position = util::read_size(input);
+                std::string reference_allele = util::read_string(input);
+                records.emplace_back(line, chromosome, position, reference_allele, util::read_string(input));
+            }
+
+            clear();
+            for (auto &record_core : records) {
+                if (reserve(record_core)) {
+                    cache.insert(cache.end(), record_core);
                 }
             }
         }
@@ -115,6 +182,48 @@ namespace ebi
         std::multiset<RecordCore> cache;
         size_t capacity;    ///< max amount of RecorCores that the cache can hold
         bool unlimited; ///< if true, the set is not capped and will not erase any RecordCore
+        size_t reserved;    ///< memory of the elements in the cache, reserved in util::memory_budget()
+        bool degraded;      ///< whether the memory budget has already made the cache forget some elements
+
+        static size_t memory(RecordCore const &record_core)
+        {
+            return util::tree_node_overhead + sizeof(RecordCore) + util::heap_size(record_core.chromosome)
+                   + util::heap_size(record_core.reference_allele) + util::heap_size(record_core.alternate_allele);
+        }
+
+        /**
+         * Reserves the memory of a new element, forgetting the first elements of the cache while the budget is
+         * exhausted
+         *
+         * @return false if there is no memory for the new element even with an empty cache
+         */
+        bool reserve(RecordCore const &record_core)
+        {
+            size_t bytes = memory(record_core);
+            while (not util::memory_budget().reserve(bytes)) {
+                if (not degraded) {
+                    degraded = true;
+                    util::memory_budget().add_note("The memory limit was reached, so duplicated variants were only "
+                                                   "searched among fewer records than usual");
+                }
+                if (cache.empty()) {
+                    return false;
+                }
+                erase_first(1);
+            }
+            reserved += bytes;
+            return true;
+        }
+
+        void erase_first(size_t count)
+        {
+            for (; count > 0; --count) {
+                size_t bytes = memory(*cache.begin());
+                cache.erase(cache.begin());
+                util::memory_budget().release(bytes);
+                reserved -= bytes;
+            }
+        }
     };
   }
 }
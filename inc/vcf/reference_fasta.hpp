@@ -0,0 +1,91 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_REFERENCE_FASTA_HPP
+#define VCF_REFERENCE_FASTA_HPP
+
+#include <string>
+#include <unordered_map>
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Sequence of an assembly, read from an uncompressed FASTA file and its index (the .fai file written by
+     * `samtools faidx`).
+     *
+     * The FASTA file is mapped in memory instead of loaded, so opening even a 3 Gb genome is immediate, and only the
+     * pages around the positions of the records are read from disk. The operating system keeps those pages, so the
+     * lookups of a sorted VCF mostly hit pages already read.
+     */
+    class ReferenceFasta
+    {
+      public:
+        /**
+         * Location of a contig in the FASTA file, as described in the index
+         */
+        struct Contig
+        {
+            size_t length;      ///< amount of bases
+            size_t offset;      ///< byte of the first base
+            size_t line_bases;  ///< bases in each full line
+            size_t line_width;  ///< bytes of each full line, including its end of line
+        };
+
+        /**
+         * @param path: FASTA file, whose index must be in `path` + ".fai"
+         * @throw std::runtime_error if the file or its index can't be read, or they don't match
+         */
+        explicit ReferenceFasta(std::string const & path);
+        ~ReferenceFasta();
+
+        ReferenceFasta(ReferenceFasta const &) = delete;
+        ReferenceFasta & operator=(ReferenceFasta const &) = delete;
+
+        /**
+         * @return the contig with this name, or nullptr if the FASTA doesn't have it
+         */
+        Contig const * find_contig(std::string const & name) const;
+
+        /**
+         * Base at a position of a contig, in upper case
+         *
+         * @param position: 1-based, it must be within the contig
+         */
+        char base(Contig const & contig, size_t position) const;
+
+        /**
+         * Checks whether the bases starting at a position of a contig are `bases`, ignoring case. An N in `bases`,
+         * or an ambiguity code in the reference, matches any base.
+         *
+         * @param position: 1-based
+         * @return false if the bases don't match or go beyond the end of the contig
+         */
+        bool matches(Contig const & contig, size_t position, std::string const & bases) const;
+
+      private:
+        std::string path;
+        char const * data;      ///< whole FASTA file, mapped in memory
+        size_t size;
+        std::unordered_map<std::string, Contig> contigs;
+
+        void read_index(std::string const & index_path);
+    };
+  }
+}
+
+#endif // VCF_REFERENCE_FASTA_HPP
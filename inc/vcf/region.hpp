@@ -0,0 +1,81 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_REGION_HPP
+#define VCF_REGION_HPP
+
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "vcf/validator.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Genomic region with 1-based, inclusive coordinates, as in the POS column
+     */
+    struct Region
+    {
+        std::string chromosome;
+        size_t start;
+        size_t end;
+
+        bool contains(std::string const & chromosome, size_t position) const
+        {
+            return this->chromosome == chromosome && start <= position && position <= end;
+        }
+    };
+
+    /**
+     * Parses a region written as "chr", "chr:start" or "chr:start-end". A contig name that contains ':' must be
+     * written between braces, e.g. "{HLA-A*01:01}" or "{HLA-A*01:01}:1-100".
+     *
+     * @throw std::invalid_argument if the coordinates are not numbers, start is after end, or the contig name
+     * contains ':' and is not between braces
+     */
+    Region parse_region(std::string const & region);
+
+    /**
+     * Tells whether a body line should be validated: its CHROM and POS are read without running the parser.
+     *
+     * Lines whose chromosome is requested but whose position can't be read are validated, so that the error is
+     * reported.
+     */
+    bool is_in_regions(std::vector<char> const & line, std::vector<Region> const & regions);
+
+    /**
+     * Validation of the records that belong to some regions: the meta and header sections are validated
+     * completely, so the definitions of the whole header are still used, but the lines of other regions are only
+     * counted. Checks that span several records (such as duplicates) only see the records in the regions.
+     *
+     * @return whether no errors were found in the header and the records of the regions
+     */
+    bool is_valid_vcf_file_regions(std::istream &input,
+                                   const std::string &sourceName,
+                                   ValidationLevel validationLevel,
+                                   Ploidy ploidy,
+                                   std::vector<std::unique_ptr<ReportWriter>> &outputs,
+                                   std::vector<Region> const &regions,
+                                   ValidationOptions const &validationOptions = ValidationOptions{});
+  }
+}
+
+#endif // VCF_REGION_HPP
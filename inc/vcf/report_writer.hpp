@@ -17,29 +17,133 @@
 #ifndef VCF_REPORT_WRITER_HPP
 #define VCF_REPORT_WRITER_HPP
 
+#include <chrono>
 #include <fstream>
+#include <memory>
 #include <string>
 #include <stdexcept>
+#include <vector>
 
+#include "util/logger.hpp"
 #include "vcf/error.hpp"
 
 namespace ebi
 {
   namespace vcf
   {
+    /**
+     * Size of the output buffer of the reports written into files. They are flushed when the buffer is full, when
+     * `flush` is called (see ReportFlusher) and when they are closed, instead of after every line.
+     */
+    size_t const default_report_buffer_size = 1024 * 1024;
+
+    /**
+     * Maximum time that the errors found may wait in the buffers of the reports while the validation goes on
+     */
+    std::chrono::milliseconds const default_report_flush_interval{2000};
+
     class ReportWriter
     {
         public:
             virtual ~ReportWriter() {}  // needed if using raw pointers, instead of references or shared_ptrs in children
             virtual void write_error(Error &error) = 0;
             virtual void write_warning(Error &error) = 0;
+
+            /**
+             * Writes several errors (or warnings) at once, such as all the ones found in a line. Writers with a cost
+             * for each write (a system call, a database statement) may override it to pay it once for the whole
+             * batch; by default each error is forwarded to `write_error` or `write_warning`.
+             */
+            virtual void write_batch(std::vector<std::unique_ptr<Error>> const &errors, Severity severity)
+            {
+                for (auto &error : errors) {
+                    if (severity == Severity::ERROR) {
+                        write_error(*error);
+                    } else {
+                        write_warning(*error);
+                    }
+                }
+            }
+
+            /**
+             * Makes everything written so far visible to the readers of the report
+             */
+            virtual void flush() {}
+
+            /**
+             * Information about the run that is not an error, such as the checksums of the input. Writers that can
+             * only store errors may ignore it.
+             */
+            virtual void write_message(std::string const &message) {}
+
+            /**
+             * Writes what is needed to continue this report after resuming a validation from a checkpoint
+             *
+             * @throw std::runtime_error if this kind of report can't be continued
+             */
+            virtual void save(std::ostream &output)
+            {
+                throw std::runtime_error{"This type of report can't be continued from a checkpoint"};
+            }
+    };
+
+    inline void flush_reports(std::vector<std::unique_ptr<ReportWriter>> const &outputs)
+    {
+        for (auto &output : outputs) {
+            output->flush();
+        }
+    }
+
+    /**
+     * Logs a message about the run and writes it to every report
+     */
+    inline void write_message(std::string const &message, std::vector<std::unique_ptr<ReportWriter>> const &outputs)
+    {
+        BOOST_LOG_TRIVIAL(info) << message;
+        for (auto &output : outputs) {
+            output->write_message(message);
+        }
+    }
+
+    /**
+     * Flushes the reports periodically from a validation loop, so that whoever reads them while a long validation
+     * goes on sees the errors found so far. The clock is only checked once every `check_lines` lines.
+     */
+    class ReportFlusher
+    {
+        public:
+            ReportFlusher(std::chrono::milliseconds interval = default_report_flush_interval,
+                          size_t check_lines = 1024)
+                    : interval{interval}, check_lines{check_lines}, lines{0},
+                      last_flush{std::chrono::steady_clock::now()}
+            { }
+
+            void line_validated(std::vector<std::unique_ptr<ReportWriter>> const &outputs)
+            {
+                if (++lines < check_lines) {
+                    return;
+                }
+                lines = 0;
+                auto now = std::chrono::steady_clock::now();
+                if (now - last_flush >= interval) {
+                    flush_reports(outputs);
+                    last_flush = now;
+                }
+            }
+
+        private:
+            std::chrono::milliseconds interval;
+            size_t check_lines;
+            size_t lines;
+            std::chrono::steady_clock::time_point last_flush;
     };
 
     class FileReportWriter : public ReportWriter
     {
         public:
-            FileReportWriter(std::string filename)
+            FileReportWriter(std::string filename) : buffer(default_report_buffer_size)
             {
+                file.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
                 file.open(filename, std::ios::out);
             }
 
@@ -50,15 +154,26 @@ namespace ebi
 
             virtual void write_error(Error &error) override
             {
-                file << error.what() << std::endl;
+                file << error.what() << '\n';
             }
 
             virtual void write_warning(Error &error) override
             {
-                file << error.what() << " (warning)" << std::endl;
+                file << error.what() << " (warning)\n";
+            }
+
+            virtual void write_message(std::string const &message) override
+            {
+                file << message << '\n';
+            }
+
+            virtual void flush() override
+            {
+                file.flush();
             }
 
         private:
+            std::vector<char> buffer;   // declared before the file, which uses it until it is closed
             std::ofstream file;
     };
   }
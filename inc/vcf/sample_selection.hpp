@@ -0,0 +1,71 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_VALIDATOR_SAMPLE_SELECTION_HPP
+#define VCF_VALIDATOR_SAMPLE_SELECTION_HPP
+
+#include <set>
+#include <string>
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Class that tells which samples have their columns validated in the body section.
+     *
+     * The columns of the samples left out are still counted and their syntax is checked by the parser, but they are
+     * neither stored nor checked against the meta section, which is most of the work in files with many samples.
+     *
+     * To validate all the samples:
+     *  SampleSelection{}
+     *
+     * To validate only the site columns (CHROM to FORMAT):
+     *  SampleSelection{std::set<std::string>{}}
+     *
+     * To validate only some samples:
+     *  SampleSelection{{"NA001", "NA002"}}
+     */
+    class SampleSelection
+    {
+      public:
+        SampleSelection() : all{true}, names{} {}
+
+        explicit SampleSelection(std::set<std::string> const & names) : all{false}, names(names) {}
+
+        bool is_everything_selected() const
+        {
+            return all;
+        }
+
+        bool is_selected(std::string const & name) const
+        {
+            return all || names.count(name) > 0;
+        }
+
+        std::set<std::string> const & selected_names() const
+        {
+            return names;
+        }
+
+      private:
+        bool all;
+        std::set<std::string> names;
+    };
+  }
+}
+
+#endif //VCF_VALIDATOR_SAMPLE_SELECTION_HPP
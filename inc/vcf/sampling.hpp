@@ -0,0 +1,80 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_SAMPLING_HPP
+#define VCF_SAMPLING_HPP
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "vcf/validator.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    size_t const default_sample_window_size = 1000;
+
+    struct SamplingOptions
+    {
+        size_t windows;             ///< amount of evenly spaced windows to validate along the body
+        size_t records_per_window;  ///< amount of consecutive records validated in each window
+    };
+
+    /**
+     * Estimated proportion of records affected by a class of Error, with a 95% confidence interval
+     */
+    struct ErrorRateEstimate
+    {
+        std::string error_class;
+        size_t affected_records;
+        double rate;
+        double lower_bound;
+        double upper_bound;
+    };
+
+    /**
+     * Wilson score interval for `affected` out of `total` records, which unlike the normal approximation behaves well
+     * with rates close to 0, the usual case for errors.
+     */
+    ErrorRateEstimate estimate_error_rate(std::string const &error_class, size_t affected, size_t total);
+
+    /**
+     * Quick validation of a seekable input: the meta and header sections are validated completely, but only a few
+     * windows of records are validated from the body.
+     *
+     * Each window starts at the first line after an evenly spaced byte offset. Checks that span several records
+     * (such as duplicates) are limited to the records of each window. Line numbers in the reported errors count only
+     * the lines actually read; the byte offset where each window starts is written to the outputs as a message, so the
+     * errors can only be located with the reports that keep the messages next to them (vcf_validator only allows text
+     * reports with --sample).
+     *
+     * @return whether no errors were found in the sampled records, as `is_valid_vcf_file` would
+     * @throw std::invalid_argument if the input is not seekable
+     */
+    bool is_valid_vcf_file_sample(std::istream &input,
+                                  const std::string &sourceName,
+                                  ValidationLevel validationLevel,
+                                  Ploidy ploidy,
+                                  std::vector<std::unique_ptr<ReportWriter>> &outputs,
+                                  SamplingOptions const &options,
+                                  ValidationOptions const &validationOptions = ValidationOptions{});
+  }
+}
+
+#endif // VCF_SAMPLING_HPP
@@ -36,16 +36,48 @@ namespace ebi
     const char ERROR[] = "error";
     const char ERRORS[] = "errors";
     const char STOP[] = "stop";
+    const char COUNT[] = "count";
     const char HELP[] = "help";
     const char LEVEL[] = "level";
     const char PLOIDY[] = "ploidy";
     const char SPECIAL_PLOIDY[] = "special-ploidy";
     const char DATABASE[] = "database";
     const char TEXT[] = "text";
+    const char JSON[] = "json";
+    const char BINARY[] = "binary";
     const char INPUT[] = "input";
     const char OUTPUT[] = "output";
     const char OUTDIR[] = "outdir";
     const char REPORT[] = "report";
+    const char PASSTHROUGH[] = "passthrough";
+    const char CHECKSUM[] = "checksum";
+    const char SAMPLE_WINDOWS[] = "sample";
+    const char SAMPLE_WINDOW_SIZE[] = "sample-window-size";
+    const char REGION[] = "region";
+    const char SITES_ONLY[] = "sites-only";
+    const char SAMPLES_SELECTION[] = "samples";
+    const char HEADER_CACHE[] = "header-cache";
+    const char CHECKPOINT[] = "checkpoint";
+    const char CHECKPOINT_INTERVAL[] = "checkpoint-interval";
+    const char RESUME[] = "resume";
+    const char FOLLOW[] = "follow";
+    const char FOLLOW_DONE[] = "follow-done";
+    const char FOLLOW_PID[] = "follow-pid";
+    const char SOCKET[] = "socket";
+    const char COLLECT_ALL_ERRORS[] = "collect-all-errors";
+    const char THREADS[] = "threads";
+    const char MANIFEST[] = "manifest";
+    const char RECHECK[] = "recheck";
+    const char BLOCK_MANIFEST[] = "block-manifest";
+    const char PREVIOUS_MANIFEST[] = "previous-manifest";
+    const char LINE_INDEX[] = "line-index";
+    const char LINE_INDEX_INTERVAL[] = "line-index-interval";
+    const char LINES[] = "lines";
+    const char MAX_ERRORS[] = "max-errors";
+    const char MAX_ERRORS_PER_TYPE[] = "max-errors-per-type";
+    const char MEMORY_LIMIT[] = "memory-limit";
+    const char REFERENCE_FASTA[] = "reference";
+    const char RECORD_BLOCKS[] = "record-blocks";
     const char HELP_OPTION[] = "help,h";
     const char INPUT_OPTION[] = "input,i";
     const char ERRORS_OPTION[] = "errors,e";
@@ -55,6 +87,35 @@ namespace ebi
     const char PLOIDY_OPTION[] = "ploidy,p";
     const char SPECIAL_PLOIDY_OPTION[] = "special-ploidy,s";
     const char OUTPUT_OPTION[] = "output,o";
+    const char PASSTHROUGH_OPTION[] = "passthrough";
+    const char CHECKSUM_OPTION[] = "checksum";
+    const char SAMPLE_WINDOWS_OPTION[] = "sample";
+    const char SAMPLE_WINDOW_SIZE_OPTION[] = "sample-window-size";
+    const char REGION_OPTION[] = "region";
+    const char SITES_ONLY_OPTION[] = "sites-only";
+    const char SAMPLES_SELECTION_OPTION[] = "samples";
+    const char HEADER_CACHE_OPTION[] = "header-cache";
+    const char CHECKPOINT_OPTION[] = "checkpoint";
+    const char CHECKPOINT_INTERVAL_OPTION[] = "checkpoint-interval";
+    const char RESUME_OPTION[] = "resume";
+    const char FOLLOW_OPTION[] = "follow";
+    const char FOLLOW_DONE_OPTION[] = "follow-done";
+    const char FOLLOW_PID_OPTION[] = "follow-pid";
+    const char SOCKET_OPTION[] = "socket";
+    const char COLLECT_ALL_ERRORS_OPTION[] = "collect-all-errors";
+    const char THREADS_OPTION[] = "threads,t";
+    const char MANIFEST_OPTION[] = "manifest";
+    const char RECHECK_OPTION[] = "recheck";
+    const char BLOCK_MANIFEST_OPTION[] = "block-manifest";
+    const char PREVIOUS_MANIFEST_OPTION[] = "previous-manifest";
+    const char LINE_INDEX_OPTION[] = "line-index";
+    const char LINE_INDEX_INTERVAL_OPTION[] = "line-index-interval";
+    const char LINES_OPTION[] = "lines";
+    const char MAX_ERRORS_OPTION[] = "max-errors";
+    const char MAX_ERRORS_PER_TYPE_OPTION[] = "max-errors-per-type";
+    const char MEMORY_LIMIT_OPTION[] = "memory-limit";
+    const char REFERENCE_FASTA_OPTION[] = "reference";
+    const char RECORD_BLOCKS_OPTION[] = "record-blocks";
 
     // fields
     const std::string ID = "ID";
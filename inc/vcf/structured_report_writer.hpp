@@ -0,0 +1,104 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_STRUCTURED_REPORT_WRITER_HPP
+#define VCF_STRUCTURED_REPORT_WRITER_HPP
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "vcf/report_writer.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Fields of an error that are meaningful to other programs. The ones that the class of the error doesn't have
+     * are left empty.
+     */
+    struct ErrorFields
+    {
+        size_t code;                ///< index of the class of the error in ErrorClassifier::names()
+        std::string column;
+        std::string field;
+        std::string value;
+        std::string expected_value;
+    };
+
+    ErrorFields get_error_fields(Error &error);
+
+    /**
+     * Writes one JSON object per line for each error, warning and message, so that other programs can read the
+     * report while it is being written. For instance:
+     * ~~~
+     * {"severity":"error","code":"InfoBodyError","line":12,"message":"INFO DP=x does not match ...","field":"DP"}
+     * {"severity":"message","message":"md5 checksum of the input: ..."}
+     * ~~~
+     * The members "column", "field", "value" and "expected_value" are only present if the error has them.
+     */
+    class JsonReportWriter : public ReportWriter
+    {
+      public:
+        JsonReportWriter(std::string const &filename);
+
+        virtual void write_error(Error &error) override;
+        virtual void write_warning(Error &error) override;
+        virtual void write_message(std::string const &message) override;
+        virtual void flush() override;
+
+      private:
+        std::vector<char> buffer;   // declared before the file, which uses it until it is closed
+        std::ofstream file;
+
+        void write(Error &error, char const * severity);
+    };
+
+    /**
+     * Writes the errors, warnings and messages as length-prefixed binary records, cheaper to parse than text.
+     *
+     * The file starts with the 8 bytes "VCFRB001". Then each record is:
+     * - length of the rest of the record: 4 bytes
+     * - kind: 1 byte, 0 for errors, 1 for warnings, 2 for messages
+     * - code: 1 byte, index of the class of the error in ErrorClassifier::names() (0 for messages)
+     * - line: 8 bytes (0 for messages)
+     * - message, column, field, value and expected value: each one as 4 bytes of length followed by its bytes
+     *
+     * All the numbers are unsigned and little-endian.
+     */
+    class BinaryReportWriter : public ReportWriter
+    {
+      public:
+        BinaryReportWriter(std::string const &filename);
+
+        virtual void write_error(Error &error) override;
+        virtual void write_warning(Error &error) override;
+        virtual void write_message(std::string const &message) override;
+        virtual void flush() override;
+
+      private:
+        std::vector<char> buffer;   // declared before the file, which uses it until it is closed
+        std::ofstream file;
+        std::string record;
+
+        void write(uint8_t kind, uint8_t code, size_t line, std::string const &message, ErrorFields const &fields);
+    };
+  }
+}
+
+#endif // VCF_STRUCTURED_REPORT_WRITER_HPP
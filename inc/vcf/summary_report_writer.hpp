@@ -18,6 +18,11 @@
 #define VCF_SUMMARY_REPORT_WRITER_HPP
 
 #include <map>
+
+#include <boost/filesystem/operations.hpp>
+
+#include "util/memory_budget.hpp"
+#include "util/serialization.hpp"
 #include "report_writer.hpp"
 
 namespace ebi
@@ -39,11 +44,22 @@ namespace ebi
      *     std::cout << error.what() << " (warning)" << std::endl;
      * }
      * ~~~
+     *
+     * The memory of the errors already reported is reserved in util::memory_budget(). If the budget is exhausted,
+     * the next errors are written every time.
      */
     class SummaryTracker : public ErrorVisitor
     {
       public:
-        SummaryTracker() : already_reported{}, skip{false} {}
+        SummaryTracker() : already_reported{}, skip{false}, reserved{0}, degraded{false} {}
+
+        SummaryTracker(SummaryTracker const &) = delete;
+        SummaryTracker & operator=(SummaryTracker const &) = delete;
+
+        ~SummaryTracker()
+        {
+            util::memory_budget().release(reserved);
+        }
 
         bool should_write_report(Error &error)
         {
@@ -80,6 +96,31 @@ namespace ebi
         virtual void visit(NormalizationError &error) {}
         virtual void visit(DuplicationError &error) {}
 
+        void write_state(std::ostream &output) const
+        {
+            util::write_size(output, degraded);
+            util::write_size(output, already_reported.size());
+            for (auto &reported : already_reported) {
+                util::write_string(output, reported.first);
+                util::write_string(output, reported.second);
+            }
+        }
+
+        void read_state(std::istream &input)
+        {
+            already_reported.clear();
+            util::memory_budget().release(reserved);
+            reserved = 0;
+            degraded = false;
+            if (util::read_size(input) != 0) {
+                degrade();
+            }
+            for (size_t count = util::read_size(input); count > 0; --count) {
+                std::string meta_type = util::read_string(input);
+                add_already_reported(meta_type, util::read_string(input));
+            }
+        }
+
       private:
         bool is_already_reported(std::string const &meta_type, std::string const &id) const
         {
@@ -95,11 +136,29 @@ namespace ebi
 
         void add_already_reported(std::string const &meta_type, std::string const &id)
         {
+            size_t bytes = util::tree_node_overhead + sizeof(std::pair<std::string const, std::string>)
+                           + util::heap_size(meta_type) + util::heap_size(id);
+            if (not util::memory_budget().reserve(bytes)) {
+                degrade();
+                return;
+            }
+            reserved += bytes;
             already_reported.emplace(meta_type, id);
         }
 
+        void degrade()
+        {
+            if (not degraded) {
+                degraded = true;
+                util::memory_budget().add_note("The memory limit was reached, so some warnings about missing meta "
+                                               "definitions may be repeated in the report");
+            }
+        }
+
         std::multimap<std::string, std::string> already_reported;
         bool skip;
+        size_t reserved;    ///< memory of `already_reported`, reserved in util::memory_budget()
+        bool degraded;      ///< whether some errors were not remembered because the memory budget was exhausted
     };
 
 
@@ -110,30 +169,67 @@ namespace ebi
     class SummaryReportWriter : public ReportWriter
     {
       public:
-        SummaryReportWriter(std::string filename)
+        SummaryReportWriter(std::string filename) : filename{filename}, buffer(default_report_buffer_size)
         {
+            file.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
             file.open(filename, std::ios::out);
         }
 
+        /**
+         * Continues a report saved with `save`: the lines written after the checkpoint are removed, so the report
+         * ends up as if the validation had never been interrupted
+         */
+        SummaryReportWriter(std::istream &saved) : buffer(default_report_buffer_size)
+        {
+            filename = util::read_string(saved);
+            size_t size = util::read_size(saved);
+            summary.read_state(saved);
+
+            boost::filesystem::resize_file(filename, size);
+            file.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+            file.open(filename, std::ios::out | std::ios::app);
+        }
+
         ~SummaryReportWriter()
         {
             file.close();
         }
 
-        virtual void write_error(Error &error)
+        virtual void write_error(Error &error) override
         {
-            file << error.what() << std::endl;
+            file << error.what() << '\n';
         }
 
-        virtual void write_warning(Error &error)
+        virtual void write_warning(Error &error) override
         {
             if (summary.should_write_report(error)) {
-                file << error.what() << " (warning)" << std::endl;
+                file << error.what() << " (warning)\n";
             }
         }
 
+        virtual void write_message(std::string const &message) override
+        {
+            file << message << '\n';
+        }
+
+        virtual void flush() override
+        {
+            file.flush();
+        }
+
+        virtual void save(std::ostream &output) override
+        {
+            file.flush();
+            // the validation may be resumed from another working directory
+            util::write_string(output, boost::filesystem::absolute(filename).string());
+            util::write_size(output, static_cast<size_t>(file.tellp()));
+            summary.write_state(output);
+        }
+
       private:
+        std::string filename;
         SummaryTracker summary;
+        std::vector<char> buffer;   // declared before the file, which uses it until it is closed
         std::ofstream file;
     };
   }
@@ -32,8 +32,10 @@
 #include "parse_policy.hpp"
 #include "parsing_state.hpp"
 #include "record_cache.hpp"
+#include "util/logger.hpp"
 #include "util/string_utils.hpp"
 #include "vcf/ploidy.hpp"
+#include "vcf/sample_selection.hpp"
 #include "vcf/report_writer.hpp"
 
 
@@ -42,8 +44,28 @@ namespace ebi
   namespace vcf
   {
 
+    class HeaderCache;
+
     size_t const default_line_buffer_size = 64 * 1024;
-    enum class ValidationLevel { error, warning, stop };
+    enum class ValidationLevel { error, warning, stop, count };
+
+    /**
+     * Settings of a validation besides its level and ploidy, shared by every way of reading the input
+     */
+    struct ValidationOptions
+    {
+        SampleSelection sample_selection;                   ///< sample columns to validate
+        HeaderCache *header_cache = nullptr;                ///< previously validated headers to reuse, if any
+        bool collect_all_errors = false;                    ///< report every failed check of a record
+        std::shared_ptr<ReferenceFasta const> reference;    ///< reference to check the REF alleles against, if any
+
+        /**
+         * Check the position, sorting and contig of the records by blocks (see RecordBlock), reporting the errors of
+         * each block together, with the same results and order as record by record. Only used with the warning level,
+         * by the validations that parse every line in order.
+         */
+        bool record_blocks = false;
+    };
 
     // Only check syntax
     struct QuickValidatorCfg
@@ -69,6 +91,14 @@ namespace ebi
       using OptionalPolicy = ValidateOptionalPolicy;
     };
 
+    // Check both syntax and semantics, only counting the errors of each class after the first one
+    struct CountingValidatorCfg
+    {
+      using ParsePolicy = StoreParsePolicy;
+      using ErrorPolicy = CountErrorPolicy;
+      using OptionalPolicy = ValidateOptionalPolicy;
+    };
+
     class Parser
     {
       public:
@@ -79,9 +109,87 @@ namespace ebi
 
         virtual void end() = 0;
 
+        /**
+         * Forgets the records seen so far, so that the duplicates check starts again from the next record
+         */
+        virtual void clear_previous_records() = 0;
+
+        /**
+         * Counts a body line without validating it, so that the line numbers of later errors are still right
+         */
+        virtual void skip(std::vector<char> const & text) = 0;
+
+        /**
+         * Counts several body lines without reading them, e.g. after seeking over them in the input
+         */
+        virtual void skip_lines(size_t count) = 0;
+
+        /**
+         * Writes the state reached after parsing the meta and header sections
+         */
+        virtual void save_header(std::ostream & output) const = 0;
+
+        /**
+         * Restores a state written by `save_header`, as if the same meta and header sections had just been parsed
+         *
+         * @throw std::runtime_error if the input is not a state written by `save_header`
+         */
+        virtual void restore_header(std::istream & input) = 0;
+
+        /**
+         * Writes the whole state of the parser between two lines, so that `restore` can continue from the next one
+         */
+        virtual void save(std::ostream & output) const = 0;
+
+        /**
+         * Restores a state written by `save` by the same kind of parser
+         *
+         * @throw std::runtime_error if the input is not a state written by `save`
+         */
+        virtual void restore(std::istream & input) = 0;
+
+        /**
+         * Writes the state of the sortedness checks, such as the contigs already finished. Unlike `save`, it only
+         * depends on the records read, not on their line numbers.
+         */
+        virtual void save_sorting(std::ostream & output) const = 0;
+
+        /**
+         * Restores a state written by `save_sorting`, e.g. before continuing from another part of the input
+         *
+         * @throw std::runtime_error if the input is not a state written by `save_sorting`
+         */
+        virtual void restore_sorting(std::istream & input) = 0;
+
+        /**
+         * Writes the state of the checks between records, such as the breakend mates still expected, with their lines
+         * relative to `first_line`, the line that the next record will have. The states before the same records in
+         * two positions of an input are equal if the checks will report the same, moved to the new position.
+         */
+        virtual void save_record_checks(std::ostream & output, size_t first_line) const = 0;
+
+        /**
+         * Restores a state written by `save_record_checks`, before a record that will be at line `first_line`
+         *
+         * @throw std::runtime_error if the input is not a state written by `save_record_checks`
+         */
+        virtual void restore_record_checks(std::istream & input, size_t first_line) = 0;
+
+        /**
+         * Identifies the grammar of the parser, so that the states saved by a parser with another grammar, such as
+         * the one of an older build, are not restored
+         */
+        virtual std::string grammar() const = 0;
+
         virtual bool is_valid() const = 0;
         virtual const std::vector<std::unique_ptr<Error>> & errors() const = 0;
         virtual const std::vector<std::unique_ptr<Error>> & warnings() const = 0;
+
+        /**
+         * Errors and warnings found so far by class, if the error policy counts them (empty otherwise). In that case
+         * `errors` and `warnings` only have the first one of each class.
+         */
+        virtual ErrorCounts const & error_counts() const = 0;
     };
     
     class ParserImpl
@@ -97,6 +205,17 @@ namespace ebi
 
         void end() override;
 
+        void clear_previous_records() override;
+
+        void skip(std::vector<char> const & text) override;
+        void skip_lines(size_t count) override;
+
+        void save_header(std::ostream & output) const override;
+        void restore_header(std::istream & input) override;
+
+        void save(std::ostream & output) const override;
+        void restore(std::istream & input) override;
+
         bool is_valid() const override;
         const std::vector<std::unique_ptr<Error>> & errors() const override;
         const std::vector<std::unique_ptr<Error>> & warnings() const override;
@@ -105,18 +224,173 @@ namespace ebi
       protected:
         virtual void parse_buffer(char const * p, char const * pe, char const * eof) = 0;
 
+        /**
+         * Runs the checks of the records in `record_block`, in order and each one at its line, handling their errors
+         * and warnings. Before the checks of a record, `report_block_lines` reports what was found in the lines up to
+         * its own.
+         */
+        virtual void check_record_block() = 0;
+
+        /**
+         * Checks the records of `record_block` and reports in `errors()` and `warnings()` what was found in the lines
+         * of the block, in the same order as if every record had been checked at its line
+         */
+        void report_record_block();
+
+        /**
+         * Reports in `errors()` and `warnings()` what was found while parsing the lines of `record_block`, up to
+         * `line` included
+         */
+        void report_block_lines(size_t line);
+
+        virtual void save_policies(std::ostream & output) const = 0;
+        virtual void restore_policies(std::istream & input) = 0;
+
+        /**
+         * Whether a well-formed body line only needs to be counted, because nothing but its syntax is checked
+         */
+        virtual bool skips_well_formed_body_lines() const = 0;
+
         /**
          * Previously seen records
          */
         RecordCache previous_records;
+
+      private:
+        /**
+         * Errors and warnings found while parsing the lines of `record_block`, still waiting for the checks of the
+         * records before them
+         */
+        std::vector<std::unique_ptr<Error>> block_errors;
+        std::vector<std::unique_ptr<Error>> block_warnings;
+
+        /**
+         * Moves what was found in the last line parsed to `block_errors` and `block_warnings`
+         */
+        void hold_block_lines();
+
+        /**
+         * State of the parser after the last body line that was parsed without errors and was accepted by
+         * is_well_formed_body_line, -1 if there is none. The parser goes back to this state after any other line
+         * accepted by is_well_formed_body_line, so those lines can skip it.
+         */
+        int well_formed_line_state;
+
+        /**
+         * Shorter lines, without many samples, are parsed as fast as is_well_formed_body_line checks them
+         */
+        static size_t const min_prefiltered_line_length = 256;
+
+        void parse(char const * p, char const * pe);
     };
     
+    /**
+     * Identifies a Ragel machine by its name, the version of the grammars and the numbers of some of its states
+     */
+    std::string grammar_fingerprint(std::string const &machine, std::vector<int> const &states);
+
+    /**
+     * Parser with the policies of a configuration, that only needs a Ragel machine to parse each version
+     */
     template <typename Configuration>
-    class ParserImpl_v41
+    class ConfiguredParserImpl
     : public ParserImpl,
-      Configuration::ParsePolicy,
-      Configuration::ErrorPolicy,
-      Configuration::OptionalPolicy
+      protected Configuration::ParsePolicy,
+      protected Configuration::ErrorPolicy,
+      protected Configuration::OptionalPolicy
+    {
+      public:
+        using ParsePolicy = typename Configuration::ParsePolicy;
+        using ErrorPolicy = typename Configuration::ErrorPolicy;
+        using OptionalPolicy = typename Configuration::OptionalPolicy;
+
+        ConfiguredParserImpl(std::shared_ptr<Source> source) : ParserImpl{source} {}
+
+        ErrorCounts const & error_counts() const override { return ErrorPolicy::get_counts(); }
+
+        void end() override
+        {
+            ParserImpl::end();
+            for (auto &warning : OptionalPolicy::optional_check_body_section(*this)) {
+                ErrorPolicy::handle_warning(*this, warning.release());
+            }
+        }
+
+        void clear_previous_records() override
+        {
+            ParserImpl::clear_previous_records();
+            OptionalPolicy::optional_clear_body_records();
+        }
+
+        void save_sorting(std::ostream & output) const override { ParsePolicy::write_state(output); }
+        void restore_sorting(std::istream & input) override { ParsePolicy::read_state(input); }
+
+        void save_record_checks(std::ostream & output, size_t first_line) const override
+        {
+            OptionalPolicy::write_state(output, first_line);
+        }
+
+        void restore_record_checks(std::istream & input, size_t first_line) override
+        {
+            OptionalPolicy::read_state(input, first_line);
+        }
+
+      protected:
+        void save_policies(std::ostream & output) const override
+        {
+            ParsePolicy::write_state(output);
+            OptionalPolicy::write_state(output);
+        }
+
+        void restore_policies(std::istream & input) override
+        {
+            ParsePolicy::read_state(input);
+            OptionalPolicy::read_state(input);
+        }
+
+        bool skips_well_formed_body_lines() const override { return ParsePolicy::skips_well_formed_body_lines(); }
+
+        void check_record_block() override
+        {
+            auto sorting_errors = ParsePolicy::handle_body_block(*this, record_block);
+            auto sorting_error = sorting_errors.begin();
+            OptionalPolicy::optional_check_body_block(*this, record_block);
+
+            // the rest is checked as in the record_end action of the Ragel machines, with the line of each record
+            size_t current_line = n_lines;
+            for (size_t i = 0; i < record_block.size(); ++i) {
+                Record const & record = *record_block.records[i];
+                report_block_lines(record.line);
+                n_lines = record.line;
+
+                if (sorting_error != sorting_errors.end() && (*sorting_error)->line == record.line) {
+                    // the record is discarded
+                    ErrorPolicy::handle_error(*this, sorting_error->release());
+                    ++sorting_error;
+                    continue;
+                }
+
+                for (auto &error : previous_records.check_duplicates(record)) {
+                    ErrorPolicy::handle_error(*this, error.release());
+                }
+                try {
+                    for (auto &warning : OptionalPolicy::optional_check_body_entry(*this, record_block, i)) {
+                        ErrorPolicy::handle_warning(*this, warning.release());
+                    }
+                } catch (Error *warning) {
+                    ErrorPolicy::handle_warning(*this, warning);
+                }
+                for (auto &warning : OptionalPolicy::optional_check_body_records(record)) {
+                    ErrorPolicy::handle_warning(*this, warning.release());
+                }
+            }
+            n_lines = current_line;
+        }
+    };
+
+    template <typename Configuration>
+    class ParserImpl_v41
+    : public ConfiguredParserImpl<Configuration>
     {
       public:
         using ParsePolicy = typename Configuration::ParsePolicy;
@@ -125,16 +399,22 @@ namespace ebi
 
         ParserImpl_v41(std::shared_ptr<Source> source);
 
+        std::string grammar() const override;
+
       private:
-        void parse_buffer(char const * p, char const * pe, char const * eof);
+        // the Ragel actions use the parsing state unqualified
+        using ParsingState::cs;
+        using ParsingState::n_lines;
+        using ParsingState::n_columns;
+        using ParsingState::record;
+        using ParserImpl::previous_records;
+
+        void parse_buffer(char const * p, char const * pe, char const * eof) override;
     };
 
     template <typename Configuration>
     class ParserImpl_v42
-    : public ParserImpl,
-      Configuration::ParsePolicy,
-      Configuration::ErrorPolicy,
-      Configuration::OptionalPolicy
+    : public ConfiguredParserImpl<Configuration>
     {
       public:
         using ParsePolicy = typename Configuration::ParsePolicy;
@@ -143,16 +423,22 @@ namespace ebi
 
         ParserImpl_v42(std::shared_ptr<Source> source);
 
+        std::string grammar() const override;
+
       private:
-        void parse_buffer(char const * p, char const * pe, char const * eof);
+        // the Ragel actions use the parsing state unqualified
+        using ParsingState::cs;
+        using ParsingState::n_lines;
+        using ParsingState::n_columns;
+        using ParsingState::record;
+        using ParserImpl::previous_records;
+
+        void parse_buffer(char const * p, char const * pe, char const * eof) override;
     };
 
     template <typename Configuration>
     class ParserImpl_v43
-    : public ParserImpl,
-      Configuration::ParsePolicy,
-      Configuration::ErrorPolicy,
-      Configuration::OptionalPolicy
+    : public ConfiguredParserImpl<Configuration>
     {
       public:
         using ParsePolicy = typename Configuration::ParsePolicy;
@@ -161,28 +447,97 @@ namespace ebi
 
         ParserImpl_v43(std::shared_ptr<Source> source);
 
+        std::string grammar() const override;
+
       private:
-        void parse_buffer(char const * p, char const * pe, char const * eof);
+        // the Ragel actions use the parsing state unqualified
+        using ParsingState::cs;
+        using ParsingState::n_lines;
+        using ParsingState::n_columns;
+        using ParsingState::record;
+        using ParserImpl::previous_records;
+
+        void parse_buffer(char const * p, char const * pe, char const * eof) override;
     };
 
     // Predefined aliases for common uses of the parser
     using QuickValidator_v41 = ParserImpl_v41<QuickValidatorCfg>;
     using FullValidator_v41 = ParserImpl_v41<FullValidatorCfg>;
     using Reader_v41 = ParserImpl_v41<ReaderCfg>;
+    using CountingValidator_v41 = ParserImpl_v41<CountingValidatorCfg>;
     
     using QuickValidator_v42 = ParserImpl_v42<QuickValidatorCfg>;
     using FullValidator_v42 = ParserImpl_v42<FullValidatorCfg>;
     using Reader_v42 = ParserImpl_v42<ReaderCfg>;
+    using CountingValidator_v42 = ParserImpl_v42<CountingValidatorCfg>;
     
     using QuickValidator_v43 = ParserImpl_v43<QuickValidatorCfg>;
     using FullValidator_v43 = ParserImpl_v43<FullValidatorCfg>;
     using Reader_v43 = ParserImpl_v43<ReaderCfg>;
+    using CountingValidator_v43 = ParserImpl_v43<CountingValidatorCfg>;
 
     bool is_valid_vcf_file(std::istream &input,
                            const std::string &sourceName,
                            ValidationLevel validationLevel,
                            Ploidy ploidy,
-                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs);
+                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                           ValidationOptions const &validationOptions = ValidationOptions{});
+
+    Version detect_version(const std::vector<char> &line);
+
+    std::unique_ptr<Parser> build_parser(std::string const &path,
+                                         ValidationLevel level,
+                                         Version version,
+                                         Ploidy ploidy,
+                                         ValidationOptions const &validationOptions = ValidationOptions{});
+
+    /**
+     * Reads the fileformat line of the input into `line` and builds the parser for the version it declares
+     *
+     * @return the parser, or null if the fileformat line is not valid, after writing its error to the outputs
+     */
+    std::unique_ptr<Parser> build_input_parser(std::vector<char> &line,
+                                               std::istream &input,
+                                               const std::string &sourceName,
+                                               ValidationLevel validationLevel,
+                                               Ploidy ploidy,
+                                               std::vector<std::unique_ptr<ReportWriter>> &outputs,
+                                               ValidationOptions const &validationOptions);
+
+    /**
+     * Builds the parser for the input as `build_input_parser` does and validates the meta and header sections, so
+     * that the parser is positioned at the first line of the body, which is left in `line`.
+     *
+     * @param header_lines if not null, receives the amount of lines in the meta and header sections
+     * @return the parser, or null if the fileformat line is not valid, after writing its error to the outputs
+     */
+    std::unique_ptr<Parser> validate_up_to_body(std::vector<char> &line,
+                                                std::istream &input,
+                                                const std::string &sourceName,
+                                                ValidationLevel validationLevel,
+                                                Ploidy ploidy,
+                                                std::vector<std::unique_ptr<ReportWriter>> &outputs,
+                                                ValidationOptions const &validationOptions,
+                                                size_t *header_lines = nullptr);
+
+    /**
+     * Validates the meta and header sections, starting with the line already read in `line`, and leaves the first
+     * line of the body in `line`. If a cache is provided, it is used instead of parsing the sections again.
+     *
+     * @return the amount of lines in the meta and header sections
+     */
+    size_t validate_header(std::vector<char> &line,
+                           std::istream &input,
+                           Parser &validator,
+                           std::vector<std::unique_ptr<ReportWriter>> &outputs,
+                           HeaderCache *headerCache = nullptr);
+
+    void write_errors(const Parser &validator, const std::vector<std::unique_ptr<ReportWriter>> &outputs);
+
+    /**
+     * Writes as messages the amount of errors and warnings of each class, if the validator counted them
+     */
+    void write_error_counts(const Parser &validator, const std::vector<std::unique_ptr<ReportWriter>> &outputs);
   }
 }
 
@@ -46,7 +46,7 @@ namespace ebi
     
     template <typename Configuration>
     ParserImpl_v41<Configuration>::ParserImpl_v41(std::shared_ptr<Source> source)
-    : ParserImpl{source}
+    : ConfiguredParserImpl<Configuration>{source}
     {
       
 #line 53 "inc/vcf/validator_detail_v41.hpp"
@@ -75,38 +75,38 @@ case 1:
 tr0:
 #line 60 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
+        ErrorPolicy::template handle_new_error<FileformatError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr14:
 #line 29 "src/vcf/vcf_v41.ragel"
 	{
-        ErrorPolicy::handle_error(*this,
-                new FileformatError{n_lines, "The fileformat declaration is not 'fileformat=VCFv4.1'"});
+        ErrorPolicy::template handle_new_error<FileformatError>(*this,
+                n_lines, "The fileformat declaration is not 'fileformat=VCFv4.1'");
         p--; {goto st519;}
     }
 #line 60 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
+        ErrorPolicy::template handle_new_error<FileformatError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr24:
 #line 60 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
+        ErrorPolicy::template handle_new_error<FileformatError>(*this, n_lines);
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 387 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
-            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines,
+            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO");
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -119,7 +119,7 @@ tr24:
     }
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -134,13 +134,13 @@ tr24:
 tr26:
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 387 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
-            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines,
+            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO");
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -153,7 +153,7 @@ tr26:
     }
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -166,601 +166,601 @@ tr26:
     }
 	goto st0;
 tr29:
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st519;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st519;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 267 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in assembly metadata");
         p--; {goto st519;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 273 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in contig metadata");
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st519;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 307 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in PEDIGREE metadata");
         p--; {goto st519;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 328 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in pedigreeDB metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr39:
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr125:
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr133:
-#line 252 "src/vcf/vcf.ragel"
+#line 260 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines,
-            "ALT metadata ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines,
+            "ALT metadata ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence");
         p--; {goto st519;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr152:
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st519;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr162:
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr165:
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr175:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st519;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr194:
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st519;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr204:
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr214:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr227:
 #line 36 "src/vcf/vcf_v41.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "FORMAT metadata Number is not a number, A, G or dot"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "FORMAT metadata Number is not a number, A, G or dot");
         p--; {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr236:
-#line 293 "src/vcf/vcf.ragel"
+#line 301 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String");
         p--; {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr253:
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr264:
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr273:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr286:
 #line 42 "src/vcf/vcf_v41.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Number is not a number, A, G or dot"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "INFO metadata Number is not a number, A, G or dot");
         p--; {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr295:
-#line 293 "src/vcf/vcf.ragel"
+#line 301 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String");
         p--; {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr312:
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr323:
-#line 299 "src/vcf/vcf.ragel"
+#line 307 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in PEDIGREE metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr333:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st519;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 307 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in PEDIGREE metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr345:
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr356:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr361:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st519;}
     }
-#line 352 "src/vcf/vcf.ragel"
+#line 360 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)");
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr363:
-#line 352 "src/vcf/vcf.ragel"
+#line 360 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)");
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr373:
-#line 352 "src/vcf/vcf.ragel"
+#line 360 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)");
         p--; {goto st519;}
     }
-#line 357 "src/vcf/vcf.ragel"
+#line 365 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)");
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr376:
-#line 357 "src/vcf/vcf.ragel"
+#line 365 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)");
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr386:
-#line 357 "src/vcf/vcf.ragel"
+#line 365 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)");
         p--; {goto st519;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr389:
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr412:
-#line 259 "src/vcf/vcf.ragel"
+#line 267 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in assembly metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr421:
-#line 373 "src/vcf/vcf.ragel"
+#line 381 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata URL is not valid");
         p--; {goto st519;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 267 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in assembly metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr442:
-#line 265 "src/vcf/vcf.ragel"
+#line 273 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in contig metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr453:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st519;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 273 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in contig metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr491:
-#line 320 "src/vcf/vcf.ragel"
+#line 328 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in pedigreeDB metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr503:
-#line 373 "src/vcf/vcf.ragel"
+#line 381 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata URL is not valid");
         p--; {goto st519;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 328 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in pedigreeDB metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	goto st0;
 tr526:
-#line 379 "src/vcf/vcf.ragel"
+#line 387 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
-            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines,
+            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO");
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -773,7 +773,7 @@ tr526:
     }
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -788,7 +788,7 @@ tr526:
 tr566:
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -801,181 +801,181 @@ tr566:
     }
 	goto st0;
 tr581:
-#line 396 "src/vcf/vcf.ragel"
+#line 404 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<ChromosomeBodyError>(*this, n_lines);
         p--; {goto st520;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	goto st0;
 tr584:
-#line 402 "src/vcf/vcf.ragel"
+#line 410 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new PositionBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<PositionBodyError>(*this, n_lines);
         p--; {goto st520;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	goto st0;
 tr588:
-#line 408 "src/vcf/vcf.ragel"
+#line 416 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new IdBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<IdBodyError>(*this, n_lines);
         p--; {goto st520;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	goto st0;
 tr593:
-#line 414 "src/vcf/vcf.ragel"
+#line 422 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new ReferenceAlleleBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<ReferenceAlleleBodyError>(*this, n_lines);
         p--; {goto st520;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	goto st0;
 tr597:
-#line 420 "src/vcf/vcf.ragel"
+#line 428 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new AlternateAllelesBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<AlternateAllelesBodyError>(*this, n_lines);
         p--; {goto st520;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	goto st0;
 tr606:
-#line 426 "src/vcf/vcf.ragel"
+#line 434 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new QualityBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<QualityBodyError>(*this, n_lines);
         p--; {goto st520;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	goto st0;
 tr617:
-#line 432 "src/vcf/vcf.ragel"
+#line 440 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FilterBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<FilterBodyError>(*this, n_lines);
         p--; {goto st520;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	goto st0;
 tr625:
-#line 443 "src/vcf/vcf.ragel"
+#line 451 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info key is not a sequence of alphanumeric and/or punctuation characters"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info key is not a sequence of alphanumeric and/or punctuation characters");
         p--; {goto st520;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 446 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs");
         p--; {goto st520;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	goto st0;
 tr629:
 #line 50 "src/vcf/vcf_v41.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FormatBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<FormatBodyError>(*this, n_lines);
         p--; {goto st520;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	goto st0;
 tr634:
-#line 461 "src/vcf/vcf.ragel"
+#line 469 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " does not start with a valid genotype";
-        ErrorPolicy::handle_error(*this, new SamplesFieldBodyError{n_lines, message_stream.str(), "GT"});
+        ErrorPolicy::template handle_new_error<SamplesFieldBodyError>(*this, n_lines, message_stream.str(), "GT");
         p--; {goto st520;}
     }
-#line 454 "src/vcf/vcf.ragel"
+#line 462 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
-        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
+        ErrorPolicy::template handle_new_error<SamplesBodyError>(*this, n_lines, message_stream.str());
         p--; {goto st520;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	goto st0;
 tr642:
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	goto st0;
 tr644:
-#line 454 "src/vcf/vcf.ragel"
+#line 462 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
-        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
+        ErrorPolicy::template handle_new_error<SamplesBodyError>(*this, n_lines, message_stream.str());
         p--; {goto st520;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	goto st0;
 tr650:
-#line 448 "src/vcf/vcf.ragel"
+#line 456 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info field value is not a comma-separated list of valid strings (maybe it contains whitespaces?)"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info field value is not a comma-separated list of valid strings (maybe it contains whitespaces?)");
         p--; {goto st520;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 446 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs");
         p--; {goto st520;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	goto st0;
 tr699:
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -986,26 +986,26 @@ tr699:
         
         p--; {goto st520;}
     }
-#line 396 "src/vcf/vcf.ragel"
+#line 404 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<ChromosomeBodyError>(*this, n_lines);
         p--; {goto st520;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	goto st0;
 tr706:
-#line 438 "src/vcf/vcf.ragel"
+#line 446 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs");
         p--; {goto st520;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	goto st0;
@@ -1225,7 +1225,7 @@ tr22:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st22;
@@ -1358,7 +1358,7 @@ tr45:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st28;
@@ -1378,7 +1378,7 @@ tr55:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st28;
@@ -1410,7 +1410,7 @@ tr46:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st29;
@@ -1430,7 +1430,7 @@ tr56:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st29;
@@ -6166,7 +6166,7 @@ tr424:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st313;
@@ -6273,7 +6273,7 @@ tr438:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 #line 35 "src/vcf/vcf.ragel"
@@ -7343,7 +7343,7 @@ tr506:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st374;
@@ -7450,7 +7450,7 @@ tr520:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 #line 35 "src/vcf/vcf.ragel"
@@ -7498,7 +7498,7 @@ tr522:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 #line 35 "src/vcf/vcf.ragel"
@@ -8005,7 +8005,7 @@ tr564:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st521;
@@ -8025,7 +8025,7 @@ tr576:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st521;
@@ -8056,7 +8056,7 @@ tr704:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st522;
@@ -8076,7 +8076,7 @@ tr700:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st522;
@@ -8098,7 +8098,7 @@ tr705:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st439;
@@ -8118,7 +8118,7 @@ tr701:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st439;
@@ -8806,8 +8806,11 @@ tr708:
 #line 218 "src/vcf/vcf.ragel"
 	{
         try {
-            // Handle all columns and build record
-            ParsePolicy::handle_body_line(*this);
+            // Handle all columns and build record, or get every error found in it if all of them are collected
+            auto record_errors = ParsePolicy::handle_body_line(*this);
+            for (auto &error_ptr : record_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
+            }
 
             if (record != nullptr) {
                 auto duplicated_errors = previous_records.check_duplicates(*record);
@@ -8819,11 +8822,22 @@ tr708:
             try {
                 // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
                 if (record != nullptr) {
-                    OptionalPolicy::optional_check_body_entry(*this, *record);
+                    auto collected_warnings = OptionalPolicy::optional_check_body_entry(*this, *record);
+                    for (auto &warning_ptr : collected_warnings) {
+                        ErrorPolicy::handle_warning(*this, warning_ptr.release());
+                    }
                 }
             } catch (Error *warn) {
                 ErrorPolicy::handle_warning(*this, warn);
             }
+
+            // Check the rules that span several records, which may find several warnings at once
+            if (record != nullptr) {
+                auto cross_record_warnings = OptionalPolicy::optional_check_body_records(*record);
+                for (auto &warning_ptr : cross_record_warnings) {
+                    ErrorPolicy::handle_warning(*this, warning_ptr.release());
+                }
+            }
         } catch (Error *error) {
             ErrorPolicy::handle_error(*this, error);
         }
@@ -8835,7 +8849,7 @@ tr708:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st525;
@@ -8843,7 +8857,7 @@ st525:
 	if ( ++p == pe )
 		goto _test_eof525;
 case 525:
-#line 8847 "inc/vcf/validator_detail_v41.hpp"
+#line 8855 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr704;
 		case 13: goto tr705;
@@ -8872,7 +8886,7 @@ st459:
 	if ( ++p == pe )
 		goto _test_eof459;
 case 459:
-#line 8876 "inc/vcf/validator_detail_v41.hpp"
+#line 8884 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr638;
@@ -8902,7 +8916,7 @@ st460:
 	if ( ++p == pe )
 		goto _test_eof460;
 case 460:
-#line 8906 "inc/vcf/validator_detail_v41.hpp"
+#line 8914 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 59: goto tr639;
 		case 62: goto tr640;
@@ -8926,7 +8940,7 @@ st461:
 	if ( ++p == pe )
 		goto _test_eof461;
 case 461:
-#line 8930 "inc/vcf/validator_detail_v41.hpp"
+#line 8938 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 9 )
 		goto tr641;
 	goto tr581;
@@ -8942,8 +8956,11 @@ tr709:
 #line 218 "src/vcf/vcf.ragel"
 	{
         try {
-            // Handle all columns and build record
-            ParsePolicy::handle_body_line(*this);
+            // Handle all columns and build record, or get every error found in it if all of them are collected
+            auto record_errors = ParsePolicy::handle_body_line(*this);
+            for (auto &error_ptr : record_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
+            }
 
             if (record != nullptr) {
                 auto duplicated_errors = previous_records.check_duplicates(*record);
@@ -8955,11 +8972,22 @@ tr709:
             try {
                 // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
                 if (record != nullptr) {
-                    OptionalPolicy::optional_check_body_entry(*this, *record);
+                    auto collected_warnings = OptionalPolicy::optional_check_body_entry(*this, *record);
+                    for (auto &warning_ptr : collected_warnings) {
+                        ErrorPolicy::handle_warning(*this, warning_ptr.release());
+                    }
                 }
             } catch (Error *warn) {
                 ErrorPolicy::handle_warning(*this, warn);
             }
+
+            // Check the rules that span several records, which may find several warnings at once
+            if (record != nullptr) {
+                auto cross_record_warnings = OptionalPolicy::optional_check_body_records(*record);
+                for (auto &warning_ptr : cross_record_warnings) {
+                    ErrorPolicy::handle_warning(*this, warning_ptr.release());
+                }
+            }
         } catch (Error *error) {
             ErrorPolicy::handle_error(*this, error);
         }
@@ -8971,7 +8999,7 @@ tr709:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st462;
@@ -8979,7 +9007,7 @@ st462:
 	if ( ++p == pe )
 		goto _test_eof462;
 case 462:
-#line 8983 "inc/vcf/validator_detail_v41.hpp"
+#line 8999 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 10 )
 		goto st525;
 	goto tr642;
@@ -8993,7 +9021,7 @@ st463:
 	if ( ++p == pe )
 		goto _test_eof463;
 case 463:
-#line 8997 "inc/vcf/validator_detail_v41.hpp"
+#line 9013 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) > 57 ) {
 		if ( 59 <= (*p) && (*p) <= 126 )
 			goto tr645;
@@ -9020,7 +9048,7 @@ st526:
 	if ( ++p == pe )
 		goto _test_eof526;
 case 526:
-#line 9024 "inc/vcf/validator_detail_v41.hpp"
+#line 9040 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr631;
 		case 10: goto tr708;
@@ -9042,7 +9070,7 @@ st527:
 	if ( ++p == pe )
 		goto _test_eof527;
 case 527:
-#line 9046 "inc/vcf/validator_detail_v41.hpp"
+#line 9062 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr631;
 		case 10: goto tr708;
@@ -9079,7 +9107,7 @@ st528:
 	if ( ++p == pe )
 		goto _test_eof528;
 case 528:
-#line 9083 "inc/vcf/validator_detail_v41.hpp"
+#line 9099 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr631;
 		case 10: goto tr708;
@@ -9111,7 +9139,7 @@ st464:
 	if ( ++p == pe )
 		goto _test_eof464;
 case 464:
-#line 9115 "inc/vcf/validator_detail_v41.hpp"
+#line 9131 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 48 )
 		goto tr646;
 	goto tr625;
@@ -9125,7 +9153,7 @@ st465:
 	if ( ++p == pe )
 		goto _test_eof465;
 case 465:
-#line 9129 "inc/vcf/validator_detail_v41.hpp"
+#line 9145 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 48 )
 		goto tr647;
 	goto tr625;
@@ -9139,7 +9167,7 @@ st466:
 	if ( ++p == pe )
 		goto _test_eof466;
 case 466:
-#line 9143 "inc/vcf/validator_detail_v41.hpp"
+#line 9159 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 48 )
 		goto tr648;
 	goto tr625;
@@ -9153,7 +9181,7 @@ st467:
 	if ( ++p == pe )
 		goto _test_eof467;
 case 467:
-#line 9157 "inc/vcf/validator_detail_v41.hpp"
+#line 9173 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 71 )
 		goto tr649;
 	goto tr625;
@@ -9167,7 +9195,7 @@ st529:
 	if ( ++p == pe )
 		goto _test_eof529;
 case 529:
-#line 9171 "inc/vcf/validator_detail_v41.hpp"
+#line 9187 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr707;
 		case 10: goto tr708;
@@ -9186,7 +9214,7 @@ st468:
 	if ( ++p == pe )
 		goto _test_eof468;
 case 468:
-#line 9190 "inc/vcf/validator_detail_v41.hpp"
+#line 9206 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 49: goto tr627;
 		case 95: goto tr628;
@@ -9217,7 +9245,7 @@ st530:
 	if ( ++p == pe )
 		goto _test_eof530;
 case 530:
-#line 9221 "inc/vcf/validator_detail_v41.hpp"
+#line 9237 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr707;
 		case 10: goto tr708;
@@ -9246,7 +9274,7 @@ st469:
 	if ( ++p == pe )
 		goto _test_eof469;
 case 469:
-#line 9250 "inc/vcf/validator_detail_v41.hpp"
+#line 9266 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) > 58 ) {
 		if ( 60 <= (*p) && (*p) <= 126 )
 			goto tr651;
@@ -9263,7 +9291,7 @@ st531:
 	if ( ++p == pe )
 		goto _test_eof531;
 case 531:
-#line 9267 "inc/vcf/validator_detail_v41.hpp"
+#line 9283 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr707;
 		case 10: goto tr708;
@@ -9283,7 +9311,7 @@ st470:
 	if ( ++p == pe )
 		goto _test_eof470;
 case 470:
-#line 9287 "inc/vcf/validator_detail_v41.hpp"
+#line 9303 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 58 )
 		goto tr618;
 	if ( (*p) < 65 ) {
@@ -9321,7 +9349,7 @@ st471:
 	if ( ++p == pe )
 		goto _test_eof471;
 case 471:
-#line 9325 "inc/vcf/validator_detail_v41.hpp"
+#line 9341 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr623;
 		case 58: goto st453;
@@ -9357,7 +9385,7 @@ st472:
 	if ( ++p == pe )
 		goto _test_eof472;
 case 472:
-#line 9361 "inc/vcf/validator_detail_v41.hpp"
+#line 9377 "inc/vcf/validator_detail_v41.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr652;
 	goto tr606;
@@ -9371,7 +9399,7 @@ st473:
 	if ( ++p == pe )
 		goto _test_eof473;
 case 473:
-#line 9375 "inc/vcf/validator_detail_v41.hpp"
+#line 9391 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr614;
 		case 69: goto tr616;
@@ -9390,7 +9418,7 @@ st474:
 	if ( ++p == pe )
 		goto _test_eof474;
 case 474:
-#line 9394 "inc/vcf/validator_detail_v41.hpp"
+#line 9410 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 43: goto tr653;
 		case 45: goto tr653;
@@ -9408,7 +9436,7 @@ st475:
 	if ( ++p == pe )
 		goto _test_eof475;
 case 475:
-#line 9412 "inc/vcf/validator_detail_v41.hpp"
+#line 9428 "inc/vcf/validator_detail_v41.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr654;
 	goto tr606;
@@ -9422,7 +9450,7 @@ st476:
 	if ( ++p == pe )
 		goto _test_eof476;
 case 476:
-#line 9426 "inc/vcf/validator_detail_v41.hpp"
+#line 9442 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 9 )
 		goto tr614;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -9448,7 +9476,7 @@ st477:
 	if ( ++p == pe )
 		goto _test_eof477;
 case 477:
-#line 9452 "inc/vcf/validator_detail_v41.hpp"
+#line 9468 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 110 )
 		goto tr655;
 	goto tr606;
@@ -9462,7 +9490,7 @@ st478:
 	if ( ++p == pe )
 		goto _test_eof478;
 case 478:
-#line 9466 "inc/vcf/validator_detail_v41.hpp"
+#line 9482 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 102 )
 		goto tr656;
 	goto tr606;
@@ -9486,7 +9514,7 @@ st479:
 	if ( ++p == pe )
 		goto _test_eof479;
 case 479:
-#line 9490 "inc/vcf/validator_detail_v41.hpp"
+#line 9506 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 9 )
 		goto tr614;
 	goto tr606;
@@ -9504,7 +9532,7 @@ st480:
 	if ( ++p == pe )
 		goto _test_eof480;
 case 480:
-#line 9508 "inc/vcf/validator_detail_v41.hpp"
+#line 9524 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 97 )
 		goto tr657;
 	goto tr606;
@@ -9518,7 +9546,7 @@ st481:
 	if ( ++p == pe )
 		goto _test_eof481;
 case 481:
-#line 9522 "inc/vcf/validator_detail_v41.hpp"
+#line 9538 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 78 )
 		goto tr656;
 	goto tr606;
@@ -9532,7 +9560,7 @@ st482:
 	if ( ++p == pe )
 		goto _test_eof482;
 case 482:
-#line 9536 "inc/vcf/validator_detail_v41.hpp"
+#line 9552 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 42: goto tr598;
 		case 46: goto tr658;
@@ -9571,7 +9599,7 @@ st483:
 	if ( ++p == pe )
 		goto _test_eof483;
 case 483:
-#line 9575 "inc/vcf/validator_detail_v41.hpp"
+#line 9591 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 65: goto tr659;
 		case 67: goto tr659;
@@ -9595,7 +9623,7 @@ st484:
 	if ( ++p == pe )
 		goto _test_eof484;
 case 484:
-#line 9599 "inc/vcf/validator_detail_v41.hpp"
+#line 9615 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr604;
 		case 44: goto tr605;
@@ -9631,7 +9659,7 @@ st485:
 	if ( ++p == pe )
 		goto _test_eof485;
 case 485:
-#line 9635 "inc/vcf/validator_detail_v41.hpp"
+#line 9651 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 61 )
 		goto tr660;
 	if ( (*p) < 63 ) {
@@ -9671,7 +9699,7 @@ st486:
 	if ( ++p == pe )
 		goto _test_eof486;
 case 486:
-#line 9675 "inc/vcf/validator_detail_v41.hpp"
+#line 9691 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 62 )
 		goto tr662;
 	if ( (*p) < 45 ) {
@@ -9703,7 +9731,7 @@ st487:
 	if ( ++p == pe )
 		goto _test_eof487;
 case 487:
-#line 9707 "inc/vcf/validator_detail_v41.hpp"
+#line 9723 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr604;
 		case 44: goto tr605;
@@ -9732,7 +9760,7 @@ st488:
 	if ( ++p == pe )
 		goto _test_eof488;
 case 488:
-#line 9736 "inc/vcf/validator_detail_v41.hpp"
+#line 9752 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 60 )
 		goto tr667;
 	if ( (*p) < 65 ) {
@@ -9754,7 +9782,7 @@ st489:
 	if ( ++p == pe )
 		goto _test_eof489;
 case 489:
-#line 9758 "inc/vcf/validator_detail_v41.hpp"
+#line 9774 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 58: goto tr668;
 		case 61: goto tr666;
@@ -9778,7 +9806,7 @@ st490:
 	if ( ++p == pe )
 		goto _test_eof490;
 case 490:
-#line 9782 "inc/vcf/validator_detail_v41.hpp"
+#line 9798 "inc/vcf/validator_detail_v41.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr669;
 	goto tr597;
@@ -9792,7 +9820,7 @@ st491:
 	if ( ++p == pe )
 		goto _test_eof491;
 case 491:
-#line 9796 "inc/vcf/validator_detail_v41.hpp"
+#line 9812 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 91 )
 		goto tr662;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -9808,7 +9836,7 @@ st492:
 	if ( ++p == pe )
 		goto _test_eof492;
 case 492:
-#line 9812 "inc/vcf/validator_detail_v41.hpp"
+#line 9828 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr670;
@@ -9828,7 +9856,7 @@ st493:
 	if ( ++p == pe )
 		goto _test_eof493;
 case 493:
-#line 9832 "inc/vcf/validator_detail_v41.hpp"
+#line 9848 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 59: goto tr670;
 		case 62: goto tr671;
@@ -9852,7 +9880,7 @@ st494:
 	if ( ++p == pe )
 		goto _test_eof494;
 case 494:
-#line 9856 "inc/vcf/validator_detail_v41.hpp"
+#line 9872 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 58 )
 		goto tr668;
 	goto tr597;
@@ -9866,7 +9894,7 @@ st495:
 	if ( ++p == pe )
 		goto _test_eof495;
 case 495:
-#line 9870 "inc/vcf/validator_detail_v41.hpp"
+#line 9886 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 60 )
 		goto tr673;
 	if ( (*p) < 65 ) {
@@ -9888,7 +9916,7 @@ st496:
 	if ( ++p == pe )
 		goto _test_eof496;
 case 496:
-#line 9892 "inc/vcf/validator_detail_v41.hpp"
+#line 9908 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 58: goto tr674;
 		case 61: goto tr672;
@@ -9912,7 +9940,7 @@ st497:
 	if ( ++p == pe )
 		goto _test_eof497;
 case 497:
-#line 9916 "inc/vcf/validator_detail_v41.hpp"
+#line 9932 "inc/vcf/validator_detail_v41.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr675;
 	goto tr597;
@@ -9926,7 +9954,7 @@ st498:
 	if ( ++p == pe )
 		goto _test_eof498;
 case 498:
-#line 9930 "inc/vcf/validator_detail_v41.hpp"
+#line 9946 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 93 )
 		goto tr662;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -9942,7 +9970,7 @@ st499:
 	if ( ++p == pe )
 		goto _test_eof499;
 case 499:
-#line 9946 "inc/vcf/validator_detail_v41.hpp"
+#line 9962 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr676;
@@ -9962,7 +9990,7 @@ st500:
 	if ( ++p == pe )
 		goto _test_eof500;
 case 500:
-#line 9966 "inc/vcf/validator_detail_v41.hpp"
+#line 9982 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 59: goto tr676;
 		case 62: goto tr677;
@@ -9986,7 +10014,7 @@ st501:
 	if ( ++p == pe )
 		goto _test_eof501;
 case 501:
-#line 9990 "inc/vcf/validator_detail_v41.hpp"
+#line 10006 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 58 )
 		goto tr674;
 	goto tr597;
@@ -10004,7 +10032,7 @@ st502:
 	if ( ++p == pe )
 		goto _test_eof502;
 case 502:
-#line 10008 "inc/vcf/validator_detail_v41.hpp"
+#line 10024 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 60 )
 		goto tr679;
 	if ( (*p) < 65 ) {
@@ -10026,7 +10054,7 @@ st503:
 	if ( ++p == pe )
 		goto _test_eof503;
 case 503:
-#line 10030 "inc/vcf/validator_detail_v41.hpp"
+#line 10046 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 58: goto tr680;
 		case 61: goto tr678;
@@ -10050,7 +10078,7 @@ st504:
 	if ( ++p == pe )
 		goto _test_eof504;
 case 504:
-#line 10054 "inc/vcf/validator_detail_v41.hpp"
+#line 10070 "inc/vcf/validator_detail_v41.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr681;
 	goto tr597;
@@ -10064,7 +10092,7 @@ st505:
 	if ( ++p == pe )
 		goto _test_eof505;
 case 505:
-#line 10068 "inc/vcf/validator_detail_v41.hpp"
+#line 10084 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 91 )
 		goto tr682;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -10080,7 +10108,7 @@ st506:
 	if ( ++p == pe )
 		goto _test_eof506;
 case 506:
-#line 10084 "inc/vcf/validator_detail_v41.hpp"
+#line 10100 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr683;
@@ -10100,7 +10128,7 @@ st507:
 	if ( ++p == pe )
 		goto _test_eof507;
 case 507:
-#line 10104 "inc/vcf/validator_detail_v41.hpp"
+#line 10120 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 59: goto tr683;
 		case 62: goto tr684;
@@ -10124,7 +10152,7 @@ st508:
 	if ( ++p == pe )
 		goto _test_eof508;
 case 508:
-#line 10128 "inc/vcf/validator_detail_v41.hpp"
+#line 10144 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 58 )
 		goto tr680;
 	goto tr597;
@@ -10142,7 +10170,7 @@ st509:
 	if ( ++p == pe )
 		goto _test_eof509;
 case 509:
-#line 10146 "inc/vcf/validator_detail_v41.hpp"
+#line 10162 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 60 )
 		goto tr686;
 	if ( (*p) < 65 ) {
@@ -10164,7 +10192,7 @@ st510:
 	if ( ++p == pe )
 		goto _test_eof510;
 case 510:
-#line 10168 "inc/vcf/validator_detail_v41.hpp"
+#line 10184 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 58: goto tr687;
 		case 61: goto tr685;
@@ -10188,7 +10216,7 @@ st511:
 	if ( ++p == pe )
 		goto _test_eof511;
 case 511:
-#line 10192 "inc/vcf/validator_detail_v41.hpp"
+#line 10208 "inc/vcf/validator_detail_v41.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr688;
 	goto tr597;
@@ -10202,7 +10230,7 @@ st512:
 	if ( ++p == pe )
 		goto _test_eof512;
 case 512:
-#line 10206 "inc/vcf/validator_detail_v41.hpp"
+#line 10222 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 93 )
 		goto tr682;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -10218,7 +10246,7 @@ st513:
 	if ( ++p == pe )
 		goto _test_eof513;
 case 513:
-#line 10222 "inc/vcf/validator_detail_v41.hpp"
+#line 10238 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr689;
@@ -10238,7 +10266,7 @@ st514:
 	if ( ++p == pe )
 		goto _test_eof514;
 case 514:
-#line 10242 "inc/vcf/validator_detail_v41.hpp"
+#line 10258 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 59: goto tr689;
 		case 62: goto tr690;
@@ -10262,7 +10290,7 @@ st515:
 	if ( ++p == pe )
 		goto _test_eof515;
 case 515:
-#line 10266 "inc/vcf/validator_detail_v41.hpp"
+#line 10282 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 58 )
 		goto tr687;
 	goto tr597;
@@ -10280,7 +10308,7 @@ st516:
 	if ( ++p == pe )
 		goto _test_eof516;
 case 516:
-#line 10284 "inc/vcf/validator_detail_v41.hpp"
+#line 10300 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr604;
 		case 65: goto tr659;
@@ -10307,7 +10335,7 @@ tr565:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st517;
@@ -10327,7 +10355,7 @@ tr577:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st517;
@@ -10335,7 +10363,7 @@ st517:
 	if ( ++p == pe )
 		goto _test_eof517;
 case 517:
-#line 10339 "inc/vcf/validator_detail_v41.hpp"
+#line 10355 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 10 )
 		goto st521;
 	goto tr566;
@@ -10356,7 +10384,7 @@ tr23:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st518;
@@ -10364,7 +10392,7 @@ st518:
 	if ( ++p == pe )
 		goto _test_eof518;
 case 518:
-#line 10368 "inc/vcf/validator_detail_v41.hpp"
+#line 10384 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 10 )
 		goto st22;
 	goto tr0;
@@ -10376,7 +10404,7 @@ tr695:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st519;
@@ -10384,7 +10412,7 @@ st519:
 	if ( ++p == pe )
 		goto _test_eof519;
 case 519:
-#line 10388 "inc/vcf/validator_detail_v41.hpp"
+#line 10404 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr694;
 		case 13: goto tr695;
@@ -10398,7 +10426,7 @@ tr694:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 #line 227 "src/vcf/vcf_v41.ragel"
@@ -10408,7 +10436,7 @@ st532:
 	if ( ++p == pe )
 		goto _test_eof532;
 case 532:
-#line 10412 "inc/vcf/validator_detail_v41.hpp"
+#line 10428 "inc/vcf/validator_detail_v41.hpp"
 	goto st0;
 tr698:
 #line 43 "src/vcf/vcf.ragel"
@@ -10418,7 +10446,7 @@ tr698:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st520;
@@ -10426,7 +10454,7 @@ st520:
 	if ( ++p == pe )
 		goto _test_eof520;
 case 520:
-#line 10430 "inc/vcf/validator_detail_v41.hpp"
+#line 10446 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr697;
 		case 13: goto tr698;
@@ -10440,7 +10468,7 @@ tr697:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 #line 228 "src/vcf/vcf_v41.ragel"
@@ -10450,7 +10478,7 @@ st533:
 	if ( ++p == pe )
 		goto _test_eof533;
 case 533:
-#line 10454 "inc/vcf/validator_detail_v41.hpp"
+#line 10470 "inc/vcf/validator_detail_v41.hpp"
 	goto st0;
 	}
 	_test_eof2: cs = 2; goto _test_eof; 
@@ -11006,7 +11034,7 @@ case 533:
 	case 518: 
 #line 60 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
+        ErrorPolicy::template handle_new_error<FileformatError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
@@ -11060,7 +11088,7 @@ case 533:
 	case 73: 
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
@@ -11086,7 +11114,7 @@ case 533:
 	case 517: 
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -11101,7 +11129,7 @@ case 533:
 	case 462: 
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	break;
@@ -11126,14 +11154,14 @@ case 533:
 	case 95: 
 	case 96: 
 	case 100: 
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
@@ -11145,14 +11173,14 @@ case 533:
 	case 308: 
 	case 309: 
 	case 310: 
-#line 259 "src/vcf/vcf.ragel"
+#line 267 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in assembly metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
@@ -11185,14 +11213,14 @@ case 533:
 	case 358: 
 	case 359: 
 	case 360: 
-#line 265 "src/vcf/vcf.ragel"
+#line 273 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in contig metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
@@ -11219,14 +11247,14 @@ case 533:
 	case 128: 
 	case 129: 
 	case 133: 
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
@@ -11265,14 +11293,14 @@ case 533:
 	case 176: 
 	case 177: 
 	case 181: 
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
@@ -11310,14 +11338,14 @@ case 533:
 	case 224: 
 	case 225: 
 	case 229: 
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
@@ -11331,14 +11359,14 @@ case 533:
 	case 241: 
 	case 242: 
 	case 249: 
-#line 299 "src/vcf/vcf.ragel"
+#line 307 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in PEDIGREE metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
@@ -11353,14 +11381,14 @@ case 533:
 	case 369: 
 	case 370: 
 	case 371: 
-#line 320 "src/vcf/vcf.ragel"
+#line 328 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in pedigreeDB metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
@@ -11375,14 +11403,14 @@ case 533:
 	case 258: 
 	case 259: 
 	case 299: 
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
@@ -11423,10 +11451,10 @@ case 533:
 	case 427: 
 	case 428: 
 	case 429: 
-#line 379 "src/vcf/vcf.ragel"
+#line 387 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
-            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines,
+            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO");
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -11439,7 +11467,7 @@ case 533:
     }
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -11455,53 +11483,53 @@ case 533:
 	case 459: 
 	case 460: 
 	case 461: 
-#line 396 "src/vcf/vcf.ragel"
+#line 404 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<ChromosomeBodyError>(*this, n_lines);
         p--; {goto st520;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	break;
 	case 441: 
 	case 442: 
-#line 402 "src/vcf/vcf.ragel"
+#line 410 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new PositionBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<PositionBodyError>(*this, n_lines);
         p--; {goto st520;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	break;
 	case 443: 
 	case 444: 
-#line 408 "src/vcf/vcf.ragel"
+#line 416 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new IdBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<IdBodyError>(*this, n_lines);
         p--; {goto st520;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	break;
 	case 445: 
 	case 446: 
-#line 414 "src/vcf/vcf.ragel"
+#line 422 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new ReferenceAlleleBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<ReferenceAlleleBodyError>(*this, n_lines);
         p--; {goto st520;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	break;
@@ -11542,14 +11570,14 @@ case 533:
 	case 514: 
 	case 515: 
 	case 516: 
-#line 420 "src/vcf/vcf.ragel"
+#line 428 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new AlternateAllelesBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<AlternateAllelesBodyError>(*this, n_lines);
         p--; {goto st520;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	break;
@@ -11566,14 +11594,14 @@ case 533:
 	case 479: 
 	case 480: 
 	case 481: 
-#line 426 "src/vcf/vcf.ragel"
+#line 434 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new QualityBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<QualityBodyError>(*this, n_lines);
         p--; {goto st520;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	break;
@@ -11582,28 +11610,28 @@ case 533:
 	case 454: 
 	case 470: 
 	case 471: 
-#line 432 "src/vcf/vcf.ragel"
+#line 440 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FilterBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<FilterBodyError>(*this, n_lines);
         p--; {goto st520;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	break;
 	case 463: 
-#line 454 "src/vcf/vcf.ragel"
+#line 462 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
-        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
+        ErrorPolicy::template handle_new_error<SamplesBodyError>(*this, n_lines, message_stream.str());
         p--; {goto st520;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	break;
@@ -11617,13 +11645,13 @@ case 533:
 	case 21: 
 #line 29 "src/vcf/vcf_v41.ragel"
 	{
-        ErrorPolicy::handle_error(*this,
-                new FileformatError{n_lines, "The fileformat declaration is not 'fileformat=VCFv4.1'"});
+        ErrorPolicy::template handle_new_error<FileformatError>(*this,
+                n_lines, "The fileformat declaration is not 'fileformat=VCFv4.1'");
         p--; {goto st519;}
     }
 #line 60 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
+        ErrorPolicy::template handle_new_error<FileformatError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
@@ -11631,12 +11659,12 @@ case 533:
 	case 457: 
 #line 50 "src/vcf/vcf_v41.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FormatBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<FormatBodyError>(*this, n_lines);
         p--; {goto st520;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	break;
@@ -11659,8 +11687,11 @@ case 533:
 #line 218 "src/vcf/vcf.ragel"
 	{
         try {
-            // Handle all columns and build record
-            ParsePolicy::handle_body_line(*this);
+            // Handle all columns and build record, or get every error found in it if all of them are collected
+            auto record_errors = ParsePolicy::handle_body_line(*this);
+            for (auto &error_ptr : record_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
+            }
 
             if (record != nullptr) {
                 auto duplicated_errors = previous_records.check_duplicates(*record);
@@ -11672,11 +11703,22 @@ case 533:
             try {
                 // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
                 if (record != nullptr) {
-                    OptionalPolicy::optional_check_body_entry(*this, *record);
+                    auto collected_warnings = OptionalPolicy::optional_check_body_entry(*this, *record);
+                    for (auto &warning_ptr : collected_warnings) {
+                        ErrorPolicy::handle_warning(*this, warning_ptr.release());
+                    }
                 }
             } catch (Error *warn) {
                 ErrorPolicy::handle_warning(*this, warn);
             }
+
+            // Check the rules that span several records, which may find several warnings at once
+            if (record != nullptr) {
+                auto cross_record_warnings = OptionalPolicy::optional_check_body_records(*record);
+                for (auto &warning_ptr : cross_record_warnings) {
+                    ErrorPolicy::handle_warning(*this, warning_ptr.release());
+                }
+            }
         } catch (Error *error) {
             ErrorPolicy::handle_error(*this, error);
         }
@@ -11686,13 +11728,13 @@ case 533:
 	case 28: 
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 387 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
-            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines,
+            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO");
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -11705,7 +11747,7 @@ case 533:
     }
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -11720,73 +11762,73 @@ case 533:
 	case 81: 
 	case 82: 
 	case 83: 
-#line 252 "src/vcf/vcf.ragel"
+#line 260 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines,
-            "ALT metadata ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines,
+            "ALT metadata ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence");
         p--; {goto st519;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
 	case 104: 
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
 	case 163: 
 	case 164: 
-#line 293 "src/vcf/vcf.ragel"
+#line 301 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String");
         p--; {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
 	case 211: 
 	case 212: 
-#line 293 "src/vcf/vcf.ragel"
+#line 301 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String");
         p--; {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
@@ -11799,19 +11841,19 @@ case 533:
 	case 269: 
 	case 270: 
 	case 271: 
-#line 352 "src/vcf/vcf.ragel"
+#line 360 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)");
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
@@ -11824,94 +11866,94 @@ case 533:
 	case 279: 
 	case 280: 
 	case 281: 
-#line 357 "src/vcf/vcf.ragel"
+#line 365 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)");
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
 	case 340: 
 	case 341: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st519;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 273 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in contig metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
 	case 114: 
 	case 115: 
 	case 116: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st519;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
 	case 146: 
 	case 147: 
 	case 148: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
 	case 194: 
 	case 195: 
 	case 196: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
@@ -11921,37 +11963,37 @@ case 533:
 	case 246: 
 	case 247: 
 	case 248: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st519;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 307 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in PEDIGREE metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
 	case 260: 
 	case 261: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
@@ -11961,19 +12003,19 @@ case 533:
 	case 101: 
 	case 102: 
 	case 103: 
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st519;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
@@ -11983,19 +12025,19 @@ case 533:
 	case 134: 
 	case 135: 
 	case 136: 
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st519;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
@@ -12005,19 +12047,19 @@ case 533:
 	case 182: 
 	case 183: 
 	case 184: 
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
@@ -12027,19 +12069,19 @@ case 533:
 	case 230: 
 	case 231: 
 	case 232: 
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
@@ -12062,19 +12104,19 @@ case 533:
 	case 300: 
 	case 301: 
 	case 302: 
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
@@ -12097,19 +12139,19 @@ case 533:
 	case 327: 
 	case 328: 
 	case 329: 
-#line 373 "src/vcf/vcf.ragel"
+#line 381 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata URL is not valid");
         p--; {goto st519;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 267 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in assembly metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
@@ -12134,19 +12176,19 @@ case 533:
 	case 390: 
 	case 391: 
 	case 392: 
-#line 373 "src/vcf/vcf.ragel"
+#line 381 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata URL is not valid");
         p--; {goto st519;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 328 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in pedigreeDB metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
@@ -12156,57 +12198,57 @@ case 533:
 	case 466: 
 	case 467: 
 	case 468: 
-#line 443 "src/vcf/vcf.ragel"
+#line 451 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info key is not a sequence of alphanumeric and/or punctuation characters"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info key is not a sequence of alphanumeric and/or punctuation characters");
         p--; {goto st520;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 446 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs");
         p--; {goto st520;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	break;
 	case 469: 
-#line 448 "src/vcf/vcf.ragel"
+#line 456 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info field value is not a comma-separated list of valid strings (maybe it contains whitespaces?)"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info field value is not a comma-separated list of valid strings (maybe it contains whitespaces?)");
         p--; {goto st520;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 446 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs");
         p--; {goto st520;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	break;
 	case 458: 
-#line 461 "src/vcf/vcf.ragel"
+#line 469 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " does not start with a valid genotype";
-        ErrorPolicy::handle_error(*this, new SamplesFieldBodyError{n_lines, message_stream.str(), "GT"});
+        ErrorPolicy::template handle_new_error<SamplesFieldBodyError>(*this, n_lines, message_stream.str(), "GT");
         p--; {goto st520;}
     }
-#line 454 "src/vcf/vcf.ragel"
+#line 462 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
-        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
+        ErrorPolicy::template handle_new_error<SamplesBodyError>(*this, n_lines, message_stream.str());
         p--; {goto st520;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st520;}
     }
 	break;
@@ -12215,17 +12257,17 @@ case 533:
 	case 185: 
 #line 36 "src/vcf/vcf_v41.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "FORMAT metadata Number is not a number, A, G or dot"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "FORMAT metadata Number is not a number, A, G or dot");
         p--; {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
@@ -12234,35 +12276,35 @@ case 533:
 	case 233: 
 #line 42 "src/vcf/vcf_v41.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Number is not a number, A, G or dot"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "INFO metadata Number is not a number, A, G or dot");
         p--; {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
 	case 22: 
 #line 60 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
+        ErrorPolicy::template handle_new_error<FileformatError>(*this, n_lines);
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 387 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
-            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines,
+            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO");
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -12275,7 +12317,7 @@ case 533:
     }
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -12288,124 +12330,124 @@ case 533:
     }
 	break;
 	case 272: 
-#line 352 "src/vcf/vcf.ragel"
+#line 360 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)");
         p--; {goto st519;}
     }
-#line 357 "src/vcf/vcf.ragel"
+#line 365 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)");
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
 	case 282: 
-#line 357 "src/vcf/vcf.ragel"
+#line 365 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)");
         p--; {goto st519;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
 	case 262: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st519;}
     }
-#line 352 "src/vcf/vcf.ragel"
+#line 360 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)");
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
 	case 24: 
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st519;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st519;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 267 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in assembly metadata");
         p--; {goto st519;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 273 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in contig metadata");
         p--; {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st519;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 307 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in PEDIGREE metadata");
         p--; {goto st519;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 328 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in pedigreeDB metadata");
         p--; {goto st519;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st519;}
     }
 	break;
-#line 12409 "inc/vcf/validator_detail_v41.hpp"
+#line 12433 "inc/vcf/validator_detail_v41.hpp"
 	}
 	}
 
@@ -12415,6 +12457,14 @@ case 533:
 #line 257 "src/vcf/vcf_v41.ragel"
 
     }
+
+    template <typename Configuration>
+    std::string ParserImpl_v41<Configuration>::grammar() const
+    {
+        return grammar_fingerprint("vcf_v41", {vcf_v41_first_final, vcf_v41_en_main_meta_section,
+                                               vcf_v41_en_main_body_section, vcf_v41_en_meta_section_skip,
+                                               vcf_v41_en_body_section_skip});
+    }
    
   }
 }
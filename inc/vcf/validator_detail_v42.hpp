@@ -46,7 +46,7 @@ namespace ebi
    
     template <typename Configuration>
     ParserImpl_v42<Configuration>::ParserImpl_v42(std::shared_ptr<Source> source)
-    : ParserImpl{source}
+    : ConfiguredParserImpl<Configuration>{source}
     {
       
 #line 53 "inc/vcf/validator_detail_v42.hpp"
@@ -75,38 +75,38 @@ case 1:
 tr0:
 #line 60 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
+        ErrorPolicy::template handle_new_error<FileformatError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr14:
 #line 29 "src/vcf/vcf_v42.ragel"
 	{
-        ErrorPolicy::handle_error(*this,
-                new FileformatError{n_lines, "The fileformat declaration is not 'fileformat=VCFv4.2'"});
+        ErrorPolicy::template handle_new_error<FileformatError>(*this,
+                n_lines, "The fileformat declaration is not 'fileformat=VCFv4.2'");
         p--; {goto st591;}
     }
 #line 60 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
+        ErrorPolicy::template handle_new_error<FileformatError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr24:
 #line 60 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
+        ErrorPolicy::template handle_new_error<FileformatError>(*this, n_lines);
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 387 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
-            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines,
+            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO");
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -119,7 +119,7 @@ tr24:
     }
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -134,13 +134,13 @@ tr24:
 tr26:
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 387 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
-            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines,
+            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO");
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -153,7 +153,7 @@ tr26:
     }
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -166,794 +166,794 @@ tr26:
     }
 	goto st0;
 tr29:
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st591;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 267 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in assembly metadata");
         p--; {goto st591;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 273 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in contig metadata");
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st591;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 307 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in PEDIGREE metadata");
         p--; {goto st591;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 328 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in pedigreeDB metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr39:
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr125:
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr133:
-#line 252 "src/vcf/vcf.ragel"
+#line 260 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines,
-            "ALT metadata ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines,
+            "ALT metadata ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence");
         p--; {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr152:
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr161:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr175:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr187:
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr193:
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr196:
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr206:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr225:
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr247:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr259:
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr265:
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr275:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr288:
 #line 36 "src/vcf/vcf_v42.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "FORMAT metadata Number is not a number, A, R, G or dot"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "FORMAT metadata Number is not a number, A, R, G or dot");
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr297:
-#line 293 "src/vcf/vcf.ragel"
+#line 301 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String");
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr314:
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr336:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr348:
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr355:
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr364:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr377:
 #line 42 "src/vcf/vcf_v42.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Number is not a number, A, R, G or dot"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "INFO metadata Number is not a number, A, R, G or dot");
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr386:
-#line 293 "src/vcf/vcf.ragel"
+#line 301 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String");
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr403:
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr425:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr437:
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr444:
-#line 299 "src/vcf/vcf.ragel"
+#line 307 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in PEDIGREE metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr454:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 307 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in PEDIGREE metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr466:
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr477:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr482:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 352 "src/vcf/vcf.ragel"
+#line 360 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)");
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr484:
-#line 352 "src/vcf/vcf.ragel"
+#line 360 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)");
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr494:
-#line 352 "src/vcf/vcf.ragel"
+#line 360 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)");
         p--; {goto st591;}
     }
-#line 357 "src/vcf/vcf.ragel"
+#line 365 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)");
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr497:
-#line 357 "src/vcf/vcf.ragel"
+#line 365 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)");
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr507:
-#line 357 "src/vcf/vcf.ragel"
+#line 365 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)");
         p--; {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr510:
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr533:
-#line 259 "src/vcf/vcf.ragel"
+#line 267 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in assembly metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr542:
-#line 373 "src/vcf/vcf.ragel"
+#line 381 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata URL is not valid");
         p--; {goto st591;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 267 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in assembly metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr563:
-#line 265 "src/vcf/vcf.ragel"
+#line 273 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in contig metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr574:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 273 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in contig metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr612:
-#line 320 "src/vcf/vcf.ragel"
+#line 328 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in pedigreeDB metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr624:
-#line 373 "src/vcf/vcf.ragel"
+#line 381 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata URL is not valid");
         p--; {goto st591;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 328 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in pedigreeDB metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	goto st0;
 tr647:
-#line 379 "src/vcf/vcf.ragel"
+#line 387 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
-            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines,
+            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO");
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -966,7 +966,7 @@ tr647:
     }
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -981,7 +981,7 @@ tr647:
 tr687:
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -994,181 +994,181 @@ tr687:
     }
 	goto st0;
 tr702:
-#line 396 "src/vcf/vcf.ragel"
+#line 404 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<ChromosomeBodyError>(*this, n_lines);
         p--; {goto st592;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	goto st0;
 tr705:
-#line 402 "src/vcf/vcf.ragel"
+#line 410 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new PositionBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<PositionBodyError>(*this, n_lines);
         p--; {goto st592;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	goto st0;
 tr709:
-#line 408 "src/vcf/vcf.ragel"
+#line 416 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new IdBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<IdBodyError>(*this, n_lines);
         p--; {goto st592;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	goto st0;
 tr714:
-#line 414 "src/vcf/vcf.ragel"
+#line 422 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new ReferenceAlleleBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<ReferenceAlleleBodyError>(*this, n_lines);
         p--; {goto st592;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	goto st0;
 tr718:
-#line 420 "src/vcf/vcf.ragel"
+#line 428 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new AlternateAllelesBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<AlternateAllelesBodyError>(*this, n_lines);
         p--; {goto st592;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	goto st0;
 tr727:
-#line 426 "src/vcf/vcf.ragel"
+#line 434 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new QualityBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<QualityBodyError>(*this, n_lines);
         p--; {goto st592;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	goto st0;
 tr738:
-#line 432 "src/vcf/vcf.ragel"
+#line 440 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FilterBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<FilterBodyError>(*this, n_lines);
         p--; {goto st592;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	goto st0;
 tr746:
-#line 443 "src/vcf/vcf.ragel"
+#line 451 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info key is not a sequence of alphanumeric and/or punctuation characters"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info key is not a sequence of alphanumeric and/or punctuation characters");
         p--; {goto st592;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 446 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs");
         p--; {goto st592;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	goto st0;
 tr750:
 #line 50 "src/vcf/vcf_v42.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FormatBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<FormatBodyError>(*this, n_lines);
         p--; {goto st592;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	goto st0;
 tr755:
-#line 461 "src/vcf/vcf.ragel"
+#line 469 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " does not start with a valid genotype";
-        ErrorPolicy::handle_error(*this, new SamplesFieldBodyError{n_lines, message_stream.str(), "GT"});
+        ErrorPolicy::template handle_new_error<SamplesFieldBodyError>(*this, n_lines, message_stream.str(), "GT");
         p--; {goto st592;}
     }
-#line 454 "src/vcf/vcf.ragel"
+#line 462 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
-        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
+        ErrorPolicy::template handle_new_error<SamplesBodyError>(*this, n_lines, message_stream.str());
         p--; {goto st592;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	goto st0;
 tr763:
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	goto st0;
 tr765:
-#line 454 "src/vcf/vcf.ragel"
+#line 462 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
-        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
+        ErrorPolicy::template handle_new_error<SamplesBodyError>(*this, n_lines, message_stream.str());
         p--; {goto st592;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	goto st0;
 tr771:
-#line 448 "src/vcf/vcf.ragel"
+#line 456 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info field value is not a comma-separated list of valid strings (maybe it contains whitespaces?)"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info field value is not a comma-separated list of valid strings (maybe it contains whitespaces?)");
         p--; {goto st592;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 446 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs");
         p--; {goto st592;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	goto st0;
 tr820:
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -1179,26 +1179,26 @@ tr820:
         
         p--; {goto st592;}
     }
-#line 396 "src/vcf/vcf.ragel"
+#line 404 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<ChromosomeBodyError>(*this, n_lines);
         p--; {goto st592;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	goto st0;
 tr827:
-#line 438 "src/vcf/vcf.ragel"
+#line 446 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs");
         p--; {goto st592;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	goto st0;
@@ -1418,7 +1418,7 @@ tr22:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st22;
@@ -1551,7 +1551,7 @@ tr45:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st28;
@@ -1571,7 +1571,7 @@ tr55:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st28;
@@ -1603,7 +1603,7 @@ tr46:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st29;
@@ -1623,7 +1623,7 @@ tr56:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st29;
@@ -8657,7 +8657,7 @@ tr545:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st385;
@@ -8764,7 +8764,7 @@ tr559:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 #line 35 "src/vcf/vcf.ragel"
@@ -9834,7 +9834,7 @@ tr627:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st446;
@@ -9941,7 +9941,7 @@ tr641:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 #line 35 "src/vcf/vcf.ragel"
@@ -9989,7 +9989,7 @@ tr643:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 #line 35 "src/vcf/vcf.ragel"
@@ -10496,7 +10496,7 @@ tr685:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st593;
@@ -10516,7 +10516,7 @@ tr697:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st593;
@@ -10547,7 +10547,7 @@ tr825:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st594;
@@ -10567,7 +10567,7 @@ tr821:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st594;
@@ -10589,7 +10589,7 @@ tr826:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st511;
@@ -10609,7 +10609,7 @@ tr822:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st511;
@@ -11297,8 +11297,11 @@ tr829:
 #line 218 "src/vcf/vcf.ragel"
 	{
         try {
-            // Handle all columns and build record
-            ParsePolicy::handle_body_line(*this);
+            // Handle all columns and build record, or get every error found in it if all of them are collected
+            auto record_errors = ParsePolicy::handle_body_line(*this);
+            for (auto &error_ptr : record_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
+            }
 
             if (record != nullptr) {
                 auto duplicated_errors = previous_records.check_duplicates(*record);
@@ -11310,11 +11313,22 @@ tr829:
             try {
                 // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
                 if (record != nullptr) {
-                    OptionalPolicy::optional_check_body_entry(*this, *record);
+                    auto collected_warnings = OptionalPolicy::optional_check_body_entry(*this, *record);
+                    for (auto &warning_ptr : collected_warnings) {
+                        ErrorPolicy::handle_warning(*this, warning_ptr.release());
+                    }
                 }
             } catch (Error *warn) {
                 ErrorPolicy::handle_warning(*this, warn);
             }
+
+            // Check the rules that span several records, which may find several warnings at once
+            if (record != nullptr) {
+                auto cross_record_warnings = OptionalPolicy::optional_check_body_records(*record);
+                for (auto &warning_ptr : cross_record_warnings) {
+                    ErrorPolicy::handle_warning(*this, warning_ptr.release());
+                }
+            }
         } catch (Error *error) {
             ErrorPolicy::handle_error(*this, error);
         }
@@ -11326,7 +11340,7 @@ tr829:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st597;
@@ -11334,7 +11348,7 @@ st597:
 	if ( ++p == pe )
 		goto _test_eof597;
 case 597:
-#line 11338 "inc/vcf/validator_detail_v42.hpp"
+#line 11346 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr825;
 		case 13: goto tr826;
@@ -11363,7 +11377,7 @@ st531:
 	if ( ++p == pe )
 		goto _test_eof531;
 case 531:
-#line 11367 "inc/vcf/validator_detail_v42.hpp"
+#line 11375 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr759;
@@ -11393,7 +11407,7 @@ st532:
 	if ( ++p == pe )
 		goto _test_eof532;
 case 532:
-#line 11397 "inc/vcf/validator_detail_v42.hpp"
+#line 11405 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 59: goto tr760;
 		case 62: goto tr761;
@@ -11417,7 +11431,7 @@ st533:
 	if ( ++p == pe )
 		goto _test_eof533;
 case 533:
-#line 11421 "inc/vcf/validator_detail_v42.hpp"
+#line 11429 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 9 )
 		goto tr762;
 	goto tr702;
@@ -11433,8 +11447,11 @@ tr830:
 #line 218 "src/vcf/vcf.ragel"
 	{
         try {
-            // Handle all columns and build record
-            ParsePolicy::handle_body_line(*this);
+            // Handle all columns and build record, or get every error found in it if all of them are collected
+            auto record_errors = ParsePolicy::handle_body_line(*this);
+            for (auto &error_ptr : record_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
+            }
 
             if (record != nullptr) {
                 auto duplicated_errors = previous_records.check_duplicates(*record);
@@ -11446,11 +11463,22 @@ tr830:
             try {
                 // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
                 if (record != nullptr) {
-                    OptionalPolicy::optional_check_body_entry(*this, *record);
+                    auto collected_warnings = OptionalPolicy::optional_check_body_entry(*this, *record);
+                    for (auto &warning_ptr : collected_warnings) {
+                        ErrorPolicy::handle_warning(*this, warning_ptr.release());
+                    }
                 }
             } catch (Error *warn) {
                 ErrorPolicy::handle_warning(*this, warn);
             }
+
+            // Check the rules that span several records, which may find several warnings at once
+            if (record != nullptr) {
+                auto cross_record_warnings = OptionalPolicy::optional_check_body_records(*record);
+                for (auto &warning_ptr : cross_record_warnings) {
+                    ErrorPolicy::handle_warning(*this, warning_ptr.release());
+                }
+            }
         } catch (Error *error) {
             ErrorPolicy::handle_error(*this, error);
         }
@@ -11462,7 +11490,7 @@ tr830:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st534;
@@ -11470,7 +11498,7 @@ st534:
 	if ( ++p == pe )
 		goto _test_eof534;
 case 534:
-#line 11474 "inc/vcf/validator_detail_v42.hpp"
+#line 11490 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 10 )
 		goto st597;
 	goto tr763;
@@ -11484,7 +11512,7 @@ st535:
 	if ( ++p == pe )
 		goto _test_eof535;
 case 535:
-#line 11488 "inc/vcf/validator_detail_v42.hpp"
+#line 11504 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) > 57 ) {
 		if ( 59 <= (*p) && (*p) <= 126 )
 			goto tr766;
@@ -11511,7 +11539,7 @@ st598:
 	if ( ++p == pe )
 		goto _test_eof598;
 case 598:
-#line 11515 "inc/vcf/validator_detail_v42.hpp"
+#line 11531 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr752;
 		case 10: goto tr829;
@@ -11533,7 +11561,7 @@ st599:
 	if ( ++p == pe )
 		goto _test_eof599;
 case 599:
-#line 11537 "inc/vcf/validator_detail_v42.hpp"
+#line 11553 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr752;
 		case 10: goto tr829;
@@ -11570,7 +11598,7 @@ st600:
 	if ( ++p == pe )
 		goto _test_eof600;
 case 600:
-#line 11574 "inc/vcf/validator_detail_v42.hpp"
+#line 11590 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr752;
 		case 10: goto tr829;
@@ -11602,7 +11630,7 @@ st536:
 	if ( ++p == pe )
 		goto _test_eof536;
 case 536:
-#line 11606 "inc/vcf/validator_detail_v42.hpp"
+#line 11622 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 48 )
 		goto tr767;
 	goto tr746;
@@ -11616,7 +11644,7 @@ st537:
 	if ( ++p == pe )
 		goto _test_eof537;
 case 537:
-#line 11620 "inc/vcf/validator_detail_v42.hpp"
+#line 11636 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 48 )
 		goto tr768;
 	goto tr746;
@@ -11630,7 +11658,7 @@ st538:
 	if ( ++p == pe )
 		goto _test_eof538;
 case 538:
-#line 11634 "inc/vcf/validator_detail_v42.hpp"
+#line 11650 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 48 )
 		goto tr769;
 	goto tr746;
@@ -11644,7 +11672,7 @@ st539:
 	if ( ++p == pe )
 		goto _test_eof539;
 case 539:
-#line 11648 "inc/vcf/validator_detail_v42.hpp"
+#line 11664 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 71 )
 		goto tr770;
 	goto tr746;
@@ -11658,7 +11686,7 @@ st601:
 	if ( ++p == pe )
 		goto _test_eof601;
 case 601:
-#line 11662 "inc/vcf/validator_detail_v42.hpp"
+#line 11678 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr828;
 		case 10: goto tr829;
@@ -11677,7 +11705,7 @@ st540:
 	if ( ++p == pe )
 		goto _test_eof540;
 case 540:
-#line 11681 "inc/vcf/validator_detail_v42.hpp"
+#line 11697 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 49: goto tr748;
 		case 95: goto tr749;
@@ -11708,7 +11736,7 @@ st602:
 	if ( ++p == pe )
 		goto _test_eof602;
 case 602:
-#line 11712 "inc/vcf/validator_detail_v42.hpp"
+#line 11728 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr828;
 		case 10: goto tr829;
@@ -11737,7 +11765,7 @@ st541:
 	if ( ++p == pe )
 		goto _test_eof541;
 case 541:
-#line 11741 "inc/vcf/validator_detail_v42.hpp"
+#line 11757 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) > 58 ) {
 		if ( 60 <= (*p) && (*p) <= 126 )
 			goto tr772;
@@ -11754,7 +11782,7 @@ st603:
 	if ( ++p == pe )
 		goto _test_eof603;
 case 603:
-#line 11758 "inc/vcf/validator_detail_v42.hpp"
+#line 11774 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr828;
 		case 10: goto tr829;
@@ -11774,7 +11802,7 @@ st542:
 	if ( ++p == pe )
 		goto _test_eof542;
 case 542:
-#line 11778 "inc/vcf/validator_detail_v42.hpp"
+#line 11794 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 58 )
 		goto tr739;
 	if ( (*p) < 65 ) {
@@ -11812,7 +11840,7 @@ st543:
 	if ( ++p == pe )
 		goto _test_eof543;
 case 543:
-#line 11816 "inc/vcf/validator_detail_v42.hpp"
+#line 11832 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr744;
 		case 58: goto st525;
@@ -11848,7 +11876,7 @@ st544:
 	if ( ++p == pe )
 		goto _test_eof544;
 case 544:
-#line 11852 "inc/vcf/validator_detail_v42.hpp"
+#line 11868 "inc/vcf/validator_detail_v42.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr773;
 	goto tr727;
@@ -11862,7 +11890,7 @@ st545:
 	if ( ++p == pe )
 		goto _test_eof545;
 case 545:
-#line 11866 "inc/vcf/validator_detail_v42.hpp"
+#line 11882 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr735;
 		case 69: goto tr737;
@@ -11881,7 +11909,7 @@ st546:
 	if ( ++p == pe )
 		goto _test_eof546;
 case 546:
-#line 11885 "inc/vcf/validator_detail_v42.hpp"
+#line 11901 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 43: goto tr774;
 		case 45: goto tr774;
@@ -11899,7 +11927,7 @@ st547:
 	if ( ++p == pe )
 		goto _test_eof547;
 case 547:
-#line 11903 "inc/vcf/validator_detail_v42.hpp"
+#line 11919 "inc/vcf/validator_detail_v42.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr775;
 	goto tr727;
@@ -11913,7 +11941,7 @@ st548:
 	if ( ++p == pe )
 		goto _test_eof548;
 case 548:
-#line 11917 "inc/vcf/validator_detail_v42.hpp"
+#line 11933 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 9 )
 		goto tr735;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -11939,7 +11967,7 @@ st549:
 	if ( ++p == pe )
 		goto _test_eof549;
 case 549:
-#line 11943 "inc/vcf/validator_detail_v42.hpp"
+#line 11959 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 110 )
 		goto tr776;
 	goto tr727;
@@ -11953,7 +11981,7 @@ st550:
 	if ( ++p == pe )
 		goto _test_eof550;
 case 550:
-#line 11957 "inc/vcf/validator_detail_v42.hpp"
+#line 11973 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 102 )
 		goto tr777;
 	goto tr727;
@@ -11977,7 +12005,7 @@ st551:
 	if ( ++p == pe )
 		goto _test_eof551;
 case 551:
-#line 11981 "inc/vcf/validator_detail_v42.hpp"
+#line 11997 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 9 )
 		goto tr735;
 	goto tr727;
@@ -11995,7 +12023,7 @@ st552:
 	if ( ++p == pe )
 		goto _test_eof552;
 case 552:
-#line 11999 "inc/vcf/validator_detail_v42.hpp"
+#line 12015 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 97 )
 		goto tr778;
 	goto tr727;
@@ -12009,7 +12037,7 @@ st553:
 	if ( ++p == pe )
 		goto _test_eof553;
 case 553:
-#line 12013 "inc/vcf/validator_detail_v42.hpp"
+#line 12029 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 78 )
 		goto tr777;
 	goto tr727;
@@ -12023,7 +12051,7 @@ st554:
 	if ( ++p == pe )
 		goto _test_eof554;
 case 554:
-#line 12027 "inc/vcf/validator_detail_v42.hpp"
+#line 12043 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 42: goto tr719;
 		case 46: goto tr779;
@@ -12062,7 +12090,7 @@ st555:
 	if ( ++p == pe )
 		goto _test_eof555;
 case 555:
-#line 12066 "inc/vcf/validator_detail_v42.hpp"
+#line 12082 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 65: goto tr780;
 		case 67: goto tr780;
@@ -12086,7 +12114,7 @@ st556:
 	if ( ++p == pe )
 		goto _test_eof556;
 case 556:
-#line 12090 "inc/vcf/validator_detail_v42.hpp"
+#line 12106 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr725;
 		case 44: goto tr726;
@@ -12122,7 +12150,7 @@ st557:
 	if ( ++p == pe )
 		goto _test_eof557;
 case 557:
-#line 12126 "inc/vcf/validator_detail_v42.hpp"
+#line 12142 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 61 )
 		goto tr781;
 	if ( (*p) < 63 ) {
@@ -12162,7 +12190,7 @@ st558:
 	if ( ++p == pe )
 		goto _test_eof558;
 case 558:
-#line 12166 "inc/vcf/validator_detail_v42.hpp"
+#line 12182 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 62 )
 		goto tr783;
 	if ( (*p) < 45 ) {
@@ -12194,7 +12222,7 @@ st559:
 	if ( ++p == pe )
 		goto _test_eof559;
 case 559:
-#line 12198 "inc/vcf/validator_detail_v42.hpp"
+#line 12214 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr725;
 		case 44: goto tr726;
@@ -12223,7 +12251,7 @@ st560:
 	if ( ++p == pe )
 		goto _test_eof560;
 case 560:
-#line 12227 "inc/vcf/validator_detail_v42.hpp"
+#line 12243 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 60 )
 		goto tr788;
 	if ( (*p) < 65 ) {
@@ -12245,7 +12273,7 @@ st561:
 	if ( ++p == pe )
 		goto _test_eof561;
 case 561:
-#line 12249 "inc/vcf/validator_detail_v42.hpp"
+#line 12265 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 58: goto tr789;
 		case 61: goto tr787;
@@ -12269,7 +12297,7 @@ st562:
 	if ( ++p == pe )
 		goto _test_eof562;
 case 562:
-#line 12273 "inc/vcf/validator_detail_v42.hpp"
+#line 12289 "inc/vcf/validator_detail_v42.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr790;
 	goto tr718;
@@ -12283,7 +12311,7 @@ st563:
 	if ( ++p == pe )
 		goto _test_eof563;
 case 563:
-#line 12287 "inc/vcf/validator_detail_v42.hpp"
+#line 12303 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 91 )
 		goto tr783;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -12299,7 +12327,7 @@ st564:
 	if ( ++p == pe )
 		goto _test_eof564;
 case 564:
-#line 12303 "inc/vcf/validator_detail_v42.hpp"
+#line 12319 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr791;
@@ -12319,7 +12347,7 @@ st565:
 	if ( ++p == pe )
 		goto _test_eof565;
 case 565:
-#line 12323 "inc/vcf/validator_detail_v42.hpp"
+#line 12339 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 59: goto tr791;
 		case 62: goto tr792;
@@ -12343,7 +12371,7 @@ st566:
 	if ( ++p == pe )
 		goto _test_eof566;
 case 566:
-#line 12347 "inc/vcf/validator_detail_v42.hpp"
+#line 12363 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 58 )
 		goto tr789;
 	goto tr718;
@@ -12357,7 +12385,7 @@ st567:
 	if ( ++p == pe )
 		goto _test_eof567;
 case 567:
-#line 12361 "inc/vcf/validator_detail_v42.hpp"
+#line 12377 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 60 )
 		goto tr794;
 	if ( (*p) < 65 ) {
@@ -12379,7 +12407,7 @@ st568:
 	if ( ++p == pe )
 		goto _test_eof568;
 case 568:
-#line 12383 "inc/vcf/validator_detail_v42.hpp"
+#line 12399 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 58: goto tr795;
 		case 61: goto tr793;
@@ -12403,7 +12431,7 @@ st569:
 	if ( ++p == pe )
 		goto _test_eof569;
 case 569:
-#line 12407 "inc/vcf/validator_detail_v42.hpp"
+#line 12423 "inc/vcf/validator_detail_v42.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr796;
 	goto tr718;
@@ -12417,7 +12445,7 @@ st570:
 	if ( ++p == pe )
 		goto _test_eof570;
 case 570:
-#line 12421 "inc/vcf/validator_detail_v42.hpp"
+#line 12437 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 93 )
 		goto tr783;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -12433,7 +12461,7 @@ st571:
 	if ( ++p == pe )
 		goto _test_eof571;
 case 571:
-#line 12437 "inc/vcf/validator_detail_v42.hpp"
+#line 12453 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr797;
@@ -12453,7 +12481,7 @@ st572:
 	if ( ++p == pe )
 		goto _test_eof572;
 case 572:
-#line 12457 "inc/vcf/validator_detail_v42.hpp"
+#line 12473 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 59: goto tr797;
 		case 62: goto tr798;
@@ -12477,7 +12505,7 @@ st573:
 	if ( ++p == pe )
 		goto _test_eof573;
 case 573:
-#line 12481 "inc/vcf/validator_detail_v42.hpp"
+#line 12497 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 58 )
 		goto tr795;
 	goto tr718;
@@ -12495,7 +12523,7 @@ st574:
 	if ( ++p == pe )
 		goto _test_eof574;
 case 574:
-#line 12499 "inc/vcf/validator_detail_v42.hpp"
+#line 12515 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 60 )
 		goto tr800;
 	if ( (*p) < 65 ) {
@@ -12517,7 +12545,7 @@ st575:
 	if ( ++p == pe )
 		goto _test_eof575;
 case 575:
-#line 12521 "inc/vcf/validator_detail_v42.hpp"
+#line 12537 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 58: goto tr801;
 		case 61: goto tr799;
@@ -12541,7 +12569,7 @@ st576:
 	if ( ++p == pe )
 		goto _test_eof576;
 case 576:
-#line 12545 "inc/vcf/validator_detail_v42.hpp"
+#line 12561 "inc/vcf/validator_detail_v42.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr802;
 	goto tr718;
@@ -12555,7 +12583,7 @@ st577:
 	if ( ++p == pe )
 		goto _test_eof577;
 case 577:
-#line 12559 "inc/vcf/validator_detail_v42.hpp"
+#line 12575 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 91 )
 		goto tr803;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -12571,7 +12599,7 @@ st578:
 	if ( ++p == pe )
 		goto _test_eof578;
 case 578:
-#line 12575 "inc/vcf/validator_detail_v42.hpp"
+#line 12591 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr804;
@@ -12591,7 +12619,7 @@ st579:
 	if ( ++p == pe )
 		goto _test_eof579;
 case 579:
-#line 12595 "inc/vcf/validator_detail_v42.hpp"
+#line 12611 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 59: goto tr804;
 		case 62: goto tr805;
@@ -12615,7 +12643,7 @@ st580:
 	if ( ++p == pe )
 		goto _test_eof580;
 case 580:
-#line 12619 "inc/vcf/validator_detail_v42.hpp"
+#line 12635 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 58 )
 		goto tr801;
 	goto tr718;
@@ -12633,7 +12661,7 @@ st581:
 	if ( ++p == pe )
 		goto _test_eof581;
 case 581:
-#line 12637 "inc/vcf/validator_detail_v42.hpp"
+#line 12653 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 60 )
 		goto tr807;
 	if ( (*p) < 65 ) {
@@ -12655,7 +12683,7 @@ st582:
 	if ( ++p == pe )
 		goto _test_eof582;
 case 582:
-#line 12659 "inc/vcf/validator_detail_v42.hpp"
+#line 12675 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 58: goto tr808;
 		case 61: goto tr806;
@@ -12679,7 +12707,7 @@ st583:
 	if ( ++p == pe )
 		goto _test_eof583;
 case 583:
-#line 12683 "inc/vcf/validator_detail_v42.hpp"
+#line 12699 "inc/vcf/validator_detail_v42.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr809;
 	goto tr718;
@@ -12693,7 +12721,7 @@ st584:
 	if ( ++p == pe )
 		goto _test_eof584;
 case 584:
-#line 12697 "inc/vcf/validator_detail_v42.hpp"
+#line 12713 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 93 )
 		goto tr803;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -12709,7 +12737,7 @@ st585:
 	if ( ++p == pe )
 		goto _test_eof585;
 case 585:
-#line 12713 "inc/vcf/validator_detail_v42.hpp"
+#line 12729 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr810;
@@ -12729,7 +12757,7 @@ st586:
 	if ( ++p == pe )
 		goto _test_eof586;
 case 586:
-#line 12733 "inc/vcf/validator_detail_v42.hpp"
+#line 12749 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 59: goto tr810;
 		case 62: goto tr811;
@@ -12753,7 +12781,7 @@ st587:
 	if ( ++p == pe )
 		goto _test_eof587;
 case 587:
-#line 12757 "inc/vcf/validator_detail_v42.hpp"
+#line 12773 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 58 )
 		goto tr808;
 	goto tr718;
@@ -12771,7 +12799,7 @@ st588:
 	if ( ++p == pe )
 		goto _test_eof588;
 case 588:
-#line 12775 "inc/vcf/validator_detail_v42.hpp"
+#line 12791 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr725;
 		case 65: goto tr780;
@@ -12798,7 +12826,7 @@ tr686:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st589;
@@ -12818,7 +12846,7 @@ tr698:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st589;
@@ -12826,7 +12854,7 @@ st589:
 	if ( ++p == pe )
 		goto _test_eof589;
 case 589:
-#line 12830 "inc/vcf/validator_detail_v42.hpp"
+#line 12846 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 10 )
 		goto st593;
 	goto tr687;
@@ -12847,7 +12875,7 @@ tr23:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st590;
@@ -12855,7 +12883,7 @@ st590:
 	if ( ++p == pe )
 		goto _test_eof590;
 case 590:
-#line 12859 "inc/vcf/validator_detail_v42.hpp"
+#line 12875 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 10 )
 		goto st22;
 	goto tr0;
@@ -12867,7 +12895,7 @@ tr816:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st591;
@@ -12875,7 +12903,7 @@ st591:
 	if ( ++p == pe )
 		goto _test_eof591;
 case 591:
-#line 12879 "inc/vcf/validator_detail_v42.hpp"
+#line 12895 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr815;
 		case 13: goto tr816;
@@ -12889,7 +12917,7 @@ tr815:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 #line 231 "src/vcf/vcf_v42.ragel"
@@ -12899,7 +12927,7 @@ st604:
 	if ( ++p == pe )
 		goto _test_eof604;
 case 604:
-#line 12903 "inc/vcf/validator_detail_v42.hpp"
+#line 12919 "inc/vcf/validator_detail_v42.hpp"
 	goto st0;
 tr819:
 #line 43 "src/vcf/vcf.ragel"
@@ -12909,7 +12937,7 @@ tr819:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st592;
@@ -12917,7 +12945,7 @@ st592:
 	if ( ++p == pe )
 		goto _test_eof592;
 case 592:
-#line 12921 "inc/vcf/validator_detail_v42.hpp"
+#line 12937 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr818;
 		case 13: goto tr819;
@@ -12931,7 +12959,7 @@ tr818:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 #line 232 "src/vcf/vcf_v42.ragel"
@@ -12941,7 +12969,7 @@ st605:
 	if ( ++p == pe )
 		goto _test_eof605;
 case 605:
-#line 12945 "inc/vcf/validator_detail_v42.hpp"
+#line 12961 "inc/vcf/validator_detail_v42.hpp"
 	goto st0;
 	}
 	_test_eof2: cs = 2; goto _test_eof; 
@@ -13569,7 +13597,7 @@ case 605:
 	case 590: 
 #line 60 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
+        ErrorPolicy::template handle_new_error<FileformatError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -13623,7 +13651,7 @@ case 605:
 	case 73: 
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -13649,7 +13677,7 @@ case 605:
 	case 589: 
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -13664,7 +13692,7 @@ case 605:
 	case 534: 
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	break;
@@ -13690,14 +13718,14 @@ case 605:
 	case 96: 
 	case 103: 
 	case 114: 
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -13709,14 +13737,14 @@ case 605:
 	case 380: 
 	case 381: 
 	case 382: 
-#line 259 "src/vcf/vcf.ragel"
+#line 267 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in assembly metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -13749,14 +13777,14 @@ case 605:
 	case 430: 
 	case 431: 
 	case 432: 
-#line 265 "src/vcf/vcf.ragel"
+#line 273 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in contig metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -13784,14 +13812,14 @@ case 605:
 	case 147: 
 	case 154: 
 	case 165: 
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -13831,14 +13859,14 @@ case 605:
 	case 213: 
 	case 220: 
 	case 231: 
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -13877,14 +13905,14 @@ case 605:
 	case 279: 
 	case 286: 
 	case 297: 
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -13898,14 +13926,14 @@ case 605:
 	case 313: 
 	case 314: 
 	case 321: 
-#line 299 "src/vcf/vcf.ragel"
+#line 307 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in PEDIGREE metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -13920,14 +13948,14 @@ case 605:
 	case 441: 
 	case 442: 
 	case 443: 
-#line 320 "src/vcf/vcf.ragel"
+#line 328 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in pedigreeDB metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -13942,14 +13970,14 @@ case 605:
 	case 330: 
 	case 331: 
 	case 371: 
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -13990,10 +14018,10 @@ case 605:
 	case 499: 
 	case 500: 
 	case 501: 
-#line 379 "src/vcf/vcf.ragel"
+#line 387 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
-            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines,
+            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO");
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -14006,7 +14034,7 @@ case 605:
     }
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -14022,53 +14050,53 @@ case 605:
 	case 531: 
 	case 532: 
 	case 533: 
-#line 396 "src/vcf/vcf.ragel"
+#line 404 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<ChromosomeBodyError>(*this, n_lines);
         p--; {goto st592;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	break;
 	case 513: 
 	case 514: 
-#line 402 "src/vcf/vcf.ragel"
+#line 410 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new PositionBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<PositionBodyError>(*this, n_lines);
         p--; {goto st592;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	break;
 	case 515: 
 	case 516: 
-#line 408 "src/vcf/vcf.ragel"
+#line 416 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new IdBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<IdBodyError>(*this, n_lines);
         p--; {goto st592;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	break;
 	case 517: 
 	case 518: 
-#line 414 "src/vcf/vcf.ragel"
+#line 422 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new ReferenceAlleleBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<ReferenceAlleleBodyError>(*this, n_lines);
         p--; {goto st592;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	break;
@@ -14109,14 +14137,14 @@ case 605:
 	case 586: 
 	case 587: 
 	case 588: 
-#line 420 "src/vcf/vcf.ragel"
+#line 428 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new AlternateAllelesBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<AlternateAllelesBodyError>(*this, n_lines);
         p--; {goto st592;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	break;
@@ -14133,14 +14161,14 @@ case 605:
 	case 551: 
 	case 552: 
 	case 553: 
-#line 426 "src/vcf/vcf.ragel"
+#line 434 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new QualityBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<QualityBodyError>(*this, n_lines);
         p--; {goto st592;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	break;
@@ -14149,28 +14177,28 @@ case 605:
 	case 526: 
 	case 542: 
 	case 543: 
-#line 432 "src/vcf/vcf.ragel"
+#line 440 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FilterBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<FilterBodyError>(*this, n_lines);
         p--; {goto st592;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	break;
 	case 535: 
-#line 454 "src/vcf/vcf.ragel"
+#line 462 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
-        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
+        ErrorPolicy::template handle_new_error<SamplesBodyError>(*this, n_lines, message_stream.str());
         p--; {goto st592;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	break;
@@ -14184,13 +14212,13 @@ case 605:
 	case 21: 
 #line 29 "src/vcf/vcf_v42.ragel"
 	{
-        ErrorPolicy::handle_error(*this,
-                new FileformatError{n_lines, "The fileformat declaration is not 'fileformat=VCFv4.2'"});
+        ErrorPolicy::template handle_new_error<FileformatError>(*this,
+                n_lines, "The fileformat declaration is not 'fileformat=VCFv4.2'");
         p--; {goto st591;}
     }
 #line 60 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
+        ErrorPolicy::template handle_new_error<FileformatError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -14198,12 +14226,12 @@ case 605:
 	case 529: 
 #line 50 "src/vcf/vcf_v42.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FormatBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<FormatBodyError>(*this, n_lines);
         p--; {goto st592;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	break;
@@ -14226,8 +14254,11 @@ case 605:
 #line 218 "src/vcf/vcf.ragel"
 	{
         try {
-            // Handle all columns and build record
-            ParsePolicy::handle_body_line(*this);
+            // Handle all columns and build record, or get every error found in it if all of them are collected
+            auto record_errors = ParsePolicy::handle_body_line(*this);
+            for (auto &error_ptr : record_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
+            }
 
             if (record != nullptr) {
                 auto duplicated_errors = previous_records.check_duplicates(*record);
@@ -14239,11 +14270,22 @@ case 605:
             try {
                 // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
                 if (record != nullptr) {
-                    OptionalPolicy::optional_check_body_entry(*this, *record);
+                    auto collected_warnings = OptionalPolicy::optional_check_body_entry(*this, *record);
+                    for (auto &warning_ptr : collected_warnings) {
+                        ErrorPolicy::handle_warning(*this, warning_ptr.release());
+                    }
                 }
             } catch (Error *warn) {
                 ErrorPolicy::handle_warning(*this, warn);
             }
+
+            // Check the rules that span several records, which may find several warnings at once
+            if (record != nullptr) {
+                auto cross_record_warnings = OptionalPolicy::optional_check_body_records(*record);
+                for (auto &warning_ptr : cross_record_warnings) {
+                    ErrorPolicy::handle_warning(*this, warning_ptr.release());
+                }
+            }
         } catch (Error *error) {
             ErrorPolicy::handle_error(*this, error);
         }
@@ -14253,13 +14295,13 @@ case 605:
 	case 28: 
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 387 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
-            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines,
+            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO");
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -14272,7 +14314,7 @@ case 605:
     }
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -14287,73 +14329,73 @@ case 605:
 	case 81: 
 	case 82: 
 	case 83: 
-#line 252 "src/vcf/vcf.ragel"
+#line 260 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines,
-            "ALT metadata ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines,
+            "ALT metadata ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence");
         p--; {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
 	case 122: 
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
 	case 199: 
 	case 200: 
-#line 293 "src/vcf/vcf.ragel"
+#line 301 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String");
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
 	case 265: 
 	case 266: 
-#line 293 "src/vcf/vcf.ragel"
+#line 301 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String");
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -14366,19 +14408,19 @@ case 605:
 	case 341: 
 	case 342: 
 	case 343: 
-#line 352 "src/vcf/vcf.ragel"
+#line 360 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)");
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -14391,56 +14433,56 @@ case 605:
 	case 351: 
 	case 352: 
 	case 353: 
-#line 357 "src/vcf/vcf.ragel"
+#line 365 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)");
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
 	case 100: 
 	case 101: 
 	case 102: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
 	case 412: 
 	case 413: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 273 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in contig metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -14450,19 +14492,19 @@ case 605:
 	case 151: 
 	case 152: 
 	case 153: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -14472,19 +14514,19 @@ case 605:
 	case 217: 
 	case 218: 
 	case 219: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -14494,19 +14536,19 @@ case 605:
 	case 283: 
 	case 284: 
 	case 285: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -14516,37 +14558,37 @@ case 605:
 	case 318: 
 	case 319: 
 	case 320: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 307 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in PEDIGREE metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
 	case 332: 
 	case 333: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -14564,19 +14606,19 @@ case 605:
 	case 116: 
 	case 120: 
 	case 121: 
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -14594,19 +14636,19 @@ case 605:
 	case 167: 
 	case 171: 
 	case 172: 
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -14624,19 +14666,19 @@ case 605:
 	case 233: 
 	case 237: 
 	case 238: 
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -14654,19 +14696,19 @@ case 605:
 	case 299: 
 	case 303: 
 	case 304: 
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -14689,19 +14731,19 @@ case 605:
 	case 372: 
 	case 373: 
 	case 374: 
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -14724,19 +14766,19 @@ case 605:
 	case 399: 
 	case 400: 
 	case 401: 
-#line 373 "src/vcf/vcf.ragel"
+#line 381 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata URL is not valid");
         p--; {goto st591;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 267 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in assembly metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -14761,19 +14803,19 @@ case 605:
 	case 462: 
 	case 463: 
 	case 464: 
-#line 373 "src/vcf/vcf.ragel"
+#line 381 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata URL is not valid");
         p--; {goto st591;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 328 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in pedigreeDB metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -14783,57 +14825,57 @@ case 605:
 	case 538: 
 	case 539: 
 	case 540: 
-#line 443 "src/vcf/vcf.ragel"
+#line 451 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info key is not a sequence of alphanumeric and/or punctuation characters"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info key is not a sequence of alphanumeric and/or punctuation characters");
         p--; {goto st592;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 446 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs");
         p--; {goto st592;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	break;
 	case 541: 
-#line 448 "src/vcf/vcf.ragel"
+#line 456 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info field value is not a comma-separated list of valid strings (maybe it contains whitespaces?)"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info field value is not a comma-separated list of valid strings (maybe it contains whitespaces?)");
         p--; {goto st592;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 446 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs");
         p--; {goto st592;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	break;
 	case 530: 
-#line 461 "src/vcf/vcf.ragel"
+#line 469 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " does not start with a valid genotype";
-        ErrorPolicy::handle_error(*this, new SamplesFieldBodyError{n_lines, message_stream.str(), "GT"});
+        ErrorPolicy::template handle_new_error<SamplesFieldBodyError>(*this, n_lines, message_stream.str(), "GT");
         p--; {goto st592;}
     }
-#line 454 "src/vcf/vcf.ragel"
+#line 462 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
-        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
+        ErrorPolicy::template handle_new_error<SamplesBodyError>(*this, n_lines, message_stream.str());
         p--; {goto st592;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st592;}
     }
 	break;
@@ -14842,17 +14884,17 @@ case 605:
 	case 239: 
 #line 36 "src/vcf/vcf_v42.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "FORMAT metadata Number is not a number, A, R, G or dot"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "FORMAT metadata Number is not a number, A, R, G or dot");
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
@@ -14861,35 +14903,35 @@ case 605:
 	case 305: 
 #line 42 "src/vcf/vcf_v42.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Number is not a number, A, R, G or dot"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "INFO metadata Number is not a number, A, R, G or dot");
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
 	case 22: 
 #line 60 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
+        ErrorPolicy::template handle_new_error<FileformatError>(*this, n_lines);
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 387 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
-            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines,
+            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO");
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -14902,7 +14944,7 @@ case 605:
     }
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -14915,316 +14957,316 @@ case 605:
     }
 	break;
 	case 344: 
-#line 352 "src/vcf/vcf.ragel"
+#line 360 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)");
         p--; {goto st591;}
     }
-#line 357 "src/vcf/vcf.ragel"
+#line 365 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)");
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
 	case 354: 
-#line 357 "src/vcf/vcf.ragel"
+#line 365 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)");
         p--; {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
 	case 334: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 352 "src/vcf/vcf.ragel"
+#line 360 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)");
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
 	case 108: 
 	case 109: 
 	case 110: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
 	case 159: 
 	case 160: 
 	case 161: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
 	case 225: 
 	case 226: 
 	case 227: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
 	case 291: 
 	case 292: 
 	case 293: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
 	case 117: 
 	case 118: 
 	case 119: 
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
 	case 168: 
 	case 169: 
 	case 170: 
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
 	case 234: 
 	case 235: 
 	case 236: 
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
 	case 300: 
 	case 301: 
 	case 302: 
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st591;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
 	case 24: 
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st591;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 267 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in assembly metadata");
         p--; {goto st591;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 273 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in contig metadata");
         p--; {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st591;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 307 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in PEDIGREE metadata");
         p--; {goto st591;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 328 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in pedigreeDB metadata");
         p--; {goto st591;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st591;}
     }
 	break;
-#line 15228 "inc/vcf/validator_detail_v42.hpp"
+#line 15252 "inc/vcf/validator_detail_v42.hpp"
 	}
 	}
 
@@ -15234,6 +15276,14 @@ case 605:
 #line 261 "src/vcf/vcf_v42.ragel"
 
     }
+
+    template <typename Configuration>
+    std::string ParserImpl_v42<Configuration>::grammar() const
+    {
+        return grammar_fingerprint("vcf_v42", {vcf_v42_first_final, vcf_v42_en_main_meta_section,
+                                               vcf_v42_en_main_body_section, vcf_v42_en_meta_section_skip,
+                                               vcf_v42_en_body_section_skip});
+    }
    
   }
 }
@@ -46,7 +46,7 @@ namespace ebi
     
     template <typename Configuration>
     ParserImpl_v43<Configuration>::ParserImpl_v43(std::shared_ptr<Source> source)
-    : ParserImpl{source}
+    : ConfiguredParserImpl<Configuration>{source}
     {
       
 #line 53 "inc/vcf/validator_detail_v43.hpp"
@@ -75,38 +75,38 @@ case 1:
 tr0:
 #line 60 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
+        ErrorPolicy::template handle_new_error<FileformatError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr14:
 #line 29 "src/vcf/vcf_v43.ragel"
 	{
-        ErrorPolicy::handle_error(*this,
-                new FileformatError{n_lines, "The fileformat declaration is not 'fileformat=VCFv4.3'"});
+        ErrorPolicy::template handle_new_error<FileformatError>(*this,
+                n_lines, "The fileformat declaration is not 'fileformat=VCFv4.3'");
         p--; {goto st659;}
     }
 #line 60 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
+        ErrorPolicy::template handle_new_error<FileformatError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr24:
 #line 60 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
+        ErrorPolicy::template handle_new_error<FileformatError>(*this, n_lines);
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 387 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
-            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines,
+            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO");
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -119,7 +119,7 @@ tr24:
     }
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -134,13 +134,13 @@ tr24:
 tr26:
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 387 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
-            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines,
+            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO");
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -153,7 +153,7 @@ tr26:
     }
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -166,813 +166,813 @@ tr26:
     }
 	goto st0;
 tr29:
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st659;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st659;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 267 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in assembly metadata");
         p--; {goto st659;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 273 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in contig metadata");
         p--; {goto st659;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 334 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in META metadata");
         p--; {goto st659;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st659;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 307 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in PEDIGREE metadata");
         p--; {goto st659;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 328 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in pedigreeDB metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr40:
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr126:
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr134:
-#line 252 "src/vcf/vcf.ragel"
+#line 260 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines,
-            "ALT metadata ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines,
+            "ALT metadata ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence");
         p--; {goto st659;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr153:
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st659;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr162:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr176:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st659;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr188:
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st659;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr194:
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr197:
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr207:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr226:
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st659;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr248:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st659;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr260:
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st659;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr266:
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr276:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr289:
 #line 36 "src/vcf/vcf_v43.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "FORMAT metadata Number is not a number, A, R, G or dot"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "FORMAT metadata Number is not a number, A, R, G or dot");
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr298:
-#line 293 "src/vcf/vcf.ragel"
+#line 301 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String");
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr315:
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr337:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr349:
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st659;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr356:
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr365:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr378:
 #line 42 "src/vcf/vcf_v43.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Number is not a number, A, R, G or dot"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "INFO metadata Number is not a number, A, R, G or dot");
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr387:
-#line 293 "src/vcf/vcf.ragel"
+#line 301 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String");
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr404:
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr426:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr438:
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st659;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr445:
-#line 326 "src/vcf/vcf.ragel"
+#line 334 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in META metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr454:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 334 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in META metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr467:
-#line 331 "src/vcf/vcf.ragel"
+#line 339 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "META metadata Number is not a dot"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "META metadata Number is not a dot");
         p--; {goto st659;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 334 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in META metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr475:
-#line 336 "src/vcf/vcf.ragel"
+#line 344 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "META metadata Type is not String"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "META metadata Type is not String");
         p--; {goto st659;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 334 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in META metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr492:
-#line 341 "src/vcf/vcf.ragel"
+#line 349 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "META metadata Values is not a square-bracket delimited list of values"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "META metadata Values is not a square-bracket delimited list of values");
         p--; {goto st659;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 334 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in META metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr498:
-#line 299 "src/vcf/vcf.ragel"
+#line 307 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in PEDIGREE metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr511:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 307 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in PEDIGREE metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr517:
-#line 314 "src/vcf/vcf.ragel"
+#line 322 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "PEDIGREE metadata sequence of Name_N is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "PEDIGREE metadata sequence of Name_N is not valid");
         p--; {goto st659;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 307 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in PEDIGREE metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr527:
-#line 309 "src/vcf/vcf.ragel"
+#line 317 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "PEDIGREE metadata Father or Mother is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "PEDIGREE metadata Father or Mother is not valid");
         p--; {goto st659;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 307 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in PEDIGREE metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr564:
-#line 304 "src/vcf/vcf.ragel"
+#line 312 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "PEDIGREE metadata Original is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "PEDIGREE metadata Original is not valid");
         p--; {goto st659;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 307 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in PEDIGREE metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr569:
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr580:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr620:
-#line 259 "src/vcf/vcf.ragel"
+#line 267 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in assembly metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr629:
-#line 373 "src/vcf/vcf.ragel"
+#line 381 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata URL is not valid");
         p--; {goto st659;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 267 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in assembly metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr650:
-#line 265 "src/vcf/vcf.ragel"
+#line 273 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in contig metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr661:
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 273 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in contig metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr699:
-#line 320 "src/vcf/vcf.ragel"
+#line 328 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in pedigreeDB metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr711:
-#line 373 "src/vcf/vcf.ragel"
+#line 381 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata URL is not valid");
         p--; {goto st659;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 328 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in pedigreeDB metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	goto st0;
 tr734:
-#line 379 "src/vcf/vcf.ragel"
+#line 387 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
-            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines,
+            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO");
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -985,7 +985,7 @@ tr734:
     }
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -1000,7 +1000,7 @@ tr734:
 tr774:
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -1013,181 +1013,181 @@ tr774:
     }
 	goto st0;
 tr789:
-#line 396 "src/vcf/vcf.ragel"
+#line 404 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<ChromosomeBodyError>(*this, n_lines);
         p--; {goto st660;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	goto st0;
 tr792:
-#line 402 "src/vcf/vcf.ragel"
+#line 410 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new PositionBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<PositionBodyError>(*this, n_lines);
         p--; {goto st660;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	goto st0;
 tr796:
-#line 408 "src/vcf/vcf.ragel"
+#line 416 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new IdBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<IdBodyError>(*this, n_lines);
         p--; {goto st660;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	goto st0;
 tr801:
-#line 414 "src/vcf/vcf.ragel"
+#line 422 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new ReferenceAlleleBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<ReferenceAlleleBodyError>(*this, n_lines);
         p--; {goto st660;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	goto st0;
 tr805:
-#line 420 "src/vcf/vcf.ragel"
+#line 428 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new AlternateAllelesBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<AlternateAllelesBodyError>(*this, n_lines);
         p--; {goto st660;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	goto st0;
 tr814:
-#line 426 "src/vcf/vcf.ragel"
+#line 434 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new QualityBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<QualityBodyError>(*this, n_lines);
         p--; {goto st660;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	goto st0;
 tr825:
-#line 432 "src/vcf/vcf.ragel"
+#line 440 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FilterBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<FilterBodyError>(*this, n_lines);
         p--; {goto st660;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	goto st0;
 tr833:
-#line 443 "src/vcf/vcf.ragel"
+#line 451 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info key is not a sequence of alphanumeric and/or punctuation characters"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info key is not a sequence of alphanumeric and/or punctuation characters");
         p--; {goto st660;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 446 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs");
         p--; {goto st660;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	goto st0;
 tr837:
 #line 50 "src/vcf/vcf_v43.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FormatBodyError{n_lines, "Format does not start with a letter/underscore followed by alphanumeric/underscore/dot characters"});
+        ErrorPolicy::template handle_new_error<FormatBodyError>(*this, n_lines, "Format does not start with a letter/underscore followed by alphanumeric/underscore/dot characters");
         p--; {goto st660;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	goto st0;
 tr842:
-#line 461 "src/vcf/vcf.ragel"
+#line 469 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " does not start with a valid genotype";
-        ErrorPolicy::handle_error(*this, new SamplesFieldBodyError{n_lines, message_stream.str(), "GT"});
+        ErrorPolicy::template handle_new_error<SamplesFieldBodyError>(*this, n_lines, message_stream.str(), "GT");
         p--; {goto st660;}
     }
-#line 454 "src/vcf/vcf.ragel"
+#line 462 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
-        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
+        ErrorPolicy::template handle_new_error<SamplesBodyError>(*this, n_lines, message_stream.str());
         p--; {goto st660;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	goto st0;
 tr850:
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	goto st0;
 tr852:
-#line 454 "src/vcf/vcf.ragel"
+#line 462 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
-        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
+        ErrorPolicy::template handle_new_error<SamplesBodyError>(*this, n_lines, message_stream.str());
         p--; {goto st660;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	goto st0;
 tr858:
-#line 448 "src/vcf/vcf.ragel"
+#line 456 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info field value is not a comma-separated list of valid strings (maybe it contains whitespaces?)"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info field value is not a comma-separated list of valid strings (maybe it contains whitespaces?)");
         p--; {goto st660;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 446 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs");
         p--; {goto st660;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	goto st0;
 tr908:
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -1198,26 +1198,26 @@ tr908:
         
         p--; {goto st660;}
     }
-#line 396 "src/vcf/vcf.ragel"
+#line 404 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<ChromosomeBodyError>(*this, n_lines);
         p--; {goto st660;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	goto st0;
 tr915:
-#line 438 "src/vcf/vcf.ragel"
+#line 446 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs");
         p--; {goto st660;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	goto st0;
@@ -1437,7 +1437,7 @@ tr22:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st22;
@@ -1571,7 +1571,7 @@ tr46:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st28;
@@ -1591,7 +1591,7 @@ tr56:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st28;
@@ -1623,7 +1623,7 @@ tr47:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st29;
@@ -1643,7 +1643,7 @@ tr57:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st29;
@@ -9891,7 +9891,7 @@ tr632:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st451;
@@ -9998,7 +9998,7 @@ tr646:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 #line 35 "src/vcf/vcf.ragel"
@@ -11086,7 +11086,7 @@ tr714:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st512;
@@ -11193,7 +11193,7 @@ tr728:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 #line 35 "src/vcf/vcf.ragel"
@@ -11241,7 +11241,7 @@ tr730:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 #line 35 "src/vcf/vcf.ragel"
@@ -11748,7 +11748,7 @@ tr772:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st661;
@@ -11768,7 +11768,7 @@ tr784:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st661;
@@ -11808,7 +11808,7 @@ tr913:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st662;
@@ -11828,7 +11828,7 @@ tr909:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st662;
@@ -11850,7 +11850,7 @@ tr914:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st577;
@@ -11870,7 +11870,7 @@ tr910:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st577;
@@ -12564,8 +12564,11 @@ tr917:
 #line 218 "src/vcf/vcf.ragel"
 	{
         try {
-            // Handle all columns and build record
-            ParsePolicy::handle_body_line(*this);
+            // Handle all columns and build record, or get every error found in it if all of them are collected
+            auto record_errors = ParsePolicy::handle_body_line(*this);
+            for (auto &error_ptr : record_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
+            }
 
             if (record != nullptr) {
                 auto duplicated_errors = previous_records.check_duplicates(*record);
@@ -12577,11 +12580,22 @@ tr917:
             try {
                 // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
                 if (record != nullptr) {
-                    OptionalPolicy::optional_check_body_entry(*this, *record);
+                    auto collected_warnings = OptionalPolicy::optional_check_body_entry(*this, *record);
+                    for (auto &warning_ptr : collected_warnings) {
+                        ErrorPolicy::handle_warning(*this, warning_ptr.release());
+                    }
                 }
             } catch (Error *warn) {
                 ErrorPolicy::handle_warning(*this, warn);
             }
+
+            // Check the rules that span several records, which may find several warnings at once
+            if (record != nullptr) {
+                auto cross_record_warnings = OptionalPolicy::optional_check_body_records(*record);
+                for (auto &warning_ptr : cross_record_warnings) {
+                    ErrorPolicy::handle_warning(*this, warning_ptr.release());
+                }
+            }
         } catch (Error *error) {
             ErrorPolicy::handle_error(*this, error);
         }
@@ -12593,7 +12607,7 @@ tr917:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st665;
@@ -12601,7 +12615,7 @@ st665:
 	if ( ++p == pe )
 		goto _test_eof665;
 case 665:
-#line 12605 "inc/vcf/validator_detail_v43.hpp"
+#line 12613 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr913;
 		case 13: goto tr914;
@@ -12639,7 +12653,7 @@ st597:
 	if ( ++p == pe )
 		goto _test_eof597;
 case 597:
-#line 12643 "inc/vcf/validator_detail_v43.hpp"
+#line 12651 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr846;
 		case 59: goto tr846;
@@ -12680,7 +12694,7 @@ st598:
 	if ( ++p == pe )
 		goto _test_eof598;
 case 598:
-#line 12684 "inc/vcf/validator_detail_v43.hpp"
+#line 12692 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr847;
 		case 59: goto tr847;
@@ -12709,7 +12723,7 @@ st599:
 	if ( ++p == pe )
 		goto _test_eof599;
 case 599:
-#line 12713 "inc/vcf/validator_detail_v43.hpp"
+#line 12721 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 9 )
 		goto tr849;
 	goto tr789;
@@ -12725,8 +12739,11 @@ tr918:
 #line 218 "src/vcf/vcf.ragel"
 	{
         try {
-            // Handle all columns and build record
-            ParsePolicy::handle_body_line(*this);
+            // Handle all columns and build record, or get every error found in it if all of them are collected
+            auto record_errors = ParsePolicy::handle_body_line(*this);
+            for (auto &error_ptr : record_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
+            }
 
             if (record != nullptr) {
                 auto duplicated_errors = previous_records.check_duplicates(*record);
@@ -12738,11 +12755,22 @@ tr918:
             try {
                 // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
                 if (record != nullptr) {
-                    OptionalPolicy::optional_check_body_entry(*this, *record);
+                    auto collected_warnings = OptionalPolicy::optional_check_body_entry(*this, *record);
+                    for (auto &warning_ptr : collected_warnings) {
+                        ErrorPolicy::handle_warning(*this, warning_ptr.release());
+                    }
                 }
             } catch (Error *warn) {
                 ErrorPolicy::handle_warning(*this, warn);
             }
+
+            // Check the rules that span several records, which may find several warnings at once
+            if (record != nullptr) {
+                auto cross_record_warnings = OptionalPolicy::optional_check_body_records(*record);
+                for (auto &warning_ptr : cross_record_warnings) {
+                    ErrorPolicy::handle_warning(*this, warning_ptr.release());
+                }
+            }
         } catch (Error *error) {
             ErrorPolicy::handle_error(*this, error);
         }
@@ -12754,7 +12782,7 @@ tr918:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st600;
@@ -12762,7 +12790,7 @@ st600:
 	if ( ++p == pe )
 		goto _test_eof600;
 case 600:
-#line 12766 "inc/vcf/validator_detail_v43.hpp"
+#line 12782 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 10 )
 		goto st665;
 	goto tr850;
@@ -12776,7 +12804,7 @@ st601:
 	if ( ++p == pe )
 		goto _test_eof601;
 case 601:
-#line 12780 "inc/vcf/validator_detail_v43.hpp"
+#line 12796 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) > 57 ) {
 		if ( 59 <= (*p) && (*p) <= 126 )
 			goto tr853;
@@ -12803,7 +12831,7 @@ st666:
 	if ( ++p == pe )
 		goto _test_eof666;
 case 666:
-#line 12807 "inc/vcf/validator_detail_v43.hpp"
+#line 12823 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr839;
 		case 10: goto tr917;
@@ -12825,7 +12853,7 @@ st667:
 	if ( ++p == pe )
 		goto _test_eof667;
 case 667:
-#line 12829 "inc/vcf/validator_detail_v43.hpp"
+#line 12845 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr839;
 		case 10: goto tr917;
@@ -12862,7 +12890,7 @@ st668:
 	if ( ++p == pe )
 		goto _test_eof668;
 case 668:
-#line 12866 "inc/vcf/validator_detail_v43.hpp"
+#line 12882 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr839;
 		case 10: goto tr917;
@@ -12894,7 +12922,7 @@ st602:
 	if ( ++p == pe )
 		goto _test_eof602;
 case 602:
-#line 12898 "inc/vcf/validator_detail_v43.hpp"
+#line 12914 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 48 )
 		goto tr854;
 	goto tr833;
@@ -12908,7 +12936,7 @@ st603:
 	if ( ++p == pe )
 		goto _test_eof603;
 case 603:
-#line 12912 "inc/vcf/validator_detail_v43.hpp"
+#line 12928 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 48 )
 		goto tr855;
 	goto tr833;
@@ -12922,7 +12950,7 @@ st604:
 	if ( ++p == pe )
 		goto _test_eof604;
 case 604:
-#line 12926 "inc/vcf/validator_detail_v43.hpp"
+#line 12942 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 48 )
 		goto tr856;
 	goto tr833;
@@ -12936,7 +12964,7 @@ st605:
 	if ( ++p == pe )
 		goto _test_eof605;
 case 605:
-#line 12940 "inc/vcf/validator_detail_v43.hpp"
+#line 12956 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 71 )
 		goto tr857;
 	goto tr833;
@@ -12950,7 +12978,7 @@ st669:
 	if ( ++p == pe )
 		goto _test_eof669;
 case 669:
-#line 12954 "inc/vcf/validator_detail_v43.hpp"
+#line 12970 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr916;
 		case 10: goto tr917;
@@ -12969,7 +12997,7 @@ st606:
 	if ( ++p == pe )
 		goto _test_eof606;
 case 606:
-#line 12973 "inc/vcf/validator_detail_v43.hpp"
+#line 12989 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 49: goto tr835;
 		case 95: goto tr836;
@@ -13000,7 +13028,7 @@ st670:
 	if ( ++p == pe )
 		goto _test_eof670;
 case 670:
-#line 13004 "inc/vcf/validator_detail_v43.hpp"
+#line 13020 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr916;
 		case 10: goto tr917;
@@ -13029,7 +13057,7 @@ st607:
 	if ( ++p == pe )
 		goto _test_eof607;
 case 607:
-#line 13033 "inc/vcf/validator_detail_v43.hpp"
+#line 13049 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) > 58 ) {
 		if ( 60 <= (*p) && (*p) <= 126 )
 			goto tr859;
@@ -13046,7 +13074,7 @@ st671:
 	if ( ++p == pe )
 		goto _test_eof671;
 case 671:
-#line 13050 "inc/vcf/validator_detail_v43.hpp"
+#line 13066 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr916;
 		case 10: goto tr917;
@@ -13066,7 +13094,7 @@ st608:
 	if ( ++p == pe )
 		goto _test_eof608;
 case 608:
-#line 13070 "inc/vcf/validator_detail_v43.hpp"
+#line 13086 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 58 )
 		goto tr826;
 	if ( (*p) < 65 ) {
@@ -13104,7 +13132,7 @@ st609:
 	if ( ++p == pe )
 		goto _test_eof609;
 case 609:
-#line 13108 "inc/vcf/validator_detail_v43.hpp"
+#line 13124 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr831;
 		case 58: goto st591;
@@ -13140,7 +13168,7 @@ st610:
 	if ( ++p == pe )
 		goto _test_eof610;
 case 610:
-#line 13144 "inc/vcf/validator_detail_v43.hpp"
+#line 13160 "inc/vcf/validator_detail_v43.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr860;
 	goto tr814;
@@ -13154,7 +13182,7 @@ st611:
 	if ( ++p == pe )
 		goto _test_eof611;
 case 611:
-#line 13158 "inc/vcf/validator_detail_v43.hpp"
+#line 13174 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr822;
 		case 69: goto tr824;
@@ -13173,7 +13201,7 @@ st612:
 	if ( ++p == pe )
 		goto _test_eof612;
 case 612:
-#line 13177 "inc/vcf/validator_detail_v43.hpp"
+#line 13193 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr861;
 		case 45: goto tr861;
@@ -13191,7 +13219,7 @@ st613:
 	if ( ++p == pe )
 		goto _test_eof613;
 case 613:
-#line 13195 "inc/vcf/validator_detail_v43.hpp"
+#line 13211 "inc/vcf/validator_detail_v43.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr862;
 	goto tr814;
@@ -13205,7 +13233,7 @@ st614:
 	if ( ++p == pe )
 		goto _test_eof614;
 case 614:
-#line 13209 "inc/vcf/validator_detail_v43.hpp"
+#line 13225 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 9 )
 		goto tr822;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -13231,7 +13259,7 @@ st615:
 	if ( ++p == pe )
 		goto _test_eof615;
 case 615:
-#line 13235 "inc/vcf/validator_detail_v43.hpp"
+#line 13251 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 110 )
 		goto tr863;
 	goto tr814;
@@ -13245,7 +13273,7 @@ st616:
 	if ( ++p == pe )
 		goto _test_eof616;
 case 616:
-#line 13249 "inc/vcf/validator_detail_v43.hpp"
+#line 13265 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 102 )
 		goto tr864;
 	goto tr814;
@@ -13269,7 +13297,7 @@ st617:
 	if ( ++p == pe )
 		goto _test_eof617;
 case 617:
-#line 13273 "inc/vcf/validator_detail_v43.hpp"
+#line 13289 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 9 )
 		goto tr822;
 	goto tr814;
@@ -13287,7 +13315,7 @@ st618:
 	if ( ++p == pe )
 		goto _test_eof618;
 case 618:
-#line 13291 "inc/vcf/validator_detail_v43.hpp"
+#line 13307 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 97 )
 		goto tr865;
 	goto tr814;
@@ -13301,7 +13329,7 @@ st619:
 	if ( ++p == pe )
 		goto _test_eof619;
 case 619:
-#line 13305 "inc/vcf/validator_detail_v43.hpp"
+#line 13321 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 78 )
 		goto tr864;
 	goto tr814;
@@ -13315,7 +13343,7 @@ st620:
 	if ( ++p == pe )
 		goto _test_eof620;
 case 620:
-#line 13319 "inc/vcf/validator_detail_v43.hpp"
+#line 13335 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 42: goto tr806;
 		case 46: goto tr866;
@@ -13354,7 +13382,7 @@ st621:
 	if ( ++p == pe )
 		goto _test_eof621;
 case 621:
-#line 13358 "inc/vcf/validator_detail_v43.hpp"
+#line 13374 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 65: goto tr867;
 		case 67: goto tr867;
@@ -13378,7 +13406,7 @@ st622:
 	if ( ++p == pe )
 		goto _test_eof622;
 case 622:
-#line 13382 "inc/vcf/validator_detail_v43.hpp"
+#line 13398 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr812;
 		case 44: goto tr813;
@@ -13408,7 +13436,7 @@ st623:
 	if ( ++p == pe )
 		goto _test_eof623;
 case 623:
-#line 13412 "inc/vcf/validator_detail_v43.hpp"
+#line 13428 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 42: goto tr869;
 		case 61: goto tr868;
@@ -13450,7 +13478,7 @@ st624:
 	if ( ++p == pe )
 		goto _test_eof624;
 case 624:
-#line 13454 "inc/vcf/validator_detail_v43.hpp"
+#line 13470 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 61 )
 		goto tr868;
 	if ( (*p) < 63 ) {
@@ -13490,7 +13518,7 @@ st625:
 	if ( ++p == pe )
 		goto _test_eof625;
 case 625:
-#line 13494 "inc/vcf/validator_detail_v43.hpp"
+#line 13510 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 62 )
 		goto tr871;
 	if ( (*p) < 45 ) {
@@ -13512,7 +13540,7 @@ st626:
 	if ( ++p == pe )
 		goto _test_eof626;
 case 626:
-#line 13516 "inc/vcf/validator_detail_v43.hpp"
+#line 13532 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 62 )
 		goto tr871;
 	if ( (*p) < 61 ) {
@@ -13562,7 +13590,7 @@ st627:
 	if ( ++p == pe )
 		goto _test_eof627;
 case 627:
-#line 13566 "inc/vcf/validator_detail_v43.hpp"
+#line 13582 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr812;
 		case 44: goto tr813;
@@ -13591,7 +13619,7 @@ st628:
 	if ( ++p == pe )
 		goto _test_eof628;
 case 628:
-#line 13595 "inc/vcf/validator_detail_v43.hpp"
+#line 13611 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr875;
 		case 59: goto tr875;
@@ -13623,7 +13651,7 @@ st629:
 	if ( ++p == pe )
 		goto _test_eof629;
 case 629:
-#line 13627 "inc/vcf/validator_detail_v43.hpp"
+#line 13643 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr875;
 		case 58: goto tr877;
@@ -13651,7 +13679,7 @@ st630:
 	if ( ++p == pe )
 		goto _test_eof630;
 case 630:
-#line 13655 "inc/vcf/validator_detail_v43.hpp"
+#line 13671 "inc/vcf/validator_detail_v43.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr878;
 	goto tr805;
@@ -13665,7 +13693,7 @@ st631:
 	if ( ++p == pe )
 		goto _test_eof631;
 case 631:
-#line 13669 "inc/vcf/validator_detail_v43.hpp"
+#line 13685 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 91 )
 		goto tr871;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -13681,7 +13709,7 @@ st632:
 	if ( ++p == pe )
 		goto _test_eof632;
 case 632:
-#line 13685 "inc/vcf/validator_detail_v43.hpp"
+#line 13701 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr879;
 		case 59: goto tr879;
@@ -13712,7 +13740,7 @@ st633:
 	if ( ++p == pe )
 		goto _test_eof633;
 case 633:
-#line 13716 "inc/vcf/validator_detail_v43.hpp"
+#line 13732 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr879;
 		case 59: goto tr879;
@@ -13741,7 +13769,7 @@ st634:
 	if ( ++p == pe )
 		goto _test_eof634;
 case 634:
-#line 13745 "inc/vcf/validator_detail_v43.hpp"
+#line 13761 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 58 )
 		goto tr877;
 	goto tr805;
@@ -13755,7 +13783,7 @@ st635:
 	if ( ++p == pe )
 		goto _test_eof635;
 case 635:
-#line 13759 "inc/vcf/validator_detail_v43.hpp"
+#line 13775 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr881;
 		case 59: goto tr881;
@@ -13787,7 +13815,7 @@ st636:
 	if ( ++p == pe )
 		goto _test_eof636;
 case 636:
-#line 13791 "inc/vcf/validator_detail_v43.hpp"
+#line 13807 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr881;
 		case 58: goto tr883;
@@ -13815,7 +13843,7 @@ st637:
 	if ( ++p == pe )
 		goto _test_eof637;
 case 637:
-#line 13819 "inc/vcf/validator_detail_v43.hpp"
+#line 13835 "inc/vcf/validator_detail_v43.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr884;
 	goto tr805;
@@ -13829,7 +13857,7 @@ st638:
 	if ( ++p == pe )
 		goto _test_eof638;
 case 638:
-#line 13833 "inc/vcf/validator_detail_v43.hpp"
+#line 13849 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 93 )
 		goto tr871;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -13845,7 +13873,7 @@ st639:
 	if ( ++p == pe )
 		goto _test_eof639;
 case 639:
-#line 13849 "inc/vcf/validator_detail_v43.hpp"
+#line 13865 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr885;
 		case 59: goto tr885;
@@ -13876,7 +13904,7 @@ st640:
 	if ( ++p == pe )
 		goto _test_eof640;
 case 640:
-#line 13880 "inc/vcf/validator_detail_v43.hpp"
+#line 13896 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr885;
 		case 59: goto tr885;
@@ -13905,7 +13933,7 @@ st641:
 	if ( ++p == pe )
 		goto _test_eof641;
 case 641:
-#line 13909 "inc/vcf/validator_detail_v43.hpp"
+#line 13925 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 58 )
 		goto tr883;
 	goto tr805;
@@ -13923,7 +13951,7 @@ st642:
 	if ( ++p == pe )
 		goto _test_eof642;
 case 642:
-#line 13927 "inc/vcf/validator_detail_v43.hpp"
+#line 13943 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr887;
 		case 59: goto tr887;
@@ -13955,7 +13983,7 @@ st643:
 	if ( ++p == pe )
 		goto _test_eof643;
 case 643:
-#line 13959 "inc/vcf/validator_detail_v43.hpp"
+#line 13975 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr887;
 		case 58: goto tr889;
@@ -13983,7 +14011,7 @@ st644:
 	if ( ++p == pe )
 		goto _test_eof644;
 case 644:
-#line 13987 "inc/vcf/validator_detail_v43.hpp"
+#line 14003 "inc/vcf/validator_detail_v43.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr890;
 	goto tr805;
@@ -13997,7 +14025,7 @@ st645:
 	if ( ++p == pe )
 		goto _test_eof645;
 case 645:
-#line 14001 "inc/vcf/validator_detail_v43.hpp"
+#line 14017 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 91 )
 		goto tr891;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -14013,7 +14041,7 @@ st646:
 	if ( ++p == pe )
 		goto _test_eof646;
 case 646:
-#line 14017 "inc/vcf/validator_detail_v43.hpp"
+#line 14033 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr892;
 		case 59: goto tr892;
@@ -14044,7 +14072,7 @@ st647:
 	if ( ++p == pe )
 		goto _test_eof647;
 case 647:
-#line 14048 "inc/vcf/validator_detail_v43.hpp"
+#line 14064 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr892;
 		case 59: goto tr892;
@@ -14073,7 +14101,7 @@ st648:
 	if ( ++p == pe )
 		goto _test_eof648;
 case 648:
-#line 14077 "inc/vcf/validator_detail_v43.hpp"
+#line 14093 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 58 )
 		goto tr889;
 	goto tr805;
@@ -14091,7 +14119,7 @@ st649:
 	if ( ++p == pe )
 		goto _test_eof649;
 case 649:
-#line 14095 "inc/vcf/validator_detail_v43.hpp"
+#line 14111 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr894;
 		case 59: goto tr894;
@@ -14123,7 +14151,7 @@ st650:
 	if ( ++p == pe )
 		goto _test_eof650;
 case 650:
-#line 14127 "inc/vcf/validator_detail_v43.hpp"
+#line 14143 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr894;
 		case 58: goto tr896;
@@ -14151,7 +14179,7 @@ st651:
 	if ( ++p == pe )
 		goto _test_eof651;
 case 651:
-#line 14155 "inc/vcf/validator_detail_v43.hpp"
+#line 14171 "inc/vcf/validator_detail_v43.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr897;
 	goto tr805;
@@ -14165,7 +14193,7 @@ st652:
 	if ( ++p == pe )
 		goto _test_eof652;
 case 652:
-#line 14169 "inc/vcf/validator_detail_v43.hpp"
+#line 14185 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 93 )
 		goto tr891;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -14181,7 +14209,7 @@ st653:
 	if ( ++p == pe )
 		goto _test_eof653;
 case 653:
-#line 14185 "inc/vcf/validator_detail_v43.hpp"
+#line 14201 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr898;
 		case 59: goto tr898;
@@ -14212,7 +14240,7 @@ st654:
 	if ( ++p == pe )
 		goto _test_eof654;
 case 654:
-#line 14216 "inc/vcf/validator_detail_v43.hpp"
+#line 14232 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr898;
 		case 59: goto tr898;
@@ -14241,7 +14269,7 @@ st655:
 	if ( ++p == pe )
 		goto _test_eof655;
 case 655:
-#line 14245 "inc/vcf/validator_detail_v43.hpp"
+#line 14261 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 58 )
 		goto tr896;
 	goto tr805;
@@ -14259,7 +14287,7 @@ st656:
 	if ( ++p == pe )
 		goto _test_eof656;
 case 656:
-#line 14263 "inc/vcf/validator_detail_v43.hpp"
+#line 14279 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr812;
 		case 65: goto tr867;
@@ -14286,7 +14314,7 @@ tr773:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st657;
@@ -14306,7 +14334,7 @@ tr785:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st657;
@@ -14314,7 +14342,7 @@ st657:
 	if ( ++p == pe )
 		goto _test_eof657;
 case 657:
-#line 14318 "inc/vcf/validator_detail_v43.hpp"
+#line 14334 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 10 )
 		goto st661;
 	goto tr774;
@@ -14335,7 +14363,7 @@ tr23:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st658;
@@ -14343,7 +14371,7 @@ st658:
 	if ( ++p == pe )
 		goto _test_eof658;
 case 658:
-#line 14347 "inc/vcf/validator_detail_v43.hpp"
+#line 14363 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 10 )
 		goto st22;
 	goto tr0;
@@ -14355,7 +14383,7 @@ tr904:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st659;
@@ -14363,7 +14391,7 @@ st659:
 	if ( ++p == pe )
 		goto _test_eof659;
 case 659:
-#line 14367 "inc/vcf/validator_detail_v43.hpp"
+#line 14383 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr903;
 		case 13: goto tr904;
@@ -14377,7 +14405,7 @@ tr903:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 #line 261 "src/vcf/vcf_v43.ragel"
@@ -14387,7 +14415,7 @@ st672:
 	if ( ++p == pe )
 		goto _test_eof672;
 case 672:
-#line 14391 "inc/vcf/validator_detail_v43.hpp"
+#line 14407 "inc/vcf/validator_detail_v43.hpp"
 	goto st0;
 tr907:
 #line 43 "src/vcf/vcf.ragel"
@@ -14397,7 +14425,7 @@ tr907:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 	goto st660;
@@ -14405,7 +14433,7 @@ st660:
 	if ( ++p == pe )
 		goto _test_eof660;
 case 660:
-#line 14409 "inc/vcf/validator_detail_v43.hpp"
+#line 14425 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr906;
 		case 13: goto tr907;
@@ -14419,7 +14447,7 @@ tr906:
         n_columns = 1;
 
         if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
+            BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
         }
     }
 #line 262 "src/vcf/vcf_v43.ragel"
@@ -14429,7 +14457,7 @@ st673:
 	if ( ++p == pe )
 		goto _test_eof673;
 case 673:
-#line 14433 "inc/vcf/validator_detail_v43.hpp"
+#line 14449 "inc/vcf/validator_detail_v43.hpp"
 	goto st0;
 	}
 	_test_eof2: cs = 2; goto _test_eof; 
@@ -15125,7 +15153,7 @@ case 673:
 	case 658: 
 #line 60 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
+        ErrorPolicy::template handle_new_error<FileformatError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -15179,7 +15207,7 @@ case 673:
 	case 73: 
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -15196,7 +15224,7 @@ case 673:
 	case 657: 
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -15211,7 +15239,7 @@ case 673:
 	case 600: 
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	break;
@@ -15237,14 +15265,14 @@ case 673:
 	case 96: 
 	case 103: 
 	case 114: 
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -15256,14 +15284,14 @@ case 673:
 	case 446: 
 	case 447: 
 	case 448: 
-#line 259 "src/vcf/vcf.ragel"
+#line 267 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in assembly metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -15296,14 +15324,14 @@ case 673:
 	case 496: 
 	case 497: 
 	case 498: 
-#line 265 "src/vcf/vcf.ragel"
+#line 273 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in contig metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -15331,14 +15359,14 @@ case 673:
 	case 147: 
 	case 154: 
 	case 165: 
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -15378,14 +15406,14 @@ case 673:
 	case 213: 
 	case 220: 
 	case 231: 
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -15424,14 +15452,14 @@ case 673:
 	case 279: 
 	case 286: 
 	case 297: 
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -15469,14 +15497,14 @@ case 673:
 	case 403: 
 	case 404: 
 	case 405: 
-#line 299 "src/vcf/vcf.ragel"
+#line 307 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in PEDIGREE metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -15491,14 +15519,14 @@ case 673:
 	case 507: 
 	case 508: 
 	case 509: 
-#line 320 "src/vcf/vcf.ragel"
+#line 328 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in pedigreeDB metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -15534,14 +15562,14 @@ case 673:
 	case 348: 
 	case 349: 
 	case 351: 
-#line 326 "src/vcf/vcf.ragel"
+#line 334 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in META metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -15574,14 +15602,14 @@ case 673:
 	case 438: 
 	case 439: 
 	case 440: 
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -15589,53 +15617,53 @@ case 673:
 	case 597: 
 	case 598: 
 	case 599: 
-#line 396 "src/vcf/vcf.ragel"
+#line 404 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<ChromosomeBodyError>(*this, n_lines);
         p--; {goto st660;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	break;
 	case 579: 
 	case 580: 
-#line 402 "src/vcf/vcf.ragel"
+#line 410 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new PositionBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<PositionBodyError>(*this, n_lines);
         p--; {goto st660;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	break;
 	case 581: 
 	case 582: 
-#line 408 "src/vcf/vcf.ragel"
+#line 416 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new IdBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<IdBodyError>(*this, n_lines);
         p--; {goto st660;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	break;
 	case 583: 
 	case 584: 
-#line 414 "src/vcf/vcf.ragel"
+#line 422 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new ReferenceAlleleBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<ReferenceAlleleBodyError>(*this, n_lines);
         p--; {goto st660;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	break;
@@ -15678,14 +15706,14 @@ case 673:
 	case 654: 
 	case 655: 
 	case 656: 
-#line 420 "src/vcf/vcf.ragel"
+#line 428 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new AlternateAllelesBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<AlternateAllelesBodyError>(*this, n_lines);
         p--; {goto st660;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	break;
@@ -15702,14 +15730,14 @@ case 673:
 	case 617: 
 	case 618: 
 	case 619: 
-#line 426 "src/vcf/vcf.ragel"
+#line 434 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new QualityBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<QualityBodyError>(*this, n_lines);
         p--; {goto st660;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	break;
@@ -15718,14 +15746,14 @@ case 673:
 	case 592: 
 	case 608: 
 	case 609: 
-#line 432 "src/vcf/vcf.ragel"
+#line 440 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FilterBodyError{n_lines});
+        ErrorPolicy::template handle_new_error<FilterBodyError>(*this, n_lines);
         p--; {goto st660;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	break;
@@ -15739,13 +15767,13 @@ case 673:
 	case 21: 
 #line 29 "src/vcf/vcf_v43.ragel"
 	{
-        ErrorPolicy::handle_error(*this,
-                new FileformatError{n_lines, "The fileformat declaration is not 'fileformat=VCFv4.3'"});
+        ErrorPolicy::template handle_new_error<FileformatError>(*this,
+                n_lines, "The fileformat declaration is not 'fileformat=VCFv4.3'");
         p--; {goto st659;}
     }
 #line 60 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
+        ErrorPolicy::template handle_new_error<FileformatError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -15753,12 +15781,12 @@ case 673:
 	case 595: 
 #line 50 "src/vcf/vcf_v43.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FormatBodyError{n_lines, "Format does not start with a letter/underscore followed by alphanumeric/underscore/dot characters"});
+        ErrorPolicy::template handle_new_error<FormatBodyError>(*this, n_lines, "Format does not start with a letter/underscore followed by alphanumeric/underscore/dot characters");
         p--; {goto st660;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	break;
@@ -15773,12 +15801,12 @@ case 673:
 	case 576: 
 #line 55 "src/vcf/vcf_v43.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines, "There is no newline at the end of the file");
         p--; {goto st660;}
     }
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -15793,92 +15821,92 @@ case 673:
 	case 81: 
 	case 82: 
 	case 83: 
-#line 252 "src/vcf/vcf.ragel"
+#line 260 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines,
-            "ALT metadata ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines,
+            "ALT metadata ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence");
         p--; {goto st659;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
 	case 122: 
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
 	case 199: 
 	case 200: 
-#line 293 "src/vcf/vcf.ragel"
+#line 301 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String");
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
 	case 265: 
 	case 266: 
-#line 293 "src/vcf/vcf.ragel"
+#line 301 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String");
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
 	case 406: 
 	case 407: 
 	case 408: 
-#line 304 "src/vcf/vcf.ragel"
+#line 312 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "PEDIGREE metadata Original is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "PEDIGREE metadata Original is not valid");
         p--; {goto st659;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 307 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in PEDIGREE metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -15888,19 +15916,19 @@ case 673:
 	case 384: 
 	case 385: 
 	case 386: 
-#line 309 "src/vcf/vcf.ragel"
+#line 317 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "PEDIGREE metadata Father or Mother is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "PEDIGREE metadata Father or Mother is not valid");
         p--; {goto st659;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 307 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in PEDIGREE metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -15915,37 +15943,37 @@ case 673:
 	case 395: 
 	case 396: 
 	case 397: 
-#line 314 "src/vcf/vcf.ragel"
+#line 322 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "PEDIGREE metadata sequence of Name_N is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "PEDIGREE metadata sequence of Name_N is not valid");
         p--; {goto st659;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 307 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in PEDIGREE metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
 	case 324: 
 	case 325: 
-#line 331 "src/vcf/vcf.ragel"
+#line 339 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "META metadata Number is not a dot"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "META metadata Number is not a dot");
         p--; {goto st659;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 334 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in META metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -15956,74 +15984,74 @@ case 673:
 	case 335: 
 	case 336: 
 	case 337: 
-#line 336 "src/vcf/vcf.ragel"
+#line 344 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "META metadata Type is not String"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "META metadata Type is not String");
         p--; {goto st659;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 334 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in META metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
 	case 347: 
 	case 350: 
-#line 341 "src/vcf/vcf.ragel"
+#line 349 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "META metadata Values is not a square-bracket delimited list of values"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "META metadata Values is not a square-bracket delimited list of values");
         p--; {goto st659;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 334 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in META metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
 	case 100: 
 	case 101: 
 	case 102: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
 	case 478: 
 	case 479: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 273 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in contig metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -16033,19 +16061,19 @@ case 673:
 	case 151: 
 	case 152: 
 	case 153: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -16055,19 +16083,19 @@ case 673:
 	case 217: 
 	case 218: 
 	case 219: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -16077,76 +16105,76 @@ case 673:
 	case 283: 
 	case 284: 
 	case 285: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
 	case 364: 
 	case 365: 
 	case 366: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 307 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in PEDIGREE metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
 	case 314: 
 	case 315: 
 	case 316: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 334 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in META metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
 	case 419: 
 	case 420: 
 	case 421: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -16164,19 +16192,19 @@ case 673:
 	case 116: 
 	case 120: 
 	case 121: 
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st659;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -16194,19 +16222,19 @@ case 673:
 	case 167: 
 	case 171: 
 	case 172: 
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st659;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -16224,19 +16252,19 @@ case 673:
 	case 233: 
 	case 237: 
 	case 238: 
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -16254,19 +16282,19 @@ case 673:
 	case 299: 
 	case 303: 
 	case 304: 
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -16289,19 +16317,19 @@ case 673:
 	case 465: 
 	case 466: 
 	case 467: 
-#line 373 "src/vcf/vcf.ragel"
+#line 381 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata URL is not valid");
         p--; {goto st659;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 267 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in assembly metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -16326,19 +16354,19 @@ case 673:
 	case 528: 
 	case 529: 
 	case 530: 
-#line 373 "src/vcf/vcf.ragel"
+#line 381 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata URL is not valid");
         p--; {goto st659;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 328 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in pedigreeDB metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -16347,17 +16375,17 @@ case 673:
 	case 239: 
 #line 36 "src/vcf/vcf_v43.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "FORMAT metadata Number is not a number, A, R, G or dot"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "FORMAT metadata Number is not a number, A, R, G or dot");
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -16366,17 +16394,17 @@ case 673:
 	case 305: 
 #line 42 "src/vcf/vcf_v43.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Number is not a number, A, R, G or dot"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "INFO metadata Number is not a number, A, R, G or dot");
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -16419,13 +16447,13 @@ case 673:
 	case 567: 
 #line 55 "src/vcf/vcf_v43.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines, "There is no newline at the end of the file");
         p--; {goto st660;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 387 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
-            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines,
+            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO");
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -16438,7 +16466,7 @@ case 673:
     }
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -16453,19 +16481,19 @@ case 673:
 	case 601: 
 #line 55 "src/vcf/vcf_v43.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines, "There is no newline at the end of the file");
         p--; {goto st660;}
     }
-#line 454 "src/vcf/vcf.ragel"
+#line 462 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
-        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
+        ErrorPolicy::template handle_new_error<SamplesBodyError>(*this, n_lines, message_stream.str());
         p--; {goto st660;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	break;
@@ -16484,14 +16512,17 @@ case 673:
     }
 #line 55 "src/vcf/vcf_v43.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines, "There is no newline at the end of the file");
         p--; {goto st660;}
     }
 #line 218 "src/vcf/vcf.ragel"
 	{
         try {
-            // Handle all columns and build record
-            ParsePolicy::handle_body_line(*this);
+            // Handle all columns and build record, or get every error found in it if all of them are collected
+            auto record_errors = ParsePolicy::handle_body_line(*this);
+            for (auto &error_ptr : record_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
+            }
 
             if (record != nullptr) {
                 auto duplicated_errors = previous_records.check_duplicates(*record);
@@ -16503,11 +16534,22 @@ case 673:
             try {
                 // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
                 if (record != nullptr) {
-                    OptionalPolicy::optional_check_body_entry(*this, *record);
+                    auto collected_warnings = OptionalPolicy::optional_check_body_entry(*this, *record);
+                    for (auto &warning_ptr : collected_warnings) {
+                        ErrorPolicy::handle_warning(*this, warning_ptr.release());
+                    }
                 }
             } catch (Error *warn) {
                 ErrorPolicy::handle_warning(*this, warn);
             }
+
+            // Check the rules that span several records, which may find several warnings at once
+            if (record != nullptr) {
+                auto cross_record_warnings = OptionalPolicy::optional_check_body_records(*record);
+                for (auto &warning_ptr : cross_record_warnings) {
+                    ErrorPolicy::handle_warning(*this, warning_ptr.release());
+                }
+            }
         } catch (Error *error) {
             ErrorPolicy::handle_error(*this, error);
         }
@@ -16517,18 +16559,18 @@ case 673:
 	case 28: 
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 #line 55 "src/vcf/vcf_v43.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines, "There is no newline at the end of the file");
         p--; {goto st660;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 387 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
-            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines,
+            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO");
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -16541,7 +16583,7 @@ case 673:
     }
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -16556,192 +16598,192 @@ case 673:
 	case 108: 
 	case 109: 
 	case 110: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st659;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
 	case 159: 
 	case 160: 
 	case 161: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st659;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
 	case 225: 
 	case 226: 
 	case 227: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
 	case 291: 
 	case 292: 
 	case 293: 
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
 	case 117: 
 	case 118: 
 	case 119: 
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st659;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
 	case 168: 
 	case 169: 
 	case 170: 
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st659;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
 	case 234: 
 	case 235: 
 	case 236: 
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st659;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
 	case 300: 
 	case 301: 
 	case 302: 
-#line 368 "src/vcf/vcf.ragel"
+#line 376 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata description string is not valid");
         p--; {goto st659;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 371 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash");
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
@@ -16751,46 +16793,46 @@ case 673:
 	case 604: 
 	case 605: 
 	case 606: 
-#line 443 "src/vcf/vcf.ragel"
+#line 451 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info key is not a sequence of alphanumeric and/or punctuation characters"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info key is not a sequence of alphanumeric and/or punctuation characters");
         p--; {goto st660;}
     }
 #line 55 "src/vcf/vcf_v43.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines, "There is no newline at the end of the file");
         p--; {goto st660;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 446 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs");
         p--; {goto st660;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	break;
 	case 607: 
-#line 448 "src/vcf/vcf.ragel"
+#line 456 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info field value is not a comma-separated list of valid strings (maybe it contains whitespaces?)"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info field value is not a comma-separated list of valid strings (maybe it contains whitespaces?)");
         p--; {goto st660;}
     }
 #line 55 "src/vcf/vcf_v43.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines, "There is no newline at the end of the file");
         p--; {goto st660;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 446 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
+        ErrorPolicy::template handle_new_error<InfoBodyError>(*this, n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs");
         p--; {goto st660;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	break;
@@ -16799,7 +16841,7 @@ case 673:
 	case 668: 
 #line 55 "src/vcf/vcf_v43.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines, "There is no newline at the end of the file");
         p--; {goto st660;}
     }
 #line 39 "src/vcf/vcf.ragel"
@@ -16813,8 +16855,11 @@ case 673:
 #line 218 "src/vcf/vcf.ragel"
 	{
         try {
-            // Handle all columns and build record
-            ParsePolicy::handle_body_line(*this);
+            // Handle all columns and build record, or get every error found in it if all of them are collected
+            auto record_errors = ParsePolicy::handle_body_line(*this);
+            for (auto &error_ptr : record_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
+            }
 
             if (record != nullptr) {
                 auto duplicated_errors = previous_records.check_duplicates(*record);
@@ -16826,11 +16871,22 @@ case 673:
             try {
                 // Check warnings (non-blocking errors but potential mistakes anyway, only makes sense if the last record parsed was correct)
                 if (record != nullptr) {
-                    OptionalPolicy::optional_check_body_entry(*this, *record);
+                    auto collected_warnings = OptionalPolicy::optional_check_body_entry(*this, *record);
+                    for (auto &warning_ptr : collected_warnings) {
+                        ErrorPolicy::handle_warning(*this, warning_ptr.release());
+                    }
                 }
             } catch (Error *warn) {
                 ErrorPolicy::handle_warning(*this, warn);
             }
+
+            // Check the rules that span several records, which may find several warnings at once
+            if (record != nullptr) {
+                auto cross_record_warnings = OptionalPolicy::optional_check_body_records(*record);
+                for (auto &warning_ptr : cross_record_warnings) {
+                    ErrorPolicy::handle_warning(*this, warning_ptr.release());
+                }
+            }
         } catch (Error *error) {
             ErrorPolicy::handle_error(*this, error);
         }
@@ -16839,49 +16895,49 @@ case 673:
 	case 596: 
 #line 55 "src/vcf/vcf_v43.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines, "There is no newline at the end of the file");
         p--; {goto st660;}
     }
-#line 461 "src/vcf/vcf.ragel"
+#line 469 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " does not start with a valid genotype";
-        ErrorPolicy::handle_error(*this, new SamplesFieldBodyError{n_lines, message_stream.str(), "GT"});
+        ErrorPolicy::template handle_new_error<SamplesFieldBodyError>(*this, n_lines, message_stream.str(), "GT");
         p--; {goto st660;}
     }
-#line 454 "src/vcf/vcf.ragel"
+#line 462 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
-        ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
+        ErrorPolicy::template handle_new_error<SamplesBodyError>(*this, n_lines, message_stream.str());
         p--; {goto st660;}
     }
 #line 91 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines);
         p--; {goto st660;}
     }
 	break;
 	case 22: 
 #line 60 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
+        ErrorPolicy::template handle_new_error<FileformatError>(*this, n_lines);
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 #line 55 "src/vcf/vcf_v43.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
+        ErrorPolicy::template handle_new_error<BodySectionError>(*this, n_lines, "There is no newline at the end of the file");
         p--; {goto st660;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 387 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
-            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines,
+            "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO");
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -16894,7 +16950,7 @@ case 673:
     }
 #line 78 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<HeaderSectionError>(*this, n_lines);
         
         // If an error occurs in the header, meta_section_end won't be triggered and the meta and header optional validations must be run here
         try {
@@ -16907,63 +16963,63 @@ case 673:
     }
 	break;
 	case 24: 
-#line 247 "src/vcf/vcf.ragel"
+#line 255 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in ALT metadata");
         p--; {goto st659;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 279 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FILTER metadata");
         p--; {goto st659;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 285 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in FORMAT metadata");
         p--; {goto st659;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 296 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in INFO metadata");
         p--; {goto st659;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 267 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in assembly metadata");
         p--; {goto st659;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 273 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in contig metadata");
         p--; {goto st659;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 334 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in META metadata");
         p--; {goto st659;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 355 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in SAMPLE metadata");
         p--; {goto st659;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 307 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in PEDIGREE metadata");
         p--; {goto st659;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 328 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines, "Error in pedigreeDB metadata");
         p--; {goto st659;}
     }
 #line 65 "src/vcf/vcf.ragel"
 	{
-        ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
+        ErrorPolicy::template handle_new_error<MetaSectionError>(*this, n_lines);
         p--; {goto st659;}
     }
 	break;
-#line 16967 "inc/vcf/validator_detail_v43.hpp"
+#line 16999 "inc/vcf/validator_detail_v43.hpp"
 	}
 	}
 
@@ -16973,6 +17029,14 @@ case 673:
 #line 291 "src/vcf/vcf_v43.ragel"
 
     }
+
+    template <typename Configuration>
+    std::string ParserImpl_v43<Configuration>::grammar() const
+    {
+        return grammar_fingerprint("vcf_v43", {vcf_v43_first_final, vcf_v43_en_main_meta_section,
+                                               vcf_v43_en_main_body_section, vcf_v43_en_meta_section_skip,
+                                               vcf_v43_en_body_section_skip});
+    }
     
   }
 }
@@ -17,6 +17,7 @@
 #include <fstream>
 #include <string>
 
+#include <boost/filesystem/operations.hpp>
 #include <boost/program_options.hpp>
 
 #include "util/logger.hpp"
@@ -43,6 +44,8 @@ namespace
               (ebi::vcf::ERRORS_OPTION, po::value<std::string>(), "Path to the errors report from the input VCF file")
               (ebi::vcf::LEVEL_OPTION, po::value<std::string>()->default_value(ebi::vcf::WARNING), "Validation level (error, warning, stop)")
               (ebi::vcf::OUTPUT_OPTION, po::value<std::string>()->default_value(ebi::vcf::STDOUT), "Write to a file or stdout")
+              (ebi::vcf::MANIFEST_OPTION, po::value<std::string>(), "Write into this file the lines that were changed or removed, so that vcf_validator --recheck validates only them")
+              (ebi::vcf::LINE_INDEX_OPTION, po::value<std::string>(), "Line index of the input written by vcf_validator --line-index, to copy the lines without errors without reading them one by one")
       ;
 
       return description;
@@ -119,7 +122,31 @@ int main(int argc, char **argv)
         auto &input_stream = input_path == ebi::vcf::STDIN ? std::cin : input_file;
         auto &output_stream = output_path == ebi::vcf::STDOUT ? std::cout : output_file;
 
-        ebi::vcf::debugulator::fix_vcf_file(input_stream, errorDAO, output_stream);
+        std::unique_ptr<ebi::vcf::LineIndex> line_index;
+        if (vm.count(ebi::vcf::LINE_INDEX)) {
+            line_index.reset(new ebi::vcf::LineIndex{
+                    ebi::vcf::read_line_index(vm[ebi::vcf::LINE_INDEX].as<std::string>())});
+            if (input_path == ebi::vcf::STDIN
+                    || static_cast<std::streamoff>(boost::filesystem::file_size(input_path)) != line_index->input_size) {
+                throw std::runtime_error{"The line index was not written for the input file " + input_path};
+            }
+        }
+
+        if (vm.count(ebi::vcf::MANIFEST)) {
+            ebi::vcf::FixManifest manifest{0, ebi::vcf::default_recheck_context_lines, {}};
+            ebi::vcf::debugulator::fix_vcf_file(input_stream, errorDAO, output_stream, &manifest, line_index.get());
+            output_stream.flush();
+
+            auto manifest_path = vm[ebi::vcf::MANIFEST].as<std::string>();
+            std::ofstream manifest_file{manifest_path};
+            ebi::vcf::write_fix_manifest(manifest_file, manifest);
+            if (not manifest_file.flush()) {
+                throw std::runtime_error{"Couldn't write the manifest " + manifest_path};
+            }
+            BOOST_LOG_TRIVIAL(info) << "Wrote " << manifest.ranges.size() << " ranges of fixed lines to " << manifest_path;
+        } else {
+            ebi::vcf::debugulator::fix_vcf_file(input_stream, errorDAO, output_stream, nullptr, line_index.get());
+        }
 
         return 0;
 
@@ -0,0 +1,126 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include "util/logger.hpp"
+#include "vcf/line_index.hpp"
+#include "vcf/string_constants.hpp"
+
+namespace
+{
+  namespace po = boost::program_options;
+
+  po::options_description build_command_line_options()
+  {
+      po::options_description description("Usage: vcf-lines [OPTIONS] LINE|FIRST-LAST...\nAllowed options");
+
+      description.add_options()
+              (ebi::vcf::HELP_OPTION, "Display this help")
+              (ebi::vcf::INPUT_OPTION, po::value<std::string>(), "Path to the input VCF file")
+              (ebi::vcf::LINE_INDEX_OPTION, po::value<std::string>(), "Line index of the input written by vcf_validator --line-index (without it, the input is read from the beginning)")
+              (ebi::vcf::LINES_OPTION, po::value<std::vector<std::string>>(), "Line numbers to write, or ranges of them such as 100-200 (the first line is the number 1)")
+      ;
+
+      return description;
+  }
+
+  int check_command_line_options(po::variables_map const &vm, po::options_description const &desc)
+  {
+      if (vm.count(ebi::vcf::HELP)) {
+          std::cout << desc << std::endl;
+          return -1;
+      }
+
+      if (!vm.count(ebi::vcf::INPUT) || !vm.count(ebi::vcf::LINES)) {
+          std::cout << desc << std::endl;
+          BOOST_LOG_TRIVIAL(error) << "Please specify the input file (--input) and the lines to write";
+          return 1;
+      }
+
+      return 0;
+  }
+
+  std::pair<size_t, size_t> parse_lines(std::string const &lines)
+  {
+      size_t separator = lines.find('-');
+      std::string first = lines.substr(0, separator);
+      std::string last = separator == std::string::npos ? first : lines.substr(separator + 1);
+      for (auto number : {first, last}) {
+          if (number.empty() || number.find_first_not_of("0123456789") != std::string::npos) {
+              throw std::invalid_argument{"Lines must be a number or a range such as 100-200, not " + lines};
+          }
+      }
+      std::pair<size_t, size_t> range{std::stoul(first), std::stoul(last)};
+      if (range.first == 0 || range.first > range.second) {
+          throw std::invalid_argument{"Lines start at 1 and ranges can't be empty: " + lines};
+      }
+      return range;
+  }
+}
+
+int main(int argc, char **argv)
+{
+    ebi::util::init_boost_loggers();
+
+    po::options_description desc = build_command_line_options();
+    po::positional_options_description positional;
+    positional.add(ebi::vcf::LINES, -1);
+    po::variables_map vm;
+    po::store(po::command_line_parser(argc, argv).options(desc).positional(positional).run(), vm);
+    po::notify(vm);
+
+    int check_options = check_command_line_options(vm, desc);
+    if (check_options < 0) { return 0; }
+    if (check_options > 0) { return check_options; }
+
+    try {
+        auto input_path = vm[ebi::vcf::INPUT].as<std::string>();
+        std::ifstream input{input_path, std::ios::binary};
+        if (!input) {
+            throw std::runtime_error{"Couldn't open file " + input_path};
+        }
+
+        // without an index, every range is read from the beginning of the file
+        ebi::vcf::LineIndex line_index{0, 0, {}};
+        if (vm.count(ebi::vcf::LINE_INDEX)) {
+            line_index = ebi::vcf::read_line_index(vm[ebi::vcf::LINE_INDEX].as<std::string>());
+        } else {
+            input.seekg(0, std::ios::end);
+            line_index.input_size = input.tellg();
+        }
+
+        for (auto &lines : vm[ebi::vcf::LINES].as<std::vector<std::string>>()) {
+            auto range = parse_lines(lines);
+            size_t written = ebi::vcf::extract_lines(input, line_index, range.first, range.second, std::cout);
+            if (written < range.second - range.first + 1) {
+                BOOST_LOG_TRIVIAL(warning) << "The input ends before the line " << range.second;
+            }
+        }
+        std::cout.flush();
+
+        return 0;
+
+    } catch (std::exception const &ex) {
+        BOOST_LOG_TRIVIAL(error) << "Aborting execution, error: " << ex.what();
+        return 1;
+    }
+}
@@ -0,0 +1,172 @@
+/**
+ * Copyright 2014-2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+#include <boost/filesystem/operations.hpp>
+
+#include "util/logger.hpp"
+#include "util/string_utils.hpp"
+#include "vcf/daemon.hpp"
+#include "vcf/string_constants.hpp"
+
+namespace
+{
+    namespace po = boost::program_options;
+
+    po::options_description build_command_line_options()
+    {
+        po::options_description description("Usage: vcf-validator-client [OPTIONS] [< input_file]\n"
+                                            "Validates a file in a running vcf-validatord\nAllowed options");
+
+        description.add_options()
+            (ebi::vcf::HELP_OPTION, "Display this help")
+            (ebi::vcf::INPUT_OPTION, po::value<std::string>()->default_value(ebi::vcf::STDIN), "Path to the input VCF file, or stdin")
+            (ebi::vcf::LEVEL_OPTION, po::value<std::string>()->default_value(ebi::vcf::WARNING), "Validation level (error, warning, stop, count)")
+            (ebi::vcf::REPORT_OPTION, po::value<std::string>()->default_value(ebi::vcf::TEXT), "Comma separated values for types of reports (only text is available through the daemon)")
+            (ebi::vcf::OUTDIR_OPTION, po::value<std::string>()->default_value(""), "Directory for the output")
+            (ebi::vcf::PLOIDY_OPTION, po::value<long>()->default_value(2), "Genome ploidy to expect through most or the whole VCF file (can be overwritten with --special-ploidy)")
+            (ebi::vcf::SPECIAL_PLOIDY_OPTION, po::value<std::string>()->default_value(""), "Ploidy expected in specific chromosomes/contigs, e.g Y=1,MyTriploidContig=3")
+            (ebi::vcf::SOCKET_OPTION, po::value<std::string>()->default_value(ebi::vcf::default_daemon_socket), "Path of the UNIX domain socket of the daemon")
+        ;
+
+        return description;
+    }
+
+    /**
+     * Names of the options that the client doesn't accept, such as the ones of vcf_validator that a request to the
+     * daemon can't carry
+     */
+    std::vector<std::string> get_unsupported_options(po::parsed_options const & parsed)
+    {
+        std::vector<std::string> unsupported;
+        for (auto & token : po::collect_unrecognized(parsed.options, po::exclude_positional)) {
+            if (token.size() > 1 && token[0] == '-') {
+                unsupported.push_back(token.substr(0, token.find('=')));
+            }
+        }
+        return unsupported;
+    }
+
+    int check_command_line_options(po::variables_map const & vm,
+                                   po::options_description const & desc,
+                                   std::vector<std::string> const & unsupported)
+    {
+        if (vm.count(ebi::vcf::HELP)) {
+            std::cout << desc << std::endl;
+            return -1;
+        }
+
+        if (not unsupported.empty()) {
+            for (auto & option : unsupported) {
+                BOOST_LOG_TRIVIAL(error) << "The option " << option << " can't be used through the daemon, please run "
+                                         << "vcf_validator instead";
+            }
+            return 1;
+        }
+
+        std::string level = vm[ebi::vcf::LEVEL].as<std::string>();
+        if (level != ebi::vcf::ERROR && level != ebi::vcf::WARNING && level != ebi::vcf::STOP
+                && level != ebi::vcf::COUNT) {
+            std::cout << desc << std::endl;
+            BOOST_LOG_TRIVIAL(error) << "Please choose one of the accepted validation levels";
+            return 1;
+        }
+
+        std::vector<std::string> reports;
+        ebi::util::string_split(vm[ebi::vcf::REPORT].as<std::string>(), ",", reports);
+        for (auto & report : reports) {
+            if (report != ebi::vcf::TEXT) {
+                BOOST_LOG_TRIVIAL(error) << "Only text reports can be written through the daemon";
+                return 1;
+            }
+        }
+
+        return 0;
+    }
+
+    std::string get_output_path(const std::string &outdir, const std::string &file_path)
+    {
+        if (outdir == "") {
+            return file_path;
+        }
+
+        boost::filesystem::path file_boost_path{file_path};
+        boost::filesystem::path outdir_boost_path{outdir};
+        if (not boost::filesystem::is_directory(outdir_boost_path)) {
+            throw std::invalid_argument{"outdir should be a directory, not a file: " + outdir_boost_path.string()};
+        }
+
+        outdir_boost_path /= file_boost_path.filename();
+
+        return outdir_boost_path.string();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    ebi::util::init_boost_loggers();
+
+    po::options_description desc = build_command_line_options();
+    po::variables_map vm;
+    po::parsed_options parsed = po::command_line_parser(argc, argv).options(desc).allow_unregistered().run();
+    po::store(parsed, vm);
+    po::notify(vm);
+
+    int check_options = check_command_line_options(vm, desc, get_unsupported_options(parsed));
+    if (check_options < 0) { return 0; }
+    if (check_options > 0) { return check_options; }
+
+    try {
+        auto path = vm[ebi::vcf::INPUT].as<std::string>();
+        auto outdir = get_output_path(vm[ebi::vcf::OUTDIR].as<std::string>(), path);
+
+        // the daemon runs in another directory, so it needs absolute paths
+        ebi::vcf::DaemonRequest request{path == ebi::vcf::STDIN ? path : boost::filesystem::absolute(path).string(),
+                                        vm[ebi::vcf::LEVEL].as<std::string>(),
+                                        vm[ebi::vcf::PLOIDY].as<long>(),
+                                        vm[ebi::vcf::SPECIAL_PLOIDY].as<std::string>()};
+
+        auto epoch = std::chrono::system_clock::now().time_since_epoch();
+        auto timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(epoch).count();
+        std::string filename = outdir + ".errors." + std::to_string(timestamp) + ".txt";
+        if (boost::filesystem::exists(filename)) {
+            throw std::runtime_error{"Report file already exists on " + filename + ", please delete it or rename it"};
+        }
+        std::ofstream report{filename};
+
+        bool is_valid = ebi::vcf::validate_in_daemon(vm[ebi::vcf::SOCKET].as<std::string>(), request, std::cin,
+                                                     [&report](std::string const & line) {
+                                                         report << line << '\n';
+                                                     });
+
+        BOOST_LOG_TRIVIAL(info) << "According to the VCF specification, the input file is " << (is_valid ? "" : "not ") << "valid";
+        return !is_valid; // A valid file returns an exit code 0
+
+    } catch (std::invalid_argument const & ex) {
+        BOOST_LOG_TRIVIAL(error) << ex.what();
+        return 1;
+    } catch (std::exception const &ex) {
+        BOOST_LOG_TRIVIAL(error) << ex.what();
+        return 1;
+    }
+}
@@ -14,24 +14,43 @@
  * limitations under the License.
  */
 
+#include <cerrno>
 #include <iostream>
 #include <fstream>
+#include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <vector>
 #include <stdexcept>
 #include <chrono>
 #include <iomanip>
 
+#include <signal.h>
+
 #include <boost/program_options.hpp>
 #include <boost/filesystem/operations.hpp>
 
+#include "util/checksum.hpp"
+#include "util/follow_streambuf.hpp"
 #include "util/logger.hpp"
+#include "util/memory_budget.hpp"
+#include "util/tee_streambuf.hpp"
+#include "vcf/block_manifest.hpp"
+#include "vcf/checkpoint.hpp"
 #include "vcf/file_structure.hpp"
+#include "vcf/header_cache.hpp"
+#include "vcf/limited_report_writer.hpp"
+#include "vcf/line_index.hpp"
 #include "vcf/validator.hpp"
 #include "vcf/ploidy.hpp"
+#include "vcf/recheck.hpp"
+#include "vcf/reference_fasta.hpp"
+#include "vcf/region.hpp"
+#include "vcf/sampling.hpp"
 #include "vcf/report_writer.hpp"
 #include "vcf/odb_report.hpp"
+#include "vcf/structured_report_writer.hpp"
 #include "vcf/summary_report_writer.hpp"
 
 namespace
@@ -45,11 +64,36 @@ namespace
         description.add_options()
             (ebi::vcf::HELP_OPTION, "Display this help")
             (ebi::vcf::INPUT_OPTION, po::value<std::string>()->default_value(ebi::vcf::STDIN), "Path to the input VCF file, or stdin")
-            (ebi::vcf::LEVEL_OPTION, po::value<std::string>()->default_value(ebi::vcf::WARNING), "Validation level (error, warning, stop)")
-            (ebi::vcf::REPORT_OPTION, po::value<std::string>()->default_value(ebi::vcf::TEXT), "Comma separated values for types of reports (database, text)")
+            (ebi::vcf::LEVEL_OPTION, po::value<std::string>()->default_value(ebi::vcf::WARNING), "Validation level (error, warning, stop, count)")
+            (ebi::vcf::REPORT_OPTION, po::value<std::string>()->default_value(ebi::vcf::TEXT), "Comma separated values for types of reports (database, text, json, binary)")
             (ebi::vcf::OUTDIR_OPTION, po::value<std::string>()->default_value(""), "Directory for the output")
             (ebi::vcf::PLOIDY_OPTION, po::value<long>()->default_value(2), "Genome ploidy to expect through most or the whole VCF file (can be overwritten with --special-ploidy)")
             (ebi::vcf::SPECIAL_PLOIDY_OPTION, po::value<std::string>(), "Ploidy expected in specific chromosomes/contigs, e.g Y=1,MyTriploidContig=3")
+            (ebi::vcf::PASSTHROUGH_OPTION, "Write the input to the standard output while validating it, to use the validator inside a pipeline")
+            (ebi::vcf::CHECKSUM_OPTION, po::value<std::string>(), "Comma-separated list of checksums of the input to compute while validating it: md5, sha256")
+            (ebi::vcf::SAMPLE_WINDOWS_OPTION, po::value<size_t>(), "Validate only this amount of evenly spaced windows of records, to estimate the error rates of a big file quickly (requires --input and only text reports)")
+            (ebi::vcf::SAMPLE_WINDOW_SIZE_OPTION, po::value<size_t>()->default_value(ebi::vcf::default_sample_window_size), "Amount of consecutive records validated in each window of --sample")
+            (ebi::vcf::REGION_OPTION, po::value<std::vector<std::string>>(), "Validate only the records in a region, e.g. 20:1000000-2000000 or 20, with the contig name between braces if it contains ':' (can be repeated)")
+            (ebi::vcf::SITES_ONLY_OPTION, "Validate only the site columns (CHROM to FORMAT), the sample columns are just counted")
+            (ebi::vcf::HEADER_CACHE_OPTION, po::value<std::string>(), "Directory where the validated meta and header sections are kept, so that files with the same header skip validating it again")
+            (ebi::vcf::SAMPLES_SELECTION_OPTION, po::value<std::string>(), "Validate only the columns of these samples: comma-separated list of names, or file with one name per line")
+            (ebi::vcf::CHECKPOINT_OPTION, po::value<std::string>(), "File where the state of the validation is saved periodically, to continue it with --resume if it is interrupted (requires --input)")
+            (ebi::vcf::CHECKPOINT_INTERVAL_OPTION, po::value<size_t>()->default_value(ebi::vcf::default_checkpoint_interval), "Megabytes of input validated between two checkpoints")
+            (ebi::vcf::RESUME_OPTION, po::value<std::string>(), "Continue an interrupted validation from this checkpoint, appending to its reports (the --input and the options that change the results must be the same, or it is rejected)")
+            (ebi::vcf::COLLECT_ALL_ERRORS_OPTION, "Run all the checks of every record and report all their errors and warnings, instead of only the first error of each record, so that the debugulator can fix all of them at once")
+            (ebi::vcf::FOLLOW_OPTION, "Validate a file while it is being written, waiting for it to grow until its producer finishes (requires --input)")
+            (ebi::vcf::FOLLOW_DONE_OPTION, po::value<std::string>(), "With --follow, file whose creation tells that the input is complete (by default, the input path followed by .done)")
+            (ebi::vcf::FOLLOW_PID_OPTION, po::value<long>(), "With --follow, process that writes the input: the input is complete when it exits")
+            (ebi::vcf::RECHECK_OPTION, po::value<std::string>(), "Validate only the lines of a file fixed by vcf_debugulator that are listed in this manifest (written with its --manifest option), and their neighbours (requires --input)")
+            (ebi::vcf::BLOCK_MANIFEST_OPTION, po::value<std::string>(), "File where the hash and the errors of each block of records are written, to validate a new version of the file with --previous-manifest")
+            (ebi::vcf::PREVIOUS_MANIFEST_OPTION, po::value<std::string>(), "Block manifest of a previous version of the input: only the blocks that changed are validated, the results of the others are reused (requires --input)")
+            (ebi::vcf::LINE_INDEX_OPTION, po::value<std::string>(), "File where the byte offsets of some lines of the input are written, so that vcf_lines and vcf_debugulator can seek to the reported lines")
+            (ebi::vcf::LINE_INDEX_INTERVAL_OPTION, po::value<size_t>()->default_value(ebi::vcf::default_line_index_interval), "With --line-index, index one line every this amount of lines, besides the lines with errors (0 to index only the lines with errors)")
+            (ebi::vcf::MAX_ERRORS_OPTION, po::value<size_t>(), "Stop the validation after finding this amount of errors, marking the report as truncated")
+            (ebi::vcf::MAX_ERRORS_PER_TYPE_OPTION, po::value<size_t>(), "Report only this amount of errors (and of warnings) of each type, the next ones are counted but not reported")
+            (ebi::vcf::MEMORY_LIMIT_OPTION, po::value<size_t>(), "Megabytes of memory for the records, contigs, meta entries and warnings kept during the validation: when they don't fit, some checks are degraded and the reports explain how")
+            (ebi::vcf::REFERENCE_FASTA_OPTION, po::value<std::string>(), "Uncompressed FASTA file of the assembly, indexed with 'samtools faidx': the REF alleles are checked against it, and the indels are left-aligned with it to find duplicates")
+            (ebi::vcf::RECORD_BLOCKS_OPTION, "Check the position, sorting and contig of the records in blocks of 1024 records, one field at a time; the errors and warnings of each block are reported together, as they would be without blocks (only with the level 'warning', not with --follow)")
         ;
 
         return description;
@@ -63,7 +107,8 @@ namespace
         }
 
         std::string level = vm[ebi::vcf::LEVEL].as<std::string>();
-        if (level != ebi::vcf::ERROR && level != ebi::vcf::WARNING && level != ebi::vcf::STOP) {
+        if (level != ebi::vcf::ERROR && level != ebi::vcf::WARNING && level != ebi::vcf::STOP
+                && level != ebi::vcf::COUNT) {
             std::cout << desc << std::endl;
             BOOST_LOG_TRIVIAL(error) << "Please choose one of the accepted validation levels";
             return 1;
@@ -75,6 +120,168 @@ namespace
             return 1;
         }
 
+        if (vm.count(ebi::vcf::COLLECT_ALL_ERRORS) && level == ebi::vcf::STOP) {
+            BOOST_LOG_TRIVIAL(error) << "The validation level 'stop' reports only the first error, it can't be used with --collect-all-errors";
+            return 1;
+        }
+
+        if (level == ebi::vcf::COUNT && (vm.count(ebi::vcf::SAMPLE_WINDOWS) || vm.count(ebi::vcf::CHECKPOINT)
+                                         || vm.count(ebi::vcf::RESUME) || vm.count(ebi::vcf::BLOCK_MANIFEST)
+                                         || vm.count(ebi::vcf::PREVIOUS_MANIFEST))) {
+            BOOST_LOG_TRIVIAL(error) << "The validation level 'count' keeps only the first error of each type, it can't be used with --sample, checkpoints or block manifests";
+            return 1;
+        }
+
+        if (vm.count(ebi::vcf::SITES_ONLY) && vm.count(ebi::vcf::SAMPLES_SELECTION)) {
+            BOOST_LOG_TRIVIAL(error) << "Please use only one of --sites-only and --samples";
+            return 1;
+        }
+
+        if (vm.count(ebi::vcf::SAMPLE_WINDOWS) && vm.count(ebi::vcf::REGION)) {
+            BOOST_LOG_TRIVIAL(error) << "Please use only one of --sample and --region";
+            return 1;
+        }
+
+        if (vm.count(ebi::vcf::SAMPLE_WINDOWS)) {
+            if (vm[ebi::vcf::INPUT].as<std::string>() == ebi::vcf::STDIN) {
+                BOOST_LOG_TRIVIAL(error) << "Please provide an input file with -i/--input to validate a sample of it";
+                return 1;
+            }
+            if (vm.count(ebi::vcf::PASSTHROUGH) || vm.count(ebi::vcf::CHECKSUM)) {
+                BOOST_LOG_TRIVIAL(error) << "The whole input is needed for --passthrough and --checksum, they can't be used with --sample";
+                return 1;
+            }
+            if (vm[ebi::vcf::SAMPLE_WINDOWS].as<size_t>() == 0 || vm[ebi::vcf::SAMPLE_WINDOW_SIZE].as<size_t>() == 0) {
+                BOOST_LOG_TRIVIAL(error) << "The amount of sample windows and their size must be greater than 0";
+                return 1;
+            }
+            std::vector<std::string> reports;
+            ebi::util::string_split(vm[ebi::vcf::REPORT].as<std::string>(), ",", reports);
+            if (std::any_of(reports.begin(), reports.end(), [](std::string const & report) { return report != ebi::vcf::TEXT; })) {
+                BOOST_LOG_TRIVIAL(error) << "The line numbers of a sample only count the lines read, "
+                                         << "and the byte offset of each window is only written to text reports: "
+                                         << "--sample can't be used with database, json or binary reports";
+                return 1;
+            }
+        }
+
+        if (vm.count(ebi::vcf::FOLLOW)) {
+            if (vm[ebi::vcf::INPUT].as<std::string>() == ebi::vcf::STDIN) {
+                BOOST_LOG_TRIVIAL(error) << "Please provide an input file with -i/--input to follow it";
+                return 1;
+            }
+            if (vm.count(ebi::vcf::SAMPLE_WINDOWS) || vm.count(ebi::vcf::CHECKPOINT) || vm.count(ebi::vcf::RESUME)) {
+                BOOST_LOG_TRIVIAL(error) << "A file being written can't be sampled nor resumed, --follow can't be used with --sample, --checkpoint or --resume";
+                return 1;
+            }
+        } else if (vm.count(ebi::vcf::FOLLOW_DONE) || vm.count(ebi::vcf::FOLLOW_PID)) {
+            BOOST_LOG_TRIVIAL(error) << "--follow-done and --follow-pid can only be used with --follow";
+            return 1;
+        }
+
+        if (vm.count(ebi::vcf::RECHECK)) {
+            if (vm[ebi::vcf::INPUT].as<std::string>() == ebi::vcf::STDIN) {
+                BOOST_LOG_TRIVIAL(error) << "Please provide the fixed file with -i/--input to validate only its fixed lines";
+                return 1;
+            }
+            if (vm.count(ebi::vcf::SAMPLE_WINDOWS) || vm.count(ebi::vcf::REGION) || vm.count(ebi::vcf::FOLLOW)
+                    || vm.count(ebi::vcf::CHECKPOINT) || vm.count(ebi::vcf::RESUME)
+                    || vm.count(ebi::vcf::PASSTHROUGH) || vm.count(ebi::vcf::CHECKSUM)) {
+                BOOST_LOG_TRIVIAL(error) << "--recheck can't be used with --sample, --region, --follow, checkpoints, --passthrough or --checksum";
+                return 1;
+            }
+        }
+
+        if (vm.count(ebi::vcf::BLOCK_MANIFEST) || vm.count(ebi::vcf::PREVIOUS_MANIFEST)) {
+            if (vm.count(ebi::vcf::PREVIOUS_MANIFEST) && vm[ebi::vcf::INPUT].as<std::string>() == ebi::vcf::STDIN) {
+                BOOST_LOG_TRIVIAL(error) << "Please provide an input file with -i/--input to reuse a previous block manifest";
+                return 1;
+            }
+            if (vm.count(ebi::vcf::SAMPLE_WINDOWS) || vm.count(ebi::vcf::REGION) || vm.count(ebi::vcf::FOLLOW)
+                    || vm.count(ebi::vcf::CHECKPOINT) || vm.count(ebi::vcf::RESUME) || vm.count(ebi::vcf::RECHECK)
+                    || vm.count(ebi::vcf::PASSTHROUGH) || vm.count(ebi::vcf::CHECKSUM)) {
+                BOOST_LOG_TRIVIAL(error) << "Block manifests can't be used with --sample, --region, --follow, checkpoints, --recheck, --passthrough or --checksum";
+                return 1;
+            }
+            if (level == ebi::vcf::STOP) {
+                BOOST_LOG_TRIVIAL(error) << "The validation level 'stop' doesn't validate every block, it can't be used with block manifests";
+                return 1;
+            }
+        }
+
+        if (vm.count(ebi::vcf::LINE_INDEX)) {
+            if (vm.count(ebi::vcf::SAMPLE_WINDOWS) || vm.count(ebi::vcf::RECHECK) || vm.count(ebi::vcf::CHECKPOINT)
+                    || vm.count(ebi::vcf::RESUME) || vm.count(ebi::vcf::BLOCK_MANIFEST)
+                    || vm.count(ebi::vcf::PREVIOUS_MANIFEST)) {
+                BOOST_LOG_TRIVIAL(error) << "--line-index needs reading the whole input, it can't be used with --sample, --recheck, checkpoints or block manifests";
+                return 1;
+            }
+        }
+
+        if (vm.count(ebi::vcf::REFERENCE_FASTA) && level == ebi::vcf::ERROR) {
+            BOOST_LOG_TRIVIAL(error) << "The validation level 'error' only checks the syntax of the records, it can't be used with --reference";
+            return 1;
+        }
+
+        if (vm.count(ebi::vcf::RECORD_BLOCKS)) {
+            if (level != ebi::vcf::WARNING) {
+                BOOST_LOG_TRIVIAL(error) << "--record-blocks can only be used with the validation level 'warning'";
+                return 1;
+            }
+            if (vm.count(ebi::vcf::SAMPLE_WINDOWS) || vm.count(ebi::vcf::REGION) || vm.count(ebi::vcf::RECHECK)
+                    || vm.count(ebi::vcf::CHECKPOINT) || vm.count(ebi::vcf::RESUME)
+                    || vm.count(ebi::vcf::BLOCK_MANIFEST) || vm.count(ebi::vcf::PREVIOUS_MANIFEST)
+                    || vm.count(ebi::vcf::LINE_INDEX) || vm.count(ebi::vcf::FOLLOW)) {
+                BOOST_LOG_TRIVIAL(error) << "--record-blocks reports the errors of each block together, it can't be used with --sample, --region, --recheck, --follow, checkpoints, block manifests or --line-index";
+                return 1;
+            }
+        }
+
+        if (vm.count(ebi::vcf::MEMORY_LIMIT) && vm[ebi::vcf::MEMORY_LIMIT].as<size_t>() == 0) {
+            BOOST_LOG_TRIVIAL(error) << "The memory limit must be greater than 0";
+            return 1;
+        }
+
+        if (vm.count(ebi::vcf::MAX_ERRORS) || vm.count(ebi::vcf::MAX_ERRORS_PER_TYPE)) {
+            if ((vm.count(ebi::vcf::MAX_ERRORS) && vm[ebi::vcf::MAX_ERRORS].as<size_t>() == 0)
+                    || (vm.count(ebi::vcf::MAX_ERRORS_PER_TYPE) && vm[ebi::vcf::MAX_ERRORS_PER_TYPE].as<size_t>() == 0)) {
+                BOOST_LOG_TRIVIAL(error) << "The maximum amount of errors must be greater than 0";
+                return 1;
+            }
+            if (vm.count(ebi::vcf::CHECKPOINT) || vm.count(ebi::vcf::RESUME)) {
+                BOOST_LOG_TRIVIAL(error) << "--max-errors and --max-errors-per-type can't be used with checkpoints";
+                return 1;
+            }
+            // these options need the whole input, so the validation would not stop early
+            if (vm.count(ebi::vcf::MAX_ERRORS) && (vm.count(ebi::vcf::PASSTHROUGH) || vm.count(ebi::vcf::CHECKSUM)
+                                                   || vm.count(ebi::vcf::LINE_INDEX))) {
+                BOOST_LOG_TRIVIAL(error) << "--max-errors can't be used with --passthrough, --checksum or --line-index";
+                return 1;
+            }
+        }
+
+        if (vm.count(ebi::vcf::CHECKPOINT) || vm.count(ebi::vcf::RESUME)) {
+            if (vm[ebi::vcf::INPUT].as<std::string>() == ebi::vcf::STDIN) {
+                BOOST_LOG_TRIVIAL(error) << "Please provide an input file with -i/--input to use checkpoints";
+                return 1;
+            }
+            if (vm.count(ebi::vcf::SAMPLE_WINDOWS) || vm.count(ebi::vcf::REGION)
+                    || vm.count(ebi::vcf::PASSTHROUGH) || vm.count(ebi::vcf::CHECKSUM)) {
+                BOOST_LOG_TRIVIAL(error) << "Checkpoints can't be used with --sample, --region, --passthrough or --checksum";
+                return 1;
+            }
+            std::vector<std::string> reports;
+            ebi::util::string_split(vm[ebi::vcf::REPORT].as<std::string>(), ",", reports);
+            if (std::any_of(reports.begin(), reports.end(), [](std::string const & report) { return report != ebi::vcf::TEXT; })) {
+                BOOST_LOG_TRIVIAL(error) << "Only text reports can be continued from a checkpoint";
+                return 1;
+            }
+            if (vm[ebi::vcf::CHECKPOINT_INTERVAL].as<size_t>() == 0) {
+                BOOST_LOG_TRIVIAL(error) << "The interval between checkpoints must be greater than 0";
+                return 1;
+            }
+        }
+
         return 0;
     }
 
@@ -86,6 +293,8 @@ namespace
             return ebi::vcf::ValidationLevel::warning;
         } else if (level_str == ebi::vcf::STOP) {
             return ebi::vcf::ValidationLevel::stop;
+        } else if (level_str == ebi::vcf::COUNT) {
+            return ebi::vcf::ValidationLevel::count;
         }
 
         throw std::invalid_argument{"Please choose one of the accepted validation levels"};
@@ -110,39 +319,9 @@ namespace
 
     ebi::vcf::Ploidy get_ploidy(long default_ploidy, po::variables_map const & vm)
     {
-        const std::string message = "Please provide the special ploidies as a comma-separated list of pairs "
-                "CHROM=PLOIDY where CHROM is the name as in the VCF, and PLOIDY is a number strictly greater than 0.";
-
-
-        size_t unsigned_ploidy;
-        if (default_ploidy <= 0) {
-            throw std::invalid_argument{std::to_string(default_ploidy)
-                                                + " is not a valid ploidy, must be a number strictly greater than 0."};
-        }
-        unsigned_ploidy = static_cast<size_t>(default_ploidy);
-
-        std::map<std::string, size_t> special_ploidies;
-        if (vm.count(ebi::vcf::SPECIAL_PLOIDY)) {
-            std::string parameter{vm[ebi::vcf::SPECIAL_PLOIDY].as<std::string>()};
-            std::vector<std::string> ploidies;
-            ebi::util::string_split(parameter, ",", ploidies);
-            for (std::string &ploidy_assignment : ploidies) {
-                std::vector<std::string> contig_and_ploidy;
-                ebi::util::string_split(ploidy_assignment, "=", contig_and_ploidy);
-                if (contig_and_ploidy.size() != 2) {
-                    throw std::invalid_argument{ploidy_assignment + " is not a valid CHROM=PLOIDY pair. " + message};
-                }
-                size_t ploidy;
-                try {
-                    ploidy = std::stoul(contig_and_ploidy[1]);
-                } catch (std::exception e) {
-                    throw std::invalid_argument{contig_and_ploidy[1] + " is not a valid ploidy. " + message};
-                }
-                special_ploidies[contig_and_ploidy[0]] = ploidy;
-            }
-        }
-
-        return ebi::vcf::Ploidy{unsigned_ploidy, special_ploidies};
+        std::string special_ploidies = vm.count(ebi::vcf::SPECIAL_PLOIDY) ? vm[ebi::vcf::SPECIAL_PLOIDY].as<std::string>()
+                                                                         : "";
+        return ebi::vcf::parse_ploidy(default_ploidy, special_ploidies);
     }
 
     std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> get_outputs(std::string const &output_str, std::string const &input) {
@@ -161,16 +340,21 @@ namespace
 
         auto epoch = std::chrono::system_clock::now().time_since_epoch();
         auto timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(epoch).count();
+        std::map<std::string, std::string> filetypes{{ebi::vcf::DATABASE, "db"}, {ebi::vcf::TEXT, "txt"},
+                                                     {ebi::vcf::JSON, "json"}, {ebi::vcf::BINARY, "bin"}};
         for (auto out : outs) {
-            if (out == ebi::vcf::DATABASE || out == ebi::vcf::TEXT) {
-                std::string filetype = (out == ebi::vcf::DATABASE ? "db" : "txt");
-                std::string filename = input + ".errors." + std::to_string(timestamp) + "." + filetype;
+            if (filetypes.count(out)) {
+                std::string filename = input + ".errors." + std::to_string(timestamp) + "." + filetypes[out];
                 boost::filesystem::path file{filename};
                 if (boost::filesystem::exists(file)) {
                     throw std::runtime_error{"Report file already exists on " + filename + ", please delete it or rename it"};
                 }
                 if (out == ebi::vcf::DATABASE) {
                     outputs.emplace_back(new ebi::vcf::OdbReportRW(filename));
+                } else if (out == ebi::vcf::JSON) {
+                    outputs.emplace_back(new ebi::vcf::JsonReportWriter(filename));
+                } else if (out == ebi::vcf::BINARY) {
+                    outputs.emplace_back(new ebi::vcf::BinaryReportWriter(filename));
                 } else {
                     outputs.emplace_back(new ebi::vcf::SummaryReportWriter(filename));
                 }
@@ -182,6 +366,261 @@ namespace
         return outputs;
     }
 
+    std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> get_limited_outputs(
+            std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> outputs, po::variables_map const & vm)
+    {
+        ebi::vcf::ErrorLimits limits{vm.count(ebi::vcf::MAX_ERRORS) ? vm[ebi::vcf::MAX_ERRORS].as<size_t>() : 0,
+                                     vm.count(ebi::vcf::MAX_ERRORS_PER_TYPE) ? vm[ebi::vcf::MAX_ERRORS_PER_TYPE].as<size_t>() : 0};
+        std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> limited_outputs;
+        limited_outputs.emplace_back(new ebi::vcf::LimitedReportWriter{std::move(outputs), limits});
+        return limited_outputs;
+    }
+
+    void write_memory_usage(std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs)
+    {
+        ebi::util::MemoryBudget const & budget = ebi::util::memory_budget();
+        std::vector<std::string> messages{"Memory used by the validation: at most "
+                                          + std::to_string(budget.get_peak() / 1024) + " KiB out of a limit of "
+                                          + std::to_string(budget.get_limit() / 1024) + " KiB"};
+        for (auto & note : budget.get_notes()) {
+            messages.push_back(note);
+        }
+        for (auto & message : messages) {
+            ebi::vcf::write_message(message, outputs);
+        }
+    }
+
+    ebi::util::FollowStreambuf::Finished get_follow_end(po::variables_map const & vm)
+    {
+        std::string done_path = vm.count(ebi::vcf::FOLLOW_DONE) ? vm[ebi::vcf::FOLLOW_DONE].as<std::string>()
+                                                                : vm[ebi::vcf::INPUT].as<std::string>() + ".done";
+        long pid = vm.count(ebi::vcf::FOLLOW_PID) ? vm[ebi::vcf::FOLLOW_PID].as<long>() : 0;
+
+        return [done_path, pid]() {
+            if (boost::filesystem::exists(done_path)) {
+                return true;
+            }
+            return pid > 0 && kill(static_cast<pid_t>(pid), 0) != 0 && errno == ESRCH;
+        };
+    }
+
+    std::vector<std::unique_ptr<ebi::util::Checksum>> get_checksums(po::variables_map const & vm)
+    {
+        std::vector<std::unique_ptr<ebi::util::Checksum>> checksums;
+        if (vm.count(ebi::vcf::CHECKSUM)) {
+            std::vector<std::string> algorithms;
+            ebi::util::string_split(vm[ebi::vcf::CHECKSUM].as<std::string>(), ",", algorithms);
+            for (auto & algorithm : algorithms) {
+                checksums.push_back(ebi::util::make_checksum(algorithm));
+            }
+        }
+        return checksums;
+    }
+
+    std::vector<ebi::vcf::Region> get_regions(po::variables_map const & vm)
+    {
+        std::vector<ebi::vcf::Region> regions;
+        if (vm.count(ebi::vcf::REGION)) {
+            for (auto & region : vm[ebi::vcf::REGION].as<std::vector<std::string>>()) {
+                regions.push_back(ebi::vcf::parse_region(region));
+            }
+        }
+        return regions;
+    }
+
+    ebi::vcf::SampleSelection get_sample_selection(po::variables_map const & vm)
+    {
+        if (vm.count(ebi::vcf::SITES_ONLY)) {
+            return ebi::vcf::SampleSelection{std::set<std::string>{}};
+        }
+        if (not vm.count(ebi::vcf::SAMPLES_SELECTION)) {
+            return ebi::vcf::SampleSelection{};
+        }
+
+        std::string samples = vm[ebi::vcf::SAMPLES_SELECTION].as<std::string>();
+        std::vector<std::string> names;
+        if (boost::filesystem::is_regular_file(samples)) {
+            std::ifstream samples_file{samples};
+            std::string name;
+            while (std::getline(samples_file, name)) {
+                ebi::util::remove_end_of_line(name);
+                if (not name.empty()) {
+                    names.push_back(name);
+                }
+            }
+        } else {
+            ebi::util::string_split(samples, ",", names);
+        }
+        return ebi::vcf::SampleSelection{std::set<std::string>{names.begin(), names.end()}};
+    }
+
+    /**
+     * Options that change the results of the validation, so that a block manifest or a checkpoint is not reused with
+     * others
+     */
+    std::string get_validation_settings(po::variables_map const & vm)
+    {
+        std::string settings = "level=" + vm[ebi::vcf::LEVEL].as<std::string>()
+                               + ";ploidy=" + std::to_string(vm[ebi::vcf::PLOIDY].as<long>());
+        if (vm.count(ebi::vcf::SPECIAL_PLOIDY)) {
+            settings += ";special-ploidy=" + vm[ebi::vcf::SPECIAL_PLOIDY].as<std::string>();
+        }
+        if (vm.count(ebi::vcf::SITES_ONLY)) {
+            settings += ";sites-only";
+        }
+        if (vm.count(ebi::vcf::SAMPLES_SELECTION)) {
+            auto selection = get_sample_selection(vm);
+            settings += ";samples=";
+            for (auto & name : selection.selected_names()) {
+                settings += name + ",";
+            }
+        }
+        if (vm.count(ebi::vcf::COLLECT_ALL_ERRORS)) {
+            settings += ";collect-all-errors";
+        }
+        if (vm.count(ebi::vcf::REFERENCE_FASTA)) {
+            settings += ";reference=" + vm[ebi::vcf::REFERENCE_FASTA].as<std::string>();
+        }
+        return settings;
+    }
+
+    bool is_valid_vcf_file(std::istream &input,
+                           std::string const &path,
+                           ebi::vcf::ValidationLevel validationLevel,
+                           ebi::vcf::Ploidy ploidy,
+                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                           ebi::vcf::Checkpoint const *checkpoint,
+                           po::variables_map const & vm)
+    {
+        ebi::vcf::ValidationOptions validationOptions;
+        validationOptions.sample_selection = get_sample_selection(vm);
+        validationOptions.collect_all_errors = vm.count(ebi::vcf::COLLECT_ALL_ERRORS);
+        validationOptions.record_blocks = vm.count(ebi::vcf::RECORD_BLOCKS);
+        if (vm.count(ebi::vcf::REFERENCE_FASTA)) {
+            validationOptions.reference = std::make_shared<ebi::vcf::ReferenceFasta>(
+                    vm[ebi::vcf::REFERENCE_FASTA].as<std::string>());
+        }
+        std::unique_ptr<ebi::vcf::HeaderCache> headerCache;
+        if (vm.count(ebi::vcf::HEADER_CACHE)) {
+            headerCache.reset(new ebi::vcf::HeaderCache{vm[ebi::vcf::HEADER_CACHE].as<std::string>()});
+            validationOptions.header_cache = headerCache.get();
+        }
+
+        if (vm.count(ebi::vcf::SAMPLE_WINDOWS)) {
+            ebi::vcf::SamplingOptions options{vm[ebi::vcf::SAMPLE_WINDOWS].as<size_t>(),
+                                              vm[ebi::vcf::SAMPLE_WINDOW_SIZE].as<size_t>()};
+            return ebi::vcf::is_valid_vcf_file_sample(input, path, validationLevel, ploidy, outputs, options,
+                                                      validationOptions);
+        }
+
+        if (vm.count(ebi::vcf::RECHECK)) {
+            auto manifest_path = vm[ebi::vcf::RECHECK].as<std::string>();
+            std::ifstream manifest_file{manifest_path};
+            if (not manifest_file) {
+                throw std::runtime_error{"Couldn't open the manifest " + manifest_path};
+            }
+            ebi::vcf::FixManifest manifest = ebi::vcf::read_fix_manifest(manifest_file);
+            return ebi::vcf::is_valid_vcf_file_recheck(input, path, validationLevel, ploidy, outputs, manifest,
+                                                       validationOptions);
+        }
+
+        if (vm.count(ebi::vcf::BLOCK_MANIFEST) || vm.count(ebi::vcf::PREVIOUS_MANIFEST)) {
+            std::unique_ptr<ebi::vcf::BlockManifest> previous;
+            if (vm.count(ebi::vcf::PREVIOUS_MANIFEST)) {
+                previous.reset(new ebi::vcf::BlockManifest{
+                        ebi::vcf::read_block_manifest(vm[ebi::vcf::PREVIOUS_MANIFEST].as<std::string>())});
+            }
+            ebi::vcf::BlockManifest manifest;
+            bool is_valid = ebi::vcf::is_valid_vcf_file_blocks(input, path, validationLevel, ploidy, outputs,
+                                                               get_validation_settings(vm), manifest, previous.get(),
+                                                               validationOptions);
+            if (vm.count(ebi::vcf::BLOCK_MANIFEST)) {
+                ebi::vcf::write_block_manifest(vm[ebi::vcf::BLOCK_MANIFEST].as<std::string>(), manifest);
+            }
+            return is_valid;
+        }
+
+        if (vm.count(ebi::vcf::CHECKPOINT) || vm.count(ebi::vcf::RESUME)) {
+            // a resumed validation keeps writing checkpoints, to the same file unless another one is given
+            std::string checkpoint_path = vm.count(ebi::vcf::CHECKPOINT) ? vm[ebi::vcf::CHECKPOINT].as<std::string>()
+                                                                         : vm[ebi::vcf::RESUME].as<std::string>();
+            size_t interval = vm[ebi::vcf::CHECKPOINT_INTERVAL].as<size_t>() * 1024 * 1024;
+            ebi::vcf::CheckpointOptions options{checkpoint_path, interval, get_validation_settings(vm)};
+            return ebi::vcf::is_valid_vcf_file_checkpointed(input, path, validationLevel, ploidy, outputs, options,
+                                                            checkpoint, validationOptions);
+        }
+
+        std::vector<ebi::vcf::Region> regions = get_regions(vm);
+        auto validate = [&](std::istream &validated_input) -> bool {
+            if (regions.empty()) {
+                return ebi::vcf::is_valid_vcf_file(validated_input, path, validationLevel, ploidy, outputs,
+                                                   validationOptions);
+            }
+            return ebi::vcf::is_valid_vcf_file_regions(validated_input, path, validationLevel, ploidy, outputs, regions,
+                                                       validationOptions);
+        };
+
+        bool passthrough = vm.count(ebi::vcf::PASSTHROUGH);
+        auto checksums = get_checksums(vm);
+        std::unique_ptr<ebi::vcf::LineIndexBuilder> line_index;
+        if (vm.count(ebi::vcf::LINE_INDEX)) {
+            line_index.reset(new ebi::vcf::LineIndexBuilder{vm[ebi::vcf::LINE_INDEX_INTERVAL].as<size_t>()});
+        }
+        if (not passthrough and checksums.empty() and not line_index) {
+            return validate(input);
+        }
+
+        // every byte read by the validator is also handed to the sinks, so the input is read only once
+        ebi::util::TeeStreambuf tee{*input.rdbuf()};
+        if (passthrough) {
+            tee.add_sink([](char const * data, size_t size) {
+                std::cout.write(data, size);
+            });
+        }
+        for (auto & checksum : checksums) {
+            ebi::util::Checksum *raw_checksum = checksum.get();
+            tee.add_sink([raw_checksum](char const * data, size_t size) {
+                raw_checksum->update(data, size);
+            });
+        }
+        if (line_index) {
+            ebi::vcf::LineIndexBuilder *raw_line_index = line_index.get();
+            tee.add_sink([raw_line_index](char const * data, size_t size) {
+                raw_line_index->update(data, size);
+            });
+            // the lines with errors are indexed too, the index writer is removed before the builder is destroyed
+            outputs.emplace_back(new ebi::vcf::LineIndexReportWriter{*line_index});
+        }
+        std::istream tee_input{&tee};
+
+        // the validation may stop before the end of the input, but the next program and the checksums need all of it
+        bool is_valid;
+        try {
+            is_valid = validate(tee_input);
+        } catch (...) {
+            tee.drain();
+            std::cout.flush();
+            if (line_index) {
+                outputs.pop_back();
+            }
+            throw;
+        }
+        tee.drain();
+        std::cout.flush();
+
+        if (line_index) {
+            outputs.pop_back();
+            auto line_index_path = vm[ebi::vcf::LINE_INDEX].as<std::string>();
+            ebi::vcf::write_line_index(line_index_path, line_index->get_index());
+            BOOST_LOG_TRIVIAL(info) << "Wrote " << line_index->get_index().offsets.size() << " line offsets to "
+                                    << line_index_path;
+        }
+
+        for (auto & checksum : checksums) {
+            ebi::vcf::write_message(checksum->name() + " checksum of the input: " + checksum->hex_digest(), outputs);
+        }
+        return is_valid;
+    }
 }
 
 int main(int argc, char** argv)
@@ -205,24 +644,55 @@ int main(int argc, char** argv)
         ebi::vcf::Ploidy ploidy = get_ploidy(vm[ebi::vcf::PLOIDY].as<long>(), vm);
         ebi::vcf::ValidationLevel validationLevel = get_validation_level(level);
         auto outdir = get_output_path(vm[ebi::vcf::OUTDIR].as<std::string>(), path);
-        auto outputs = get_outputs(vm[ebi::vcf::REPORT].as<std::string>(), outdir);
+
+        std::unique_ptr<ebi::vcf::Checkpoint> checkpoint;
+        std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> outputs;
+        if (vm.count(ebi::vcf::RESUME)) {
+            checkpoint.reset(new ebi::vcf::Checkpoint(ebi::vcf::read_checkpoint(vm[ebi::vcf::RESUME].as<std::string>())));
+            outputs = ebi::vcf::resume_outputs(*checkpoint);
+        } else {
+            outputs = get_outputs(vm[ebi::vcf::REPORT].as<std::string>(), outdir);
+        }
+        if (vm.count(ebi::vcf::MAX_ERRORS) || vm.count(ebi::vcf::MAX_ERRORS_PER_TYPE)) {
+            outputs = get_limited_outputs(std::move(outputs), vm);
+        }
+
+        if (vm.count(ebi::vcf::MEMORY_LIMIT)) {
+            ebi::util::memory_budget().set_limit(vm[ebi::vcf::MEMORY_LIMIT].as<size_t>() * 1024 * 1024);
+        }
 
         if (path == ebi::vcf::STDIN) {
             BOOST_LOG_TRIVIAL(info) << "Reading from standard input...";
-            is_valid = ebi::vcf::is_valid_vcf_file(std::cin, path, validationLevel, ploidy, outputs);
+            is_valid = is_valid_vcf_file(std::cin, path, validationLevel, ploidy, outputs, checkpoint.get(), vm);
+        } else if (vm.count(ebi::vcf::FOLLOW)) {
+            BOOST_LOG_TRIVIAL(info) << "Following input file until it is complete...";
+            // the reports are flushed while waiting, so that they are up to date when the producer is slow
+            ebi::util::FollowStreambuf follow{path, get_follow_end(vm), std::chrono::milliseconds{1000},
+                                              ebi::util::default_follow_buffer_size,
+                                              [&outputs]() { ebi::vcf::flush_reports(outputs); }};
+            std::istream input{&follow};
+            is_valid = is_valid_vcf_file(input, path, validationLevel, ploidy, outputs, checkpoint.get(), vm);
         } else {
             BOOST_LOG_TRIVIAL(info) << "Reading from input file...";
             std::ifstream input{path};
             if (!input) {
                 throw std::runtime_error{"Couldn't open file " + path};
             } else {
-                is_valid = ebi::vcf::is_valid_vcf_file(input, path, validationLevel, ploidy, outputs);
+                is_valid = is_valid_vcf_file(input, path, validationLevel, ploidy, outputs, checkpoint.get(), vm);
             }
         }
 
+        if (vm.count(ebi::vcf::MEMORY_LIMIT)) {
+            write_memory_usage(outputs);
+        }
+
         BOOST_LOG_TRIVIAL(info) << "According to the VCF specification, the input file is " << (is_valid ? "" : "not ") << "valid";
         return !is_valid; // A valid file returns an exit code 0
 
+    } catch (ebi::vcf::ErrorLimitReached const & ex) {
+        BOOST_LOG_TRIVIAL(info) << ex.what();
+        BOOST_LOG_TRIVIAL(info) << "According to the VCF specification, the input file is not valid";
+        return 1;
     } catch (std::invalid_argument const & ex) {
         BOOST_LOG_TRIVIAL(error) << ex.what();
         return 1;
@@ -0,0 +1,126 @@
+/**
+ * Copyright 2014-2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <atomic>
+#include <csignal>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <pthread.h>
+
+#include <boost/program_options.hpp>
+
+#include "util/logger.hpp"
+#include "vcf/daemon.hpp"
+#include "vcf/string_constants.hpp"
+
+namespace
+{
+    namespace po = boost::program_options;
+
+    po::options_description build_command_line_options()
+    {
+        po::options_description description("Usage: vcf-validatord [OPTIONS]\nAllowed options");
+
+        description.add_options()
+            (ebi::vcf::HELP_OPTION, "Display this help")
+            (ebi::vcf::SOCKET_OPTION, po::value<std::string>()->default_value(ebi::vcf::default_daemon_socket), "Path of the UNIX domain socket to listen on")
+            (ebi::vcf::THREADS_OPTION, po::value<size_t>()->default_value(ebi::vcf::default_daemon_threads), "Amount of files validated at the same time")
+            (ebi::vcf::HEADER_CACHE_OPTION, po::value<std::string>(), "Directory where the validated meta and header sections are kept, so that files with the same header skip validating it again")
+        ;
+
+        return description;
+    }
+
+    int check_command_line_options(po::variables_map const & vm, po::options_description const & desc)
+    {
+        if (vm.count(ebi::vcf::HELP)) {
+            std::cout << desc << std::endl;
+            return -1;
+        }
+
+        if (vm[ebi::vcf::THREADS].as<size_t>() == 0) {
+            BOOST_LOG_TRIVIAL(error) << "The amount of threads must be greater than 0";
+            return 1;
+        }
+
+        return 0;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    ebi::util::init_boost_loggers();
+
+    po::options_description desc = build_command_line_options();
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    int check_options = check_command_line_options(vm, desc);
+    if (check_options < 0) { return 0; }
+    if (check_options > 0) { return check_options; }
+
+    try {
+        // SIGINT and SIGTERM are handled by a thread of their own, so that the daemon can stop cleanly
+        sigset_t signals;
+        sigemptyset(&signals);
+        sigaddset(&signals, SIGINT);
+        sigaddset(&signals, SIGTERM);
+        pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+        std::unique_ptr<ebi::vcf::HeaderCache> headerCache;
+        if (vm.count(ebi::vcf::HEADER_CACHE)) {
+            headerCache.reset(new ebi::vcf::HeaderCache{vm[ebi::vcf::HEADER_CACHE].as<std::string>()});
+        }
+        ebi::vcf::Daemon daemon{vm[ebi::vcf::SOCKET].as<std::string>(), vm[ebi::vcf::THREADS].as<size_t>(),
+                                std::move(headerCache)};
+
+        // the thread uses the daemon, so it is joined before the daemon is destroyed: if no signal arrived, it is
+        // woken with one that it ignores
+        std::atomic<bool> finished{false};
+        std::thread signal_handler{[&]() {
+            int signal;
+            sigwait(&signals, &signal);
+            if (finished) {
+                return;
+            }
+            BOOST_LOG_TRIVIAL(info) << "Stopping after the validations in progress...";
+            daemon.stop();
+        }};
+        auto join_signal_handler = [&]() {
+            finished = true;
+            pthread_kill(signal_handler.native_handle(), SIGTERM);
+            signal_handler.join();
+        };
+
+        try {
+            daemon.run();
+        } catch (...) {
+            join_signal_handler();
+            throw;
+        }
+        join_signal_handler();
+        return 0;
+
+    } catch (std::exception const &ex) {
+        BOOST_LOG_TRIVIAL(error) << ex.what();
+        return 1;
+    }
+}
@@ -29,5 +29,12 @@ namespace ebi
     {
         state.add_warning(std::unique_ptr<Error>(error));
     }
+
+    ErrorCounts const & AbortErrorPolicy::get_counts() const
+    {
+        // the errors are not counted
+        static ErrorCounts const no_counts{};
+        return no_counts;
+    }
   }
 }
@@ -0,0 +1,603 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <typeinfo>
+
+#include <boost/filesystem/operations.hpp>
+
+#include "util/checksum.hpp"
+#include "util/logger.hpp"
+#include "util/serialization.hpp"
+#include "util/stream_utils.hpp"
+#include "vcf/block_manifest.hpp"
+#include "vcf/error_classifier.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    namespace
+    {
+      std::string const block_manifest_magic = "VCFBM003";
+
+      /**
+       * Writes the class of an Error, its line and the fields needed to build it again with `read_error`. The
+       * classes are numbered by ErrorClassifier.
+       */
+      class ErrorWriter : public ErrorVisitor
+      {
+        public:
+          ErrorWriter(std::ostream &output) : output(output) { }
+
+          void write(Error &error)
+          {
+              error.apply_visitor(*this);
+          }
+
+          virtual void visit(Error &error) override { write_common(error); }
+          virtual void visit(MetaSectionError &error) override
+          {
+              write_common(error);
+              write_meta_fields(error);
+          }
+          virtual void visit(HeaderSectionError &error) override { write_common(error); }
+          virtual void visit(BodySectionError &error) override { write_common(error); }
+          virtual void visit(NoMetaDefinitionError &error) override
+          {
+              write_common(error);
+              util::write_string(output, error.column);
+              util::write_string(output, error.field);
+          }
+          virtual void visit(FileformatError &error) override
+          {
+              write_common(error);
+              write_meta_fields(error);
+          }
+          virtual void visit(ChromosomeBodyError &error) override { write_common(error); }
+          virtual void visit(PositionBodyError &error) override { write_common(error); }
+          virtual void visit(IdBodyError &error) override
+          {
+              write_common(error);
+              util::write_size(output, static_cast<size_t>(error.error_fix));
+          }
+          virtual void visit(ReferenceAlleleBodyError &error) override { write_common(error); }
+          virtual void visit(AlternateAllelesBodyError &error) override { write_common(error); }
+          virtual void visit(QualityBodyError &error) override { write_common(error); }
+          virtual void visit(FilterBodyError &error) override
+          {
+              write_common(error);
+              util::write_size(output, static_cast<size_t>(error.error_fix));
+              util::write_string(output, error.field);
+          }
+          virtual void visit(InfoBodyError &error) override
+          {
+              write_common(error);
+              util::write_size(output, static_cast<size_t>(error.error_fix));
+              util::write_string(output, error.field);
+              util::write_string(output, error.expected_value);
+          }
+          virtual void visit(FormatBodyError &error) override
+          {
+              write_common(error);
+              util::write_size(output, static_cast<size_t>(error.error_fix));
+          }
+          virtual void visit(SamplesBodyError &error) override { write_common(error); }
+          virtual void visit(SamplesFieldBodyError &error) override
+          {
+              write_common(error);
+              util::write_string(output, error.field);
+              util::write_size(output, static_cast<size_t>(error.field_cardinality));
+          }
+          virtual void visit(NormalizationError &error) override { write_common(error); }
+          virtual void visit(DuplicationError &error) override { write_common(error); }
+
+        private:
+          std::ostream &output;
+
+          void write_common(Error &error)
+          {
+              util::write_size(output, ErrorClassifier{}.classify(error));
+              util::write_size(output, error.line);
+              util::write_string(output, error.message);
+          }
+
+          void write_meta_fields(MetaSectionError &error)
+          {
+              util::write_size(output, static_cast<size_t>(error.error_fix));
+              util::write_string(output, error.value);
+              util::write_string(output, error.expected_value);
+          }
+      };
+
+      std::string serialize_error(Error &error)
+      {
+          std::ostringstream output;
+          ErrorWriter{output}.write(error);
+          return output.str();
+      }
+
+      /**
+       * Builds again an Error written by ErrorWriter, moving it `line_shift` lines
+       */
+      std::unique_ptr<Error> deserialize_error(std::string const &serialized, long long line_shift)
+      {
+          std::istringstream input{serialized};
+          size_t error_class = util::read_size(input);
+          size_t line = static_cast<size_t>(static_cast<long long>(util::read_size(input)) + line_shift);
+          std::string message = util::read_string(input);
+
+          switch (error_class) {
+          case ErrorClassifier::index<Error>():
+              return std::unique_ptr<Error>{new Error{line, message}};
+          case ErrorClassifier::index<MetaSectionError>():
+          case ErrorClassifier::index<FileformatError>(): {
+              ErrorFix error_fix = static_cast<ErrorFix>(util::read_size(input));
+              std::string value = util::read_string(input);
+              std::string expected_value = util::read_string(input);
+              if (error_class == ErrorClassifier::index<MetaSectionError>()) {
+                  return std::unique_ptr<Error>{new MetaSectionError{line, message, error_fix, value, expected_value}};
+              }
+              return std::unique_ptr<Error>{new FileformatError{line, message, error_fix, value, expected_value}};
+          }
+          case ErrorClassifier::index<HeaderSectionError>():
+              return std::unique_ptr<Error>{new HeaderSectionError{line, message}};
+          case ErrorClassifier::index<BodySectionError>():
+              return std::unique_ptr<Error>{new BodySectionError{line, message}};
+          case ErrorClassifier::index<NoMetaDefinitionError>(): {
+              std::string column = util::read_string(input);
+              std::string field = util::read_string(input);
+              return std::unique_ptr<Error>{new NoMetaDefinitionError{line, message, column, field}};
+          }
+          case ErrorClassifier::index<ChromosomeBodyError>():
+              return std::unique_ptr<Error>{new ChromosomeBodyError{line, message}};
+          case ErrorClassifier::index<PositionBodyError>():
+              return std::unique_ptr<Error>{new PositionBodyError{line, message}};
+          case ErrorClassifier::index<IdBodyError>():
+              return std::unique_ptr<Error>{new IdBodyError{line, message,
+                                                            static_cast<ErrorFix>(util::read_size(input))}};
+          case ErrorClassifier::index<ReferenceAlleleBodyError>():
+              return std::unique_ptr<Error>{new ReferenceAlleleBodyError{line, message}};
+          case ErrorClassifier::index<AlternateAllelesBodyError>():
+              return std::unique_ptr<Error>{new AlternateAllelesBodyError{line, message}};
+          case ErrorClassifier::index<QualityBodyError>():
+              return std::unique_ptr<Error>{new QualityBodyError{line, message}};
+          case ErrorClassifier::index<FilterBodyError>(): {
+              ErrorFix error_fix = static_cast<ErrorFix>(util::read_size(input));
+              return std::unique_ptr<Error>{new FilterBodyError{line, message, error_fix, util::read_string(input)}};
+          }
+          case ErrorClassifier::index<InfoBodyError>(): {
+              ErrorFix error_fix = static_cast<ErrorFix>(util::read_size(input));
+              std::string field = util::read_string(input);
+              std::string expected_value = util::read_string(input);
+              return std::unique_ptr<Error>{new InfoBodyError{line, message, error_fix, field, expected_value}};
+          }
+          case ErrorClassifier::index<FormatBodyError>():
+              return std::unique_ptr<Error>{new FormatBodyError{line, message,
+                                                                static_cast<ErrorFix>(util::read_size(input))}};
+          case ErrorClassifier::index<SamplesBodyError>():
+              return std::unique_ptr<Error>{new SamplesBodyError{line, message}};
+          case ErrorClassifier::index<SamplesFieldBodyError>(): {
+              std::string field = util::read_string(input);
+              long cardinality = static_cast<long>(util::read_size(input));
+              return std::unique_ptr<Error>{new SamplesFieldBodyError{line, message, field, cardinality}};
+          }
+          case ErrorClassifier::index<NormalizationError>():
+              return std::unique_ptr<Error>{new NormalizationError{line, message}};
+          case ErrorClassifier::index<DuplicationError>():
+              return std::unique_ptr<Error>{new DuplicationError{line, message}};
+          default:
+              throw std::runtime_error{"The block manifest contains an unknown class of error"};
+          }
+      }
+
+      /**
+       * Computes the hash of the lines of each block, and tells where a block ends
+       */
+      class BlockSplitter
+      {
+        public:
+          BlockSplitter() : lines{0} { }
+
+          /**
+           * @return whether the line is the last one of its block
+           */
+          bool add_line(std::vector<char> const &line)
+          {
+              if (lines == 0) {
+                  checksum = util::make_checksum(util::MD5);
+              }
+              checksum->update(line.data(), line.size());
+              ++lines;
+
+              // FNV-1a, only used to choose the boundaries
+              uint32_t line_hash = 2166136261u;
+              for (char c : line) {
+                  line_hash = (line_hash ^ static_cast<unsigned char>(c)) * 16777619u;
+              }
+              return lines >= block_max_lines || (lines >= block_min_lines && (line_hash & block_boundary_mask) == 0);
+          }
+
+          /**
+           * Returns the block of the lines added since the previous one, starting at `first_line`
+           */
+          ValidatedBlock finish_block(size_t first_line)
+          {
+              ValidatedBlock block{checksum->hex_digest(), first_line, lines, {}, {}, "", ""};
+              lines = 0;
+              return block;
+          }
+
+          size_t current_lines() const
+          {
+              return lines;
+          }
+
+        private:
+          std::unique_ptr<util::Checksum> checksum;
+          size_t lines;
+      };
+
+      std::string get_key(Parser const &validator, std::string const &settings)
+      {
+          std::ostringstream header_state;
+          validator.save_header(header_state);
+
+          auto checksum = util::make_checksum(util::SHA256);
+          std::string parser_type = typeid(validator).name();
+          checksum->update(parser_type.data(), parser_type.size() + 1);
+          checksum->update(settings.data(), settings.size() + 1);
+          std::string state = header_state.str();
+          checksum->update(state.data(), state.size());
+          return checksum->hex_digest();
+      }
+
+      std::string get_sorting_state(Parser const &validator)
+      {
+          std::ostringstream state;
+          validator.save_sorting(state);
+          return state.str();
+      }
+
+      std::string get_record_checks_state(Parser const &validator, size_t first_line)
+      {
+          std::ostringstream state;
+          validator.save_record_checks(state, first_line);
+          return state.str();
+      }
+
+      void keep_errors(Parser const &validator, ValidatedBlock &block)
+      {
+          for (auto &error : validator.errors()) {
+              block.errors.push_back(serialize_error(*error));
+          }
+          for (auto &error : validator.warnings()) {
+              block.warnings.push_back(serialize_error(*error));
+          }
+      }
+
+      void validate_line(std::vector<char> const &line,
+                         Parser &validator,
+                         std::vector<std::unique_ptr<ReportWriter>> &outputs,
+                         ValidatedBlock &block)
+      {
+          validator.parse(line);
+          write_errors(validator, outputs);
+          keep_errors(validator, block);
+      }
+
+      /**
+       * For each block, the index of the previous block with the same hash, or -1. After a match, the block that
+       * followed it is preferred, so that repeated blocks are matched in order.
+       */
+      std::vector<long> match_blocks(std::vector<ValidatedBlock> const &blocks,
+                                     std::vector<ValidatedBlock> const &previous_blocks)
+      {
+          std::multimap<std::string, size_t> previous_by_hash;
+          for (size_t i = 0; i < previous_blocks.size(); ++i) {
+              previous_by_hash.emplace(previous_blocks[i].hash, i);
+          }
+
+          std::vector<long> matches(blocks.size(), -1);
+          long last_match = -1;
+          for (size_t i = 0; i < blocks.size(); ++i) {
+              size_t next = static_cast<size_t>(last_match + 1);
+              if (last_match >= 0 && next < previous_blocks.size() && previous_blocks[next].hash == blocks[i].hash) {
+                  matches[i] = next;
+              } else {
+                  auto range = previous_by_hash.equal_range(blocks[i].hash);
+                  for (auto it = range.first; it != range.second; ++it) {
+                      if (matches[i] < 0 || static_cast<long>(it->second) > last_match) {
+                          matches[i] = it->second;
+                          if (static_cast<long>(it->second) > last_match) {
+                              break;
+                          }
+                      }
+                  }
+              }
+              if (matches[i] >= 0) {
+                  last_match = matches[i];
+              }
+          }
+          return matches;
+      }
+
+      /**
+       * Validates the whole body in one pass, keeping the errors of each block
+       */
+      bool validate_blocks(std::vector<char> &line,
+                           std::istream &input,
+                           Parser &validator,
+                           std::vector<std::unique_ptr<ReportWriter>> &outputs,
+                           size_t body_line,
+                           BlockManifest &manifest)
+      {
+          BlockSplitter splitter;
+          ValidatedBlock current{"", body_line, 0, {}, {}, get_sorting_state(validator),
+                                 get_record_checks_state(validator, body_line)};
+          ReportFlusher flusher;
+          for (; line.size() != 0; ebi::util::readline(input, line)) {
+              validate_line(line, validator, outputs, current);
+              flusher.line_validated(outputs);
+              if (splitter.add_line(line)) {
+                  ValidatedBlock block = splitter.finish_block(current.first_line);
+                  block.errors = std::move(current.errors);
+                  block.warnings = std::move(current.warnings);
+                  block.sorting_state = std::move(current.sorting_state);
+                  block.record_checks_state = std::move(current.record_checks_state);
+                  size_t next_line = block.first_line + block.lines;
+                  current = ValidatedBlock{"", next_line, 0, {}, {}, get_sorting_state(validator),
+                                           get_record_checks_state(validator, next_line)};
+                  manifest.blocks.push_back(std::move(block));
+              }
+          }
+
+          validator.end();
+          write_errors(validator, outputs);
+          if (splitter.current_lines() > 0) {
+              ValidatedBlock block = splitter.finish_block(current.first_line);
+              block.errors = std::move(current.errors);
+              block.warnings = std::move(current.warnings);
+              block.sorting_state = std::move(current.sorting_state);
+              block.record_checks_state = std::move(current.record_checks_state);
+              manifest.blocks.push_back(std::move(block));
+          }
+          if (not manifest.blocks.empty()) {
+              keep_errors(validator, manifest.blocks.back());
+          }
+
+          return validator.is_valid();
+      }
+    }
+
+    void write_block_manifest(std::string const &path, BlockManifest const &manifest)
+    {
+        boost::filesystem::path temporary_path{path};
+        temporary_path += boost::filesystem::unique_path(".%%%%%%%%.tmp");
+        {
+            std::ofstream file{temporary_path.string(), std::ios::binary};
+            file.write(block_manifest_magic.data(), block_manifest_magic.size());
+            util::write_string(file, manifest.key);
+            util::write_size(file, manifest.blocks.size());
+            for (auto &block : manifest.blocks) {
+                util::write_string(file, block.hash);
+                util::write_size(file, block.first_line);
+                util::write_size(file, block.lines);
+                util::write_size(file, block.errors.size());
+                for (auto &error : block.errors) {
+                    util::write_string(file, error);
+                }
+                util::write_size(file, block.warnings.size());
+                for (auto &warning : block.warnings) {
+                    util::write_string(file, warning);
+                }
+                util::write_string(file, block.sorting_state);
+                util::write_string(file, block.record_checks_state);
+            }
+
+            if (not file.flush()) {
+                throw std::runtime_error{"Couldn't write the block manifest " + temporary_path.string()};
+            }
+        }
+        boost::filesystem::rename(temporary_path, path);
+    }
+
+    BlockManifest read_block_manifest(std::string const &path)
+    {
+        std::ifstream file{path, std::ios::binary};
+        if (not file) {
+            throw std::runtime_error{"Couldn't open the block manifest " + path};
+        }
+        util::read_magic(file, block_manifest_magic);
+
+        BlockManifest manifest;
+        manifest.key = util::read_string(file);
+        for (size_t blocks = util::read_size(file); blocks > 0; --blocks) {
+            ValidatedBlock block;
+            block.hash = util::read_string(file);
+            block.first_line = util::read_size(file);
+            block.lines = util::read_size(file);
+            for (size_t errors = util::read_size(file); errors > 0; --errors) {
+                block.errors.push_back(util::read_string(file));
+            }
+            for (size_t warnings = util::read_size(file); warnings > 0; --warnings) {
+                block.warnings.push_back(util::read_string(file));
+            }
+            block.sorting_state = util::read_string(file);
+            block.record_checks_state = util::read_string(file);
+            manifest.blocks.push_back(std::move(block));
+        }
+        return manifest;
+    }
+
+    bool is_valid_vcf_file_blocks(std::istream &input,
+                                  const std::string &sourceName,
+                                  ValidationLevel validationLevel,
+                                  Ploidy ploidy,
+                                  std::vector<std::unique_ptr<ReportWriter>> &outputs,
+                                  std::string const &settings,
+                                  BlockManifest &manifest,
+                                  BlockManifest const *previous,
+                                  ValidationOptions const &validationOptions)
+    {
+        // the meta and header sections are always validated completely
+        std::vector<char> line;
+        size_t header_lines;
+        std::unique_ptr<Parser> validator = validate_up_to_body(line, input, sourceName, validationLevel, ploidy,
+                                                                outputs, validationOptions, &header_lines);
+        if (validator == nullptr) {
+            return false;
+        }
+        size_t body_line = header_lines + 1;
+        manifest.key = get_key(*validator, settings);
+        manifest.blocks.clear();
+
+        if (previous == nullptr) {
+            return validate_blocks(line, input, *validator, outputs, body_line, manifest);
+        }
+        if (previous->key != manifest.key) {
+            write_message("The previous manifest was written for another header or other settings, all the blocks "
+                          "will be validated", outputs);
+            return validate_blocks(line, input, *validator, outputs, body_line, manifest);
+        }
+
+        input.clear();
+        std::streamoff body_start = static_cast<std::streamoff>(input.tellg()) - line.size();
+        if (not input || body_start < 0) {
+            throw std::invalid_argument{"The input must be a seekable file to reuse a previous manifest"};
+        }
+
+        // first pass: split the body into blocks without validating it
+        std::vector<std::streamoff> offsets;
+        {
+            BlockSplitter splitter;
+            size_t first_line = body_line;
+            std::streamoff offset = body_start;
+            for (; line.size() != 0; ebi::util::readline(input, line)) {
+                if (splitter.current_lines() == 0) {
+                    offsets.push_back(offset);
+                }
+                offset += line.size();
+                if (splitter.add_line(line)) {
+                    manifest.blocks.push_back(splitter.finish_block(first_line));
+                    first_line += manifest.blocks.back().lines;
+                }
+            }
+            if (splitter.current_lines() > 0) {
+                manifest.blocks.push_back(splitter.finish_block(first_line));
+            }
+        }
+
+        // a block is reused if the block before it was also the same, so that it is validated with the same
+        // neighbours; the last one must also be the last one then, as it holds the errors found at the end of file
+        std::vector<ValidatedBlock> &blocks = manifest.blocks;
+        std::vector<ValidatedBlock> const &previous_blocks = previous->blocks;
+        std::vector<long> matches = match_blocks(blocks, previous_blocks);
+        auto is_reusable = [&](size_t i) {
+            return matches[i] >= 0
+                   && (i == 0 ? matches[i] == 0 : matches[i - 1] == matches[i] - 1)
+                   && (i + 1 < blocks.size() || static_cast<size_t>(matches[i]) + 1 == previous_blocks.size());
+        };
+
+        bool reused_errors = false;
+        size_t reused_blocks = 0;
+        size_t next_line = body_line;
+        bool positioned = false;
+        bool previous_validated = true;
+        for (size_t i = 0; i < blocks.size(); ++i) {
+            ValidatedBlock &block = blocks[i];
+            // after a reused block the states of the checks are the same as then, after a validated one they must be
+            // compared: e.g. a breakend mate expected from a changed block may be reported in this one
+            if (is_reusable(i) && (not previous_validated
+                                   || (get_sorting_state(*validator) == previous_blocks[matches[i]].sorting_state
+                                       && get_record_checks_state(*validator, block.first_line)
+                                          == previous_blocks[matches[i]].record_checks_state))) {
+                ValidatedBlock const &previous_block = previous_blocks[matches[i]];
+                block.sorting_state = previous_block.sorting_state;
+                block.record_checks_state = previous_block.record_checks_state;
+                long long line_shift = static_cast<long long>(block.first_line) - previous_block.first_line;
+                for (auto &serialized : previous_block.errors) {
+                    std::unique_ptr<Error> error = deserialize_error(serialized, line_shift);
+                    for (auto &output : outputs) {
+                        output->write_error(*error);
+                    }
+                    block.errors.push_back(serialize_error(*error));
+                    reused_errors = true;
+                }
+                for (auto &serialized : previous_block.warnings) {
+                    std::unique_ptr<Error> warning = deserialize_error(serialized, line_shift);
+                    for (auto &output : outputs) {
+                        output->write_warning(*warning);
+                    }
+                    block.warnings.push_back(serialize_error(*warning));
+                }
+                ++reused_blocks;
+                previous_validated = false;
+                continue;
+            }
+
+            if (not positioned || next_line != block.first_line) {
+                // the previous block is validated again without reporting it, so that the checks between records
+                // see the same neighbours as in a complete validation
+                size_t start = i == 0 ? 0 : i - 1;
+                validator->skip_lines(blocks[start].first_line - next_line);
+                validator->clear_previous_records();
+                if (start < i) {
+                    std::istringstream sorting_state{blocks[start].sorting_state};
+                    validator->restore_sorting(sorting_state);
+                    std::istringstream record_checks_state{blocks[start].record_checks_state};
+                    validator->restore_record_checks(record_checks_state, blocks[start].first_line);
+                }
+                input.clear();
+                input.seekg(offsets[start]);
+                next_line = blocks[start].first_line;
+                for (size_t j = 0; start < i && j < blocks[start].lines; ++j) {
+                    ebi::util::readline(input, line);
+                    validator->parse(line);
+                    ++next_line;
+                }
+                positioned = true;
+            }
+
+            block.sorting_state = get_sorting_state(*validator);
+            block.record_checks_state = get_record_checks_state(*validator, block.first_line);
+            previous_validated = true;
+            for (size_t j = 0; j < block.lines; ++j) {
+                ebi::util::readline(input, line);
+                validate_line(line, *validator, outputs, block);
+                ++next_line;
+            }
+            if (i + 1 == blocks.size()) {
+                validator->end();
+                write_errors(*validator, outputs);
+                keep_errors(*validator, block);
+            }
+        }
+        if (blocks.empty()) {
+            validator->end();
+            write_errors(*validator, outputs);
+        }
+
+        write_message("Validated " + std::to_string(blocks.size() - reused_blocks) + " blocks of lines, the results of "
+                      + std::to_string(reused_blocks) + " unchanged blocks were reused from the previous manifest",
+                      outputs);
+
+        return validator->is_valid() && not reused_errors;
+    }
+  }
+}
@@ -0,0 +1,271 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <cstring>
+
+#include "vcf/body_line_prefilter.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    namespace
+    {
+      enum CharClass : unsigned char
+      {
+          DIGIT = 1,
+          ALPHA = 2,
+          BASE = 4,         ///< A, C, G, T, N in any case
+          CHROM = 8,        ///< alphanumeric, '_', '.' or '-'
+          INFO_KEY = 16,    ///< alphanumeric, '_' or '.'
+          GRAPH = 32,       ///< printable but not a space
+          ALNUM = DIGIT | ALPHA
+      };
+
+      /**
+       * Class of each byte, as a mask of CharClass
+       */
+      struct CharClassTable
+      {
+          unsigned char classes[256];
+
+          CharClassTable()
+          {
+              std::memset(classes, 0, sizeof(classes));
+              for (int c = '!'; c <= '~'; ++c) {
+                  classes[c] |= GRAPH;
+              }
+              for (int c = '0'; c <= '9'; ++c) {
+                  classes[c] |= DIGIT | CHROM | INFO_KEY;
+              }
+              for (int c = 'a'; c <= 'z'; ++c) {
+                  classes[c] |= ALPHA | CHROM | INFO_KEY;
+                  classes[c - 'a' + 'A'] |= ALPHA | CHROM | INFO_KEY;
+              }
+              add("ACGTNacgtn", BASE);
+              add("_.-", CHROM);
+              add("_.", INFO_KEY);
+          }
+
+          void add(char const * characters, unsigned char char_class)
+          {
+              for (; *characters != '\0'; ++characters) {
+                  classes[static_cast<unsigned char>(*characters)] |= char_class;
+              }
+          }
+      };
+
+      CharClassTable const char_class_table;
+
+      inline bool is(char c, unsigned char char_class)
+      {
+          return (char_class_table.classes[static_cast<unsigned char>(c)] & char_class) != 0;
+      }
+
+      bool is_missing(char const * begin, char const * end)
+      {
+          return end - begin == 1 && *begin == '.';
+      }
+
+      bool is_all(char const * begin, char const * end, unsigned char char_class)
+      {
+          if (begin == end) {
+              return false;
+          }
+          for (; begin != end; ++begin) {
+              if (not is(*begin, char_class)) {
+                  return false;
+              }
+          }
+          return true;
+      }
+
+      /**
+       * Checks a list of non-empty values separated by `separator`, whose characters belong to `char_class`.
+       * The first character of each value must also belong to `first_class`.
+       */
+      bool is_list(char const * begin, char const * end, char separator, unsigned char char_class,
+                   unsigned char first_class)
+      {
+          bool value_start = true;
+          for (; begin != end; ++begin) {
+              if (*begin == separator) {
+                  if (value_start) {
+                      return false;
+                  }
+                  value_start = true;
+              } else if (is(*begin, value_start ? first_class : char_class)) {
+                  value_start = false;
+              } else {
+                  return false;
+              }
+          }
+          return not value_start;
+      }
+
+      bool is_list(char const * begin, char const * end, char separator, unsigned char char_class)
+      {
+          return is_list(begin, end, separator, char_class, char_class);
+      }
+
+      bool is_quality(char const * begin, char const * end)
+      {
+          if (is_missing(begin, end)) {
+              return true;
+          }
+          auto dot = static_cast<char const *>(std::memchr(begin, '.', end - begin));
+          if (dot == nullptr) {
+              return is_all(begin, end, DIGIT);
+          }
+          return is_all(begin, dot, DIGIT) && is_all(dot + 1, end, DIGIT);
+      }
+
+      bool is_info_entry(char const * begin, char const * end)
+      {
+          auto equals = static_cast<char const *>(std::memchr(begin, '=', end - begin));
+          char const * key_end = equals == nullptr ? end : equals;
+          if (begin == key_end || not (is(*begin, ALPHA) || *begin == '_') || not is_all(begin, key_end, INFO_KEY)) {
+              return false;
+          }
+          return equals == nullptr || is_list(equals + 1, end, ',', GRAPH);
+      }
+
+      bool is_info(char const * begin, char const * end)
+      {
+          if (is_missing(begin, end)) {
+              return true;
+          }
+          for (char const * entry = begin; ; ) {
+              auto semicolon = static_cast<char const *>(std::memchr(entry, ';', end - entry));
+              if (not is_info_entry(entry, semicolon == nullptr ? end : semicolon)) {
+                  return false;
+              }
+              if (semicolon == nullptr) {
+                  return true;
+              }
+              entry = semicolon + 1;
+          }
+      }
+
+      uint64_t const ones = 0x0101010101010101ULL;
+      uint64_t const high_bits = 0x8080808080808080ULL;
+
+      /**
+       * High bit of every byte of `word` that is equal to `c`, without carries between bytes
+       */
+      inline uint64_t equal_bytes(uint64_t word, char c)
+      {
+          uint64_t x = word ^ (ones * static_cast<unsigned char>(c));
+          return ~(((x & ~high_bits) + ~high_bits) | x) & high_bits;
+      }
+
+      /**
+       * High bit of every byte of `word` that is not printable or is a space, i.e. out of ['!', '~']
+       */
+      inline uint64_t non_graph_bytes(uint64_t word)
+      {
+          uint64_t below = ~((word & ~high_bits) + ones * (0x80 - '!')) & high_bits;
+          return (word & high_bits) | below | equal_bytes(word, 0x7F);
+      }
+
+      /**
+       * Checks the sample columns: tab-separated lists of printable values separated by ':', without empty values.
+       *
+       * The lines with many samples spend most of their time here, so it reads 8 bytes at a time and finds the
+       * wrong bytes and the empty values with bitwise operations, instead of looking up each byte.
+       */
+      bool is_sample_columns(char const * begin, char const * end)
+      {
+          if (begin == end || *begin == ':' || *begin == '\t' || end[-1] == ':' || end[-1] == '\t') {
+              return false;
+          }
+
+          char const * p = begin;
+          for (; end - p >= 8; p += 8) {
+              uint64_t word;
+              std::memcpy(&word, p, sizeof(word));
+              uint64_t tabs = equal_bytes(word, '\t');
+              uint64_t separators = tabs | equal_bytes(word, ':');
+              if ((non_graph_bytes(word) & ~tabs) != 0 || (separators & (separators << 8)) != 0) {
+                  return false;
+              }
+              // empty values between this word and the previous one
+              if (p != begin && separators != 0 && (p[-1] == ':' || p[-1] == '\t') && (*p == ':' || *p == '\t')) {
+                  return false;
+              }
+          }
+
+          for (char previous = p == begin ? 'x' : p[-1]; p != end; previous = *p++) {
+              bool separator = *p == ':' || *p == '\t';
+              if (not (separator || is(*p, GRAPH)) || (separator && (previous == ':' || previous == '\t'))) {
+                  return false;
+              }
+          }
+          return true;
+      }
+
+      bool is_column(size_t column, char const * begin, char const * end)
+      {
+          switch (column) {
+          case 1:
+              return begin != end && is(*begin, ALNUM) && is_all(begin, end, CHROM);
+          case 2:
+              return is_all(begin, end, DIGIT);
+          case 3:
+              return is_list(begin, end, ';', GRAPH);
+          case 4:
+              return is_all(begin, end, BASE);
+          case 5:
+              return is_missing(begin, end) || is_list(begin, end, ',', BASE);
+          case 6:
+              return is_quality(begin, end);
+          case 7:
+              return is_missing(begin, end) || is_list(begin, end, ';', ALNUM);
+          case 8:
+              return is_info(begin, end);
+          default:
+              return is_list(begin, end, ':', ALNUM, ALPHA);
+          }
+      }
+    }
+
+    bool is_well_formed_body_line(char const * begin, char const * end)
+    {
+        if (begin == end || end[-1] != '\n') {
+            return false;
+        }
+        --end;
+
+        size_t column = 0;
+        for (char const * field = begin; ; ) {
+            auto tab = static_cast<char const *>(std::memchr(field, '\t', end - field));
+            char const * field_end = tab == nullptr ? end : tab;
+            if (not is_column(++column, field, field_end)) {
+                return false;
+            }
+            if (tab == nullptr) {
+                return column == 8;
+            }
+            field = tab + 1;
+            if (column == 9) {
+                // a FORMAT column needs at least one sample
+                return is_sample_columns(field, end);
+            }
+        }
+    }
+  }
+}
@@ -0,0 +1,222 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <typeinfo>
+#include <vector>
+
+#include <boost/filesystem/operations.hpp>
+
+#include "util/checksum.hpp"
+#include "util/logger.hpp"
+#include "util/serialization.hpp"
+#include "util/stream_utils.hpp"
+#include "vcf/checkpoint.hpp"
+#include "vcf/summary_report_writer.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    namespace
+    {
+      std::string const checkpoint_magic = "VCFCP004";
+
+      /**
+       * Adds to `digest` the first `size` bytes of the input, leaving it at the same position
+       *
+       * @return whether the input has `size` bytes
+       */
+      bool update_digest(util::Md5 &digest, std::istream &input, std::streamoff size)
+      {
+          std::streamoff position = input.tellg();
+          if (position < 0 || not input.seekg(0)) {
+              throw std::runtime_error{"Checkpoints can only be used when validating a file"};
+          }
+
+          std::vector<char> buffer(1024 * 1024);
+          std::streamoff remaining = size;
+          while (remaining > 0) {
+              input.read(buffer.data(), std::min<std::streamoff>(remaining, buffer.size()));
+              if (input.gcount() == 0) {
+                  break;
+              }
+              digest.update(buffer.data(), input.gcount());
+              remaining -= input.gcount();
+          }
+
+          input.clear();
+          input.seekg(position);
+          return remaining == 0;
+      }
+    }
+
+    std::string input_digest(std::istream &input, std::streamoff size)
+    {
+        util::Md5 digest;
+        update_digest(digest, input, size);
+        return digest.hex_digest();
+    }
+
+    void write_checkpoint(CheckpointOptions const &options,
+                          std::streamoff input_offset,
+                          std::string const &input_digest,
+                          Parser const &validator,
+                          std::vector<std::unique_ptr<ReportWriter>> &outputs)
+    {
+        boost::filesystem::path temporary_path{options.path};
+        temporary_path += boost::filesystem::unique_path(".%%%%%%%%.tmp");
+        {
+            std::ofstream file{temporary_path.string(), std::ios::binary};
+            file.write(checkpoint_magic.data(), checkpoint_magic.size());
+            util::write_string(file, typeid(validator).name());
+            util::write_string(file, validator.grammar());
+            util::write_string(file, options.settings);
+            util::write_size(file, static_cast<size_t>(input_offset));
+            util::write_string(file, input_digest);
+
+            std::ostringstream parser_state;
+            validator.save(parser_state);
+            util::write_string(file, parser_state.str());
+
+            util::write_size(file, outputs.size());
+            for (auto &output : outputs) {
+                std::ostringstream report_state;
+                output->save(report_state);
+                util::write_string(file, report_state.str());
+            }
+
+            if (not file.flush()) {
+                throw std::runtime_error{"Couldn't write the checkpoint " + temporary_path.string()};
+            }
+        }
+        boost::filesystem::rename(temporary_path, options.path);
+        BOOST_LOG_TRIVIAL(debug) << "Checkpoint written at byte " << input_offset << " of the input";
+    }
+
+    Checkpoint read_checkpoint(std::string const &path)
+    {
+        std::ifstream file{path, std::ios::binary};
+        if (not file) {
+            throw std::runtime_error{"Couldn't open the checkpoint " + path};
+        }
+        util::read_magic(file, checkpoint_magic);
+
+        Checkpoint checkpoint;
+        checkpoint.parser_type = util::read_string(file);
+        checkpoint.parser_grammar = util::read_string(file);
+        checkpoint.settings = util::read_string(file);
+        checkpoint.input_offset = static_cast<std::streamoff>(util::read_size(file));
+        checkpoint.input_digest = util::read_string(file);
+        checkpoint.parser_state = util::read_string(file);
+        for (size_t count = util::read_size(file); count > 0; --count) {
+            checkpoint.report_states.push_back(util::read_string(file));
+        }
+        return checkpoint;
+    }
+
+    std::vector<std::unique_ptr<ReportWriter>> resume_outputs(Checkpoint const &checkpoint)
+    {
+        std::vector<std::unique_ptr<ReportWriter>> outputs;
+        for (auto &report_state : checkpoint.report_states) {
+            std::istringstream saved{report_state};
+            outputs.emplace_back(new SummaryReportWriter(saved));
+        }
+        return outputs;
+    }
+
+    bool is_valid_vcf_file_checkpointed(std::istream &input,
+                                        const std::string &sourceName,
+                                        ValidationLevel validationLevel,
+                                        Ploidy ploidy,
+                                        std::vector<std::unique_ptr<ReportWriter>> &outputs,
+                                        CheckpointOptions const &options,
+                                        Checkpoint const *resume,
+                                        ValidationOptions const &validationOptions)
+    {
+        std::vector<char> line;
+        std::unique_ptr<Parser> validator = build_input_parser(line, input, sourceName, validationLevel, ploidy,
+                                                               outputs, validationOptions);
+        if (validator == nullptr) {
+            return false;
+        }
+
+        // digest of the input before `offset`, to tell when resuming whether the input is the same
+        util::Md5 digest;
+        std::streamoff offset = 0;
+        if (resume != nullptr) {
+            if (resume->parser_type != typeid(*validator).name()) {
+                throw std::invalid_argument{"The checkpoint was written with another validation level or VCF version"};
+            }
+            if (resume->parser_grammar != validator->grammar()) {
+                throw std::invalid_argument{"The checkpoint was written by a build of the validator with another "
+                                            "grammar, the validation must be started again"};
+            }
+            if (resume->settings != options.settings) {
+                throw std::invalid_argument{"The checkpoint was written with other options (" + resume->settings
+                                            + "), the validation must be resumed with the same ones"};
+            }
+            if (not update_digest(digest, input, resume->input_offset)
+                    || util::Md5{digest}.hex_digest() != resume->input_digest) {
+                throw std::invalid_argument{"The input is not the one validated before the checkpoint, or it was "
+                                            "modified since then, the validation must be started again"};
+            }
+            std::istringstream parser_state{resume->parser_state};
+            validator->restore(parser_state);
+            offset = resume->input_offset;
+            input.seekg(offset);
+            if (not input) {
+                throw std::runtime_error{"Couldn't continue reading the input from byte " + std::to_string(offset)};
+            }
+            ebi::util::readline(input, line);
+            BOOST_LOG_TRIVIAL(info) << "Resuming the validation from byte " << offset << " of the input";
+        } else {
+            validate_header(line, input, *validator, outputs, validationOptions.header_cache);
+            if (line.size() != 0) {
+                // the first line of the body has already been read
+                offset = input.tellg() - static_cast<std::streamoff>(line.size());
+                if (offset < 0) {
+                    throw std::invalid_argument{"Checkpoints can only be written when validating a file"};
+                }
+                update_digest(digest, input, offset);
+            }
+        }
+
+        std::streamoff next_checkpoint = offset + options.interval;
+        ReportFlusher flusher;
+        while (line.size() != 0) {
+            validator->parse(line);
+            write_errors(*validator, outputs);
+            flusher.line_validated(outputs);
+            offset += line.size();
+            digest.update(line.data(), line.size());
+            if (offset >= next_checkpoint) {
+                write_checkpoint(options, offset, util::Md5{digest}.hex_digest(), *validator, outputs);
+                next_checkpoint = offset + options.interval;
+            }
+            ebi::util::readline(input, line);
+        }
+
+        validator->end();
+        write_errors(*validator, outputs);
+
+        boost::filesystem::remove(options.path);
+        return validator->is_valid();
+    }
+  }
+}
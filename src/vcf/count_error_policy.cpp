@@ -0,0 +1,51 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "vcf/error_policy.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    CountErrorPolicy::CountErrorPolicy()
+            : counts{std::vector<size_t>(ErrorClassifier::names().size(), 0),
+                     std::vector<size_t>(ErrorClassifier::names().size(), 0)}
+    {
+    }
+
+    void CountErrorPolicy::handle_error(ParsingState &state, Error *error)
+    {
+        std::unique_ptr<Error> owned_error{error};
+        state.m_is_valid = false;
+        if (counts.errors[classifier.classify(*error)]++ == 0) {
+            state.add_error(std::move(owned_error));
+        }
+    }
+
+    void CountErrorPolicy::handle_warning(ParsingState &state, Error *error)
+    {
+        std::unique_ptr<Error> owned_error{error};
+        if (counts.warnings[classifier.classify(*error)]++ == 0) {
+            state.add_warning(std::move(owned_error));
+        }
+    }
+
+    ErrorCounts const & CountErrorPolicy::get_counts() const
+    {
+        return counts;
+    }
+  }
+}
@@ -0,0 +1,428 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <limits>
+
+#include "util/memory_budget.hpp"
+#include "util/serialization.hpp"
+#include "util/string_utils.hpp"
+#include "vcf/cross_record_checker.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    namespace
+    {
+      size_t const no_contig = std::numeric_limits<size_t>::max();
+
+      size_t const reference_block_memory = util::tree_node_overhead + 2 * sizeof(size_t);
+
+      size_t id_memory(std::string const & id)
+      {
+          // an entry in the hash table plus another one in the deque
+          return 2 * sizeof(void *) + sizeof(std::pair<std::string, size_t>) + sizeof(std::pair<size_t, std::string>)
+                 + 2 * util::heap_size(id);
+      }
+
+      /**
+       * Reads the position of the mate in a breakend such as "G]17:198982]" or "[13:123456[T"
+       *
+       * @return false if there is no position, or it is in an assembly contig such as "<ctg1>"
+       */
+      bool get_mate_location(std::string const & alternate, std::string & contig, size_t & position)
+      {
+          size_t open = alternate.find_first_of("[]");
+          if (open == std::string::npos) {
+              return false;
+          }
+          size_t close = alternate.find(alternate[open], open + 1);
+          if (close == std::string::npos) {
+              return false;
+          }
+          size_t colon = alternate.rfind(':', close);
+          if (colon == std::string::npos || colon <= open + 1 || alternate[open + 1] == '<') {
+              return false;
+          }
+
+          contig = alternate.substr(open + 1, colon - open - 1);
+          try {
+              position = std::stoul(alternate.substr(colon + 1, close - colon - 1));
+          } catch (std::logic_error const &) {
+              return false;
+          }
+          return true;
+      }
+    }
+
+    CrossRecordChecker::CrossRecordChecker(size_t id_window)
+            : id_window{id_window}, current_contig{no_contig}, first_contig{no_contig}, first_position{0},
+              reserved{0}, degraded{false}
+    {
+    }
+
+    CrossRecordChecker::~CrossRecordChecker()
+    {
+        util::memory_budget().release(reserved);
+    }
+
+    std::vector<std::unique_ptr<Error>> CrossRecordChecker::check(Record const & record)
+    {
+        std::vector<std::unique_ptr<Error>> warnings;
+
+        size_t contig = current_contig;
+        if (contig == no_contig || record.chromosome != contig_names[contig]) {
+            contig = intern(record.chromosome);
+        }
+        move_to(contig, record.position, warnings);
+
+        check_reference_blocks(record, warnings);
+        if (record.source->version == Version::v43) {
+            check_ids(record, warnings);
+        }
+        check_mates(record, warnings);
+
+        return warnings;
+    }
+
+    void CrossRecordChecker::clear()
+    {
+        for (auto & mates : pending_mates) {
+            mates.clear();
+        }
+        std::fill(contig_seen.begin(), contig_seen.end(), false);
+        current_contig = no_contig;
+        first_contig = no_contig;
+        reference_blocks.clear();
+        id_lines.clear();
+        id_positions.clear();
+        release(reserved);
+    }
+
+    std::vector<std::unique_ptr<Error>> CrossRecordChecker::finish()
+    {
+        std::vector<std::unique_ptr<Error>> warnings;
+        for (size_t contig = 0; contig < pending_mates.size(); ++contig) {
+            expire_mates(contig, std::numeric_limits<size_t>::max(), warnings);
+        }
+        std::stable_sort(warnings.begin(), warnings.end(),
+                         [](std::unique_ptr<Error> const & a, std::unique_ptr<Error> const & b) {
+                             return a->line < b->line;
+                         });
+        clear();
+        return warnings;
+    }
+
+    void CrossRecordChecker::write_state(std::ostream & output, size_t first_line) const
+    {
+        std::vector<size_t> contigs;
+        for (size_t contig = 0; contig < contig_names.size(); ++contig) {
+            if (contig_seen[contig] || not pending_mates[contig].empty()) {
+                contigs.push_back(contig);
+            }
+        }
+        // the lines kept are before `first_line`: their differences wrap around, and read_state undoes it
+        util::write_size(output, contigs.size());
+        for (size_t contig : contigs) {
+            util::write_string(output, contig_names[contig]);
+            util::write_size(output, contig_seen[contig]);
+            util::write_size(output, pending_mates[contig].size());
+            for (auto & mate : pending_mates[contig]) {
+                util::write_size(output, mate.first);
+                util::write_string(output, mate.second.id);
+                util::write_string(output, mate.second.mate_id);
+                util::write_size(output, mate.second.line - first_line);
+            }
+        }
+
+        util::write_string(output, current_contig == no_contig ? "" : contig_names[current_contig]);
+        util::write_string(output, first_contig == no_contig ? "" : contig_names[first_contig]);
+        util::write_size(output, first_position);
+
+        util::write_size(output, reference_blocks.size());
+        for (auto & block : reference_blocks) {
+            util::write_size(output, block.first);
+            util::write_size(output, block.second - first_line);
+        }
+
+        util::write_size(output, id_positions.size());
+        for (auto & entry : id_positions) {
+            util::write_size(output, entry.first);
+            util::write_string(output, entry.second);
+            util::write_size(output, id_lines.at(entry.second) - first_line);
+        }
+    }
+
+    void CrossRecordChecker::read_state(std::istream & input, size_t first_line)
+    {
+        struct SavedContig
+        {
+            std::string name;
+            bool seen;
+            std::vector<std::pair<size_t, PendingMate>> mates;
+        };
+        std::vector<SavedContig> contigs(util::read_size(input));
+        for (auto & contig : contigs) {
+            contig.name = util::read_string(input);
+            contig.seen = util::read_size(input) != 0;
+            contig.mates.resize(util::read_size(input));
+            for (auto & mate : contig.mates) {
+                mate.first = util::read_size(input);
+                mate.second.id = util::read_string(input);
+                mate.second.mate_id = util::read_string(input);
+                mate.second.line = util::read_size(input) + first_line;
+            }
+        }
+
+        std::string current_name = util::read_string(input);
+        std::string first_name = util::read_string(input);
+        size_t first_position = util::read_size(input);
+
+        std::vector<std::pair<size_t, size_t>> blocks(util::read_size(input));
+        for (auto & block : blocks) {
+            block.first = util::read_size(input);
+            block.second = util::read_size(input) + first_line;
+        }
+
+        std::vector<std::pair<size_t, std::pair<std::string, size_t>>> ids(util::read_size(input));
+        for (auto & id : ids) {
+            id.first = util::read_size(input);
+            id.second.first = util::read_string(input);
+            id.second.second = util::read_size(input) + first_line;
+        }
+
+        clear();
+        for (auto & contig : contigs) {
+            size_t index = intern(contig.name);
+            contig_seen[index] = contig.seen;
+            for (auto & mate : contig.mates) {
+                if (reserve(memory(mate.second))) {
+                    pending_mates[index].emplace(mate.first, std::move(mate.second));
+                }
+            }
+        }
+        current_contig = current_name.empty() ? no_contig : intern(current_name);
+        first_contig = first_name.empty() ? no_contig : intern(first_name);
+        this->first_position = first_position;
+        for (auto & block : blocks) {
+            if (reserve(reference_block_memory)) {
+                reference_blocks.emplace(block.first, block.second);
+            }
+        }
+        for (auto & id : ids) {
+            if (reserve(id_memory(id.second.first))) {
+                id_lines.emplace(id.second.first, id.second.second);
+                id_positions.emplace_back(id.first, id.second.first);
+            }
+        }
+    }
+
+    size_t CrossRecordChecker::intern(std::string const & contig)
+    {
+        auto inserted = contig_ids.emplace(contig, contig_names.size());
+        if (inserted.second) {
+            contig_names.push_back(contig);
+            contig_seen.push_back(false);
+            pending_mates.emplace_back();
+        }
+        return inserted.first->second;
+    }
+
+    size_t CrossRecordChecker::memory(PendingMate const & mate)
+    {
+        return util::tree_node_overhead + sizeof(std::pair<size_t const, PendingMate>) + util::heap_size(mate.id)
+               + util::heap_size(mate.mate_id);
+    }
+
+    bool CrossRecordChecker::reserve(size_t bytes)
+    {
+        if (util::memory_budget().reserve(bytes)) {
+            reserved += bytes;
+            return true;
+        }
+        if (not degraded) {
+            degraded = true;
+            util::memory_budget().add_note("The memory limit was reached, so some rules between records (gVCF "
+                                           "blocks, breakend mates and repeated IDs) were not checked");
+        }
+        return false;
+    }
+
+    void CrossRecordChecker::release(size_t bytes)
+    {
+        util::memory_budget().release(bytes);
+        reserved -= bytes;
+    }
+
+    void CrossRecordChecker::move_to(size_t contig, size_t position, std::vector<std::unique_ptr<Error>> & warnings)
+    {
+        if (contig != current_contig) {
+            if (current_contig == no_contig) {
+                first_contig = contig;
+                first_position = position;
+            } else {
+                // the mates expected in the previous contig can't be found anymore
+                expire_mates(current_contig, std::numeric_limits<size_t>::max(), warnings);
+            }
+            release(reference_blocks.size() * reference_block_memory);
+            reference_blocks.clear();
+            forget_ids();
+
+            current_contig = contig;
+            contig_seen[contig] = true;
+        }
+        expire_mates(contig, position, warnings);
+    }
+
+    void CrossRecordChecker::expire_mates(size_t contig, size_t before_position,
+                                          std::vector<std::unique_ptr<Error>> & warnings)
+    {
+        auto & mates = pending_mates[contig];
+        auto end = mates.lower_bound(before_position);
+        for (auto it = mates.begin(); it != end; it = mates.erase(it)) {
+            warnings.emplace_back(new InfoBodyError{it->second.line,
+                    "Breakend mate " + it->second.mate_id + " from INFO MATEID was not found at "
+                    + contig_names[contig] + ":" + std::to_string(it->first),
+                    ErrorFix::IRRECOVERABLE_VALUE, MATEID});
+            release(memory(it->second));
+        }
+    }
+
+    void CrossRecordChecker::check_reference_blocks(Record const & record,
+                                                    std::vector<std::unique_ptr<Error>> & warnings)
+    {
+        // the blocks that end before this record can't overlap it nor the following ones
+        auto end = reference_blocks.lower_bound(record.position);
+        release(std::distance(reference_blocks.begin(), end) * reference_block_memory);
+        reference_blocks.erase(reference_blocks.begin(), end);
+
+        if (not reference_blocks.empty()) {
+            auto last = std::prev(reference_blocks.end());
+            warnings.emplace_back(new PositionBodyError{record.line,
+                    "Position overlaps the gVCF reference block from line " + std::to_string(last->second)
+                    + ", that ends at " + std::to_string(last->first)});
+        }
+
+        auto block_end = record.info.find(END);
+        if (block_end == record.info.end()
+            || std::find(record.alternate_alleles.begin(), record.alternate_alleles.end(), GVCF_NON_VARIANT_ALLELE)
+               == record.alternate_alleles.end()) {
+            return;
+        }
+        size_t end_position;
+        try {
+            end_position = std::stoul(block_end->second);
+        } catch (std::logic_error const &) {
+            // a wrong END is already reported by the checks of the record
+            return;
+        }
+        if (end_position >= record.position && reserve(reference_block_memory)) {
+            reference_blocks.emplace(end_position, record.line);
+        }
+    }
+
+    void CrossRecordChecker::check_ids(Record const & record, std::vector<std::unique_ptr<Error>> & warnings)
+    {
+        while (not id_positions.empty() && id_positions.front().first + id_window < record.position) {
+            release(id_memory(id_positions.front().second));
+            id_lines.erase(id_positions.front().second);
+            id_positions.pop_front();
+        }
+
+        for (auto & id : record.ids) {
+            if (id == MISSING_VALUE) {
+                continue;
+            }
+            auto found = id_lines.find(id);
+            if (found != id_lines.end()) {
+                // the same ID repeated in one record is already reported by the checks of the record
+                if (found->second != record.line) {
+                    warnings.emplace_back(new IdBodyError{record.line,
+                            "ID " + id + " should not be used in more than one record, it was used in line "
+                            + std::to_string(found->second)});
+                }
+            } else if (reserve(id_memory(id))) {
+                id_lines.emplace(id, record.line);
+                id_positions.emplace_back(record.position, id);
+            }
+        }
+    }
+
+    void CrossRecordChecker::check_mates(Record const & record, std::vector<std::unique_ptr<Error>> & warnings)
+    {
+        // the previous breakends that expected this record are resolved
+        std::vector<std::string> resolved_mates;
+        auto & mates = pending_mates[current_contig];
+        auto range = mates.equal_range(record.position);
+        for (auto it = range.first; it != range.second; ) {
+            if (std::find(record.ids.begin(), record.ids.end(), it->second.mate_id) != record.ids.end()) {
+                resolved_mates.push_back(it->second.id);
+                release(memory(it->second));
+                it = mates.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        auto mate_ids_value = record.info.find(MATEID);
+        if (mate_ids_value == record.info.end()) {
+            return;
+        }
+        std::vector<std::string> mate_ids;
+        util::string_split(mate_ids_value->second, ",", mate_ids);
+
+        // each breakend allele is paired with the MATEID in the same order
+        size_t mate_index = 0;
+        for (size_t i = 0; i < record.alternate_alleles.size() && mate_index < mate_ids.size(); ++i) {
+            if (record.types[i] != RecordType::STRUCTURAL_BREAKEND) {
+                continue;
+            }
+            std::string const & mate_id = mate_ids[mate_index++];
+            std::string mate_contig_name;
+            size_t mate_position;
+            if (not get_mate_location(record.alternate_alleles[i], mate_contig_name, mate_position)) {
+                continue;
+            }
+
+            size_t mate_contig = intern(mate_contig_name);
+            if (not contig_seen[mate_contig] || (mate_contig == current_contig && mate_position >= record.position)) {
+                // the mate will be read later
+                PendingMate mate{record.ids.empty() ? MISSING_VALUE : record.ids[0], mate_id, record.line};
+                if (reserve(memory(mate))) {
+                    pending_mates[mate_contig].emplace(mate_position, std::move(mate));
+                }
+            } else if ((mate_contig != first_contig || mate_position >= first_position)
+                       && std::find(resolved_mates.begin(), resolved_mates.end(), mate_id) == resolved_mates.end()) {
+                // the mate was already read and, if it was right, it expected this record
+                warnings.emplace_back(new InfoBodyError{record.line,
+                        "Breakend mate " + mate_id + " from INFO MATEID was not found at " + mate_contig_name + ":"
+                        + std::to_string(mate_position) + " with a MATEID pointing to this record",
+                        ErrorFix::IRRECOVERABLE_VALUE, MATEID});
+            }
+        }
+    }
+
+    void CrossRecordChecker::forget_ids()
+    {
+        for (auto & entry : id_positions) {
+            release(id_memory(entry.second));
+        }
+        id_lines.clear();
+        id_positions.clear();
+    }
+  }
+}
@@ -0,0 +1,436 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "util/logger.hpp"
+#include "vcf/daemon.hpp"
+#include "vcf/string_constants.hpp"
+#include "vcf/summary_report_writer.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    namespace
+    {
+      size_t const socket_buffer_size = 64 * 1024;
+
+      /**
+       * Input stream buffer over a socket, to read requests, inputs and answers with the usual stream functions
+       */
+      class SocketStreambuf : public std::streambuf
+      {
+        public:
+          SocketStreambuf(int socket) : socket(socket), buffer(socket_buffer_size) { }
+
+        protected:
+          virtual int_type underflow() override
+          {
+              if (gptr() < egptr()) {
+                  return traits_type::to_int_type(*gptr());
+              }
+
+              ssize_t read;
+              do {
+                  read = ::recv(socket, buffer.data(), buffer.size(), 0);
+              } while (read < 0 && errno == EINTR);
+              if (read <= 0) {
+                  return traits_type::eof();
+              }
+
+              setg(buffer.data(), buffer.data(), buffer.data() + read);
+              return traits_type::to_int_type(*gptr());
+          }
+
+        private:
+          int socket;
+          std::vector<char> buffer;
+      };
+
+      /**
+       * @return false if the other side closed the connection
+       */
+      bool send_all(int socket, char const * data, size_t size)
+      {
+          while (size > 0) {
+              ssize_t sent = ::send(socket, data, size, MSG_NOSIGNAL);
+              if (sent < 0 && errno == EINTR) {
+                  continue;
+              }
+              if (sent <= 0) {
+                  return false;
+              }
+              data += sent;
+              size -= static_cast<size_t>(sent);
+          }
+          return true;
+      }
+
+      bool send_all(int socket, std::string const & text)
+      {
+          return send_all(socket, text.data(), text.size());
+      }
+
+      sockaddr_un get_socket_address(std::string const & socket_path)
+      {
+          sockaddr_un address;
+          std::memset(&address, 0, sizeof(address));
+          address.sun_family = AF_UNIX;
+          if (socket_path.size() >= sizeof(address.sun_path)) {
+              throw std::invalid_argument{"The socket path is too long: " + socket_path};
+          }
+          std::strcpy(address.sun_path, socket_path.c_str());
+          return address;
+      }
+
+      /**
+       * @return whether a daemon is accepting connections on the socket
+       */
+      bool is_listening(sockaddr_un const & address)
+      {
+          int probe = ::socket(AF_UNIX, SOCK_STREAM, 0);
+          if (probe < 0) {
+              return false;
+          }
+          bool connected = ::connect(probe, reinterpret_cast<sockaddr const *>(&address), sizeof(address)) == 0;
+          ::close(probe);
+          return connected;
+      }
+
+      /**
+       * @return whether the process at the other side of the connection runs as the same user as the daemon
+       */
+      bool is_same_user(int connection)
+      {
+#ifdef SO_PEERCRED
+          ucred credentials;
+          socklen_t size = sizeof(credentials);
+          if (::getsockopt(connection, SOL_SOCKET, SO_PEERCRED, &credentials, &size) < 0) {
+              return false;
+          }
+          return credentials.uid == ::geteuid();
+#else
+          uid_t uid;
+          gid_t gid;
+          return ::getpeereid(connection, &uid, &gid) == 0 && uid == ::geteuid();
+#endif
+      }
+
+      /**
+       * Sends the lines of the text report through the socket, skipping the same ones as SummaryReportWriter
+       */
+      class SocketReportWriter : public ReportWriter
+      {
+        public:
+          SocketReportWriter(int socket) : socket(socket) { }
+
+          virtual void write_error(Error &error) override
+          {
+              send_all(socket, std::string{"report\t"} + error.what() + "\n");
+          }
+
+          virtual void write_warning(Error &error) override
+          {
+              if (summary.should_write_report(error)) {
+                  send_all(socket, std::string{"report\t"} + error.what() + " (warning)\n");
+              }
+          }
+
+          virtual void write_batch(std::vector<std::unique_ptr<Error>> const &errors, Severity severity) override
+          {
+              // one system call for the whole batch
+              std::string lines;
+              for (auto &error : errors) {
+                  if (severity == Severity::ERROR) {
+                      lines += std::string{"report\t"} + error->what() + "\n";
+                  } else if (summary.should_write_report(*error)) {
+                      lines += std::string{"report\t"} + error->what() + " (warning)\n";
+                  }
+              }
+              if (not lines.empty()) {
+                  send_all(socket, lines);
+              }
+          }
+
+          virtual void write_message(std::string const &message) override
+          {
+              send_all(socket, "report\t" + message + "\n");
+          }
+
+        private:
+          int socket;
+          SummaryTracker summary;
+      };
+
+      ValidationLevel parse_level(std::string const & level)
+      {
+          if (level == ERROR) {
+              return ValidationLevel::error;
+          } else if (level == WARNING) {
+              return ValidationLevel::warning;
+          } else if (level == STOP) {
+              return ValidationLevel::stop;
+          } else if (level == COUNT) {
+              return ValidationLevel::count;
+          }
+          throw std::invalid_argument{"Please choose one of the accepted validation levels"};
+      }
+
+      DaemonRequest read_request(std::istream & input)
+      {
+          DaemonRequest request{STDIN, WARNING, 2, ""};
+          std::string line;
+          while (std::getline(input, line) && not line.empty()) {
+              size_t equals = line.find('=');
+              std::string key = line.substr(0, equals);
+              std::string value = equals == std::string::npos ? "" : line.substr(equals + 1);
+              if (key == INPUT) {
+                  request.input = value;
+              } else if (key == LEVEL) {
+                  request.level = value;
+              } else if (key == PLOIDY) {
+                  request.ploidy = std::stol(value);
+              } else if (key == SPECIAL_PLOIDY) {
+                  request.special_ploidy = value;
+              } else {
+                  throw std::invalid_argument{"Unknown field in the request: " + key};
+              }
+          }
+          return request;
+      }
+
+      std::string write_request(DaemonRequest const & request)
+      {
+          return std::string{INPUT} + "=" + request.input + "\n"
+                  + LEVEL + "=" + request.level + "\n"
+                  + PLOIDY + "=" + std::to_string(request.ploidy) + "\n"
+                  + SPECIAL_PLOIDY + "=" + request.special_ploidy + "\n"
+                  + "\n";
+      }
+    }
+
+    Daemon::Daemon(std::string const & socket_path, size_t threads, std::unique_ptr<HeaderCache> headerCache)
+            : socket_path{socket_path}, headerCache{std::move(headerCache)}, stopping{false}
+    {
+        sockaddr_un address = get_socket_address(socket_path);
+
+        // only the socket of a daemon that is not running anymore is replaced
+        struct stat status;
+        if (::lstat(socket_path.c_str(), &status) == 0) {
+            if (not S_ISSOCK(status.st_mode)) {
+                throw std::runtime_error{"Couldn't listen on " + socket_path + ": it exists and is not a socket"};
+            }
+            if (is_listening(address)) {
+                throw std::runtime_error{"Couldn't listen on " + socket_path + ": another daemon is using it"};
+            }
+            ::unlink(socket_path.c_str());
+        }
+
+        listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listener < 0) {
+            throw std::runtime_error{std::string{"Couldn't create the socket: "} + std::strerror(errno)};
+        }
+
+        // no connection can be made before listen, so other users never reach the socket
+        if (::bind(listener, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0
+                || ::chmod(socket_path.c_str(), S_IRUSR | S_IWUSR) < 0
+                || ::listen(listener, SOMAXCONN) < 0) {
+            std::string reason = std::strerror(errno);
+            ::close(listener);
+            throw std::runtime_error{"Couldn't listen on " + socket_path + ": " + reason};
+        }
+
+        for (size_t i = 0; i < std::max(threads, size_t{1}); ++i) {
+            workers.emplace_back(&Daemon::work, this);
+        }
+    }
+
+    Daemon::~Daemon()
+    {
+        stop();
+        for (auto & worker : workers) {
+            worker.join();
+        }
+        ::close(listener);
+        ::unlink(socket_path.c_str());
+    }
+
+    void Daemon::run()
+    {
+        BOOST_LOG_TRIVIAL(info) << "Listening on " << socket_path << " with " << workers.size() << " threads";
+        while (not stopping) {
+            int connection = ::accept(listener, nullptr, nullptr);
+            if (connection < 0) {
+                if (stopping) {
+                    break;
+                }
+                if (errno == EINTR || errno == ECONNABORTED) {
+                    continue;
+                }
+                throw std::runtime_error{std::string{"Couldn't accept a connection: "} + std::strerror(errno)};
+            }
+
+            std::lock_guard<std::mutex> lock{pending_mutex};
+            pending.push_back(connection);
+            pending_changed.notify_one();
+        }
+    }
+
+    void Daemon::stop()
+    {
+        if (not stopping.exchange(true)) {
+            // wakes up the blocked accept
+            ::shutdown(listener, SHUT_RDWR);
+        }
+        std::lock_guard<std::mutex> lock{pending_mutex};
+        pending_changed.notify_all();
+    }
+
+    void Daemon::work()
+    {
+        while (true) {
+            int connection;
+            {
+                std::unique_lock<std::mutex> lock{pending_mutex};
+                pending_changed.wait(lock, [this]() { return not pending.empty() || stopping; });
+                if (pending.empty()) {
+                    return;
+                }
+                connection = pending.front();
+                pending.pop_front();
+            }
+            serve(connection);
+            ::close(connection);
+        }
+    }
+
+    void Daemon::serve(int connection)
+    {
+        if (not is_same_user(connection)) {
+            BOOST_LOG_TRIVIAL(warning) << "Rejected a connection from another user";
+            send_all(connection, "failure\tOnly the user that started the daemon can send it validations\n");
+            return;
+        }
+
+        SocketStreambuf buffer{connection};
+        std::istream socket_input{&buffer};
+
+        try {
+            DaemonRequest request = read_request(socket_input);
+            ValidationLevel level = parse_level(request.level);
+            Ploidy ploidy = parse_ploidy(request.ploidy, request.special_ploidy);
+            std::vector<std::unique_ptr<ReportWriter>> outputs;
+            outputs.emplace_back(new SocketReportWriter{connection});
+            ValidationOptions validationOptions;
+            validationOptions.header_cache = headerCache.get();
+
+            bool is_valid;
+            try {
+                if (request.input == STDIN) {
+                    is_valid = is_valid_vcf_file(socket_input, request.input, level, ploidy, outputs,
+                                                 validationOptions);
+                } else {
+                    std::ifstream input{request.input};
+                    if (not input) {
+                        throw std::runtime_error{"Couldn't open file " + request.input};
+                    }
+                    is_valid = is_valid_vcf_file(input, request.input, level, ploidy, outputs,
+                                                 validationOptions);
+                }
+            } catch (Error *error) {
+                // the validation level "stop" aborts at the first error
+                outputs[0]->write_error(*error);
+                delete error;
+                is_valid = false;
+            }
+
+            BOOST_LOG_TRIVIAL(info) << "Validated " << request.input << ": " << (is_valid ? "valid" : "not valid");
+            send_all(connection, std::string{"result\t"} + (is_valid ? "valid" : "invalid") + "\n");
+        } catch (std::exception const & ex) {
+            BOOST_LOG_TRIVIAL(warning) << "A validation failed: " << ex.what();
+            send_all(connection, std::string{"failure\t"} + ex.what() + "\n");
+        }
+    }
+
+    bool validate_in_daemon(std::string const & socket_path,
+                            DaemonRequest const & request,
+                            std::istream & input,
+                            std::function<void(std::string const &)> report)
+    {
+        sockaddr_un address = get_socket_address(socket_path);
+        int connection = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (connection < 0 || ::connect(connection, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0) {
+            std::string reason = std::strerror(errno);
+            if (connection >= 0) {
+                ::close(connection);
+            }
+            throw std::runtime_error{"Couldn't connect to the daemon on " + socket_path + ": " + reason};
+        }
+
+        // the input is sent from another thread, so that the answers are read while the daemon validates
+        std::thread sender{[&]() {
+            if (send_all(connection, write_request(request)) && request.input == STDIN) {
+                std::vector<char> chunk(socket_buffer_size);
+                while (input.read(chunk.data(), chunk.size()) || input.gcount() > 0) {
+                    if (not send_all(connection, chunk.data(), static_cast<size_t>(input.gcount()))) {
+                        break;      // the daemon stopped reading, e.g. when validating with the level "stop"
+                    }
+                }
+            }
+            ::shutdown(connection, SHUT_WR);
+        }};
+
+        SocketStreambuf buffer{connection};
+        std::istream answers{&buffer};
+        std::string line;
+        std::string result;
+        std::string failure;
+        while (std::getline(answers, line)) {
+            size_t tab = line.find('\t');
+            std::string tag = line.substr(0, tab);
+            std::string content = tab == std::string::npos ? "" : line.substr(tab + 1);
+            if (tag == "report") {
+                report(content);
+            } else if (tag == "result") {
+                result = content;
+            } else if (tag == "failure") {
+                failure = content;
+            }
+        }
+
+        sender.join();
+        ::close(connection);
+
+        if (not failure.empty()) {
+            throw std::runtime_error{failure};
+        }
+        if (result.empty()) {
+            throw std::runtime_error{"The daemon closed the connection before finishing the validation"};
+        }
+        return result == "valid";
+    }
+  }
+}
@@ -14,6 +14,10 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <deque>
+#include <sstream>
+
 #include "util/logger.hpp"
 #include "vcf/debugulator.hpp"
 
@@ -23,26 +27,176 @@ namespace ebi
   {
     namespace debugulator
     {
+      namespace
+      {
+        /**
+         * Writes the lines of the fixed file, and describes in a manifest the ones that were changed or removed
+         * with their line numbers and byte offsets, so that the validator can check again only those lines
+         */
+        class FixedOutput
+        {
+          public:
+            FixedOutput(std::ostream &output, FixManifest *manifest)
+                    : output(output), manifest{manifest}, lines{0}, offset{0}
+            {
+                if (manifest != nullptr) {
+                    manifest->ranges.clear();
+                }
+            }
+
+            /**
+             * Writes a line of the input that was not modified
+             */
+            void copy(std::vector<char> const &line)
+            {
+                write(line);
+            }
+
+            /**
+             * Writes the result of fixing a line of the input, which is empty if the line was removed
+             */
+            /**
+             * Writes some lines of the input that were not modified, without splitting them
+             */
+            void copy_raw(char const * data, size_t size, size_t copied_lines)
+            {
+                output.write(data, size);
+                lines += copied_lines;
+                offset += size;
+                previous_lines.clear();
+            }
+
+            void write_fixed(std::vector<char> const &line, std::vector<char> const &original_line, size_t input_line)
+            {
+                if (line.empty()) {
+                    add_to_manifest(FixedRange::Kind::removed, input_line);
+                } else if (line != original_line) {
+                    add_to_manifest(FixedRange::Kind::changed, input_line);
+                }
+                write(line);
+            }
+
+            void finish()
+            {
+                if (manifest != nullptr) {
+                    manifest->output_size = offset;
+                }
+            }
+
+          private:
+            std::ostream &output;
+            FixManifest *manifest;
+            size_t lines;           ///< lines written so far
+            std::streamoff offset;  ///< bytes written so far
+
+            /**
+             * Line number and byte offset of the last body lines written, where the validation of the next fixed
+             * range has to start
+             */
+            std::deque<std::pair<size_t, std::streamoff>> previous_lines;
+
+            void write(std::vector<char> const &line)
+            {
+                if (line.empty()) {
+                    return;
+                }
+                ebi::util::writeline(output, line);
+                ++lines;
+                if (manifest != nullptr && line[0] != '#') {
+                    previous_lines.emplace_back(lines, offset);
+                    if (previous_lines.size() > manifest->context_lines) {
+                        previous_lines.pop_front();
+                    }
+                }
+                offset += line.size();
+            }
+
+            void add_to_manifest(FixedRange::Kind kind, size_t input_line)
+            {
+                if (manifest == nullptr) {
+                    return;
+                }
+                size_t output_lines = kind == FixedRange::Kind::changed ? 1 : 0;
+                if (not manifest->ranges.empty()) {
+                    FixedRange &last = manifest->ranges.back();
+                    if (last.kind == kind && last.input_line + last.input_lines == input_line
+                            && last.output_line + last.output_lines == lines + 1) {
+                        last.output_lines += output_lines;
+                        ++last.input_lines;
+                        return;
+                    }
+                }
+                size_t context_line = previous_lines.empty() ? lines + 1 : previous_lines.front().first;
+                std::streamoff context_offset = previous_lines.empty() ? offset : previous_lines.front().second;
+                manifest->ranges.push_back(FixedRange{kind, lines + 1, offset, output_lines, input_line, 1,
+                                                      context_line, context_offset});
+            }
+        };
+
+        void copy_raw_input(std::istream &input, std::streamoff size, size_t lines, FixedOutput &fixed_output)
+        {
+            std::vector<char> buffer(std::min<std::streamoff>(size, default_line_buffer_size * 16));
+            for (std::streamoff remaining = size; remaining > 0; ) {
+                std::streamsize chunk = std::min<std::streamoff>(remaining, buffer.size());
+                if (not input.read(buffer.data(), chunk)) {
+                    throw std::runtime_error("The file was shorter than expected by the line index");
+                }
+                remaining -= chunk;
+                // the lines are counted once the whole range has been copied
+                fixed_output.copy_raw(buffer.data(), chunk, remaining == 0 ? lines : 0);
+            }
+        }
+      }
+
       size_t fix_vcf_file(std::istream &input,
                           ebi::vcf::ReportReader &errorDAO,
-                          std::ostream &output)
+                          std::ostream &output,
+                          FixManifest *manifest,
+                          LineIndex const *index)
       {
           std::vector<char> line;
           line.reserve(default_line_buffer_size);
+          FixedOutput fixed_output{output, manifest};
 
           size_t current_line = 0;  // the first line is the number 1, ParsingState takes this convention too
+          std::streamoff input_offset = 0;
 
           size_t errors = errorDAO.count_errors();
           size_t errors_fixed = 0;
           if (errors == 0) {
               BOOST_LOG_TRIVIAL(info) << "The errors report was empty, there are no errors to fix the input";
+              fixed_output.finish();
               return 0;
           }
 
-          ebi::vcf::Fixer fixer{output};
+          // the fixes are written to a buffer, so that several errors of the same line are fixed one after another
+          std::stringstream fixed_line;
+          ebi::vcf::Fixer fixer{fixed_line};
+          size_t fixed_line_index = 0;
+          std::vector<char> original_line;
 
           errorDAO.for_each_error([&](std::shared_ptr<ebi::vcf::Error> error) {
               size_t line_index = error->line;
+              if (line_index < current_line || (line_index == current_line && line_index != fixed_line_index)) {
+                  BOOST_LOG_TRIVIAL(debug) << "Line " << line_index << " was already written, its error can't be fixed";
+                  ++errors_fixed;
+                  return;
+              }
+              if (line_index != fixed_line_index && fixed_line_index != 0) {
+                  fixed_output.write_fixed(line, original_line, fixed_line_index);
+              }
+              if (index != nullptr) {
+                  // the lines before the closest indexed one are copied as they are, keeping enough lines before
+                  // the error to describe its context in the manifest
+                  size_t context_lines = manifest != nullptr ? manifest->context_lines : 0;
+                  auto indexed = index->find(line_index > context_lines ? line_index - context_lines : 1);
+                  if (indexed.first > current_line + 1) {
+                      copy_raw_input(input, indexed.second - input_offset, indexed.first - current_line - 1,
+                                     fixed_output);
+                      current_line = indexed.first - 1;
+                      input_offset = indexed.second;
+                  }
+              }
               while (current_line < line_index) {
 
                   // advance input
@@ -52,21 +206,29 @@ namespace ebi
                                                        + " error reports were processed");
                   }
                   current_line++;
+                  input_offset += line.size();
                   if (current_line == line_index) {
+                      original_line = line;
                       break;
                   }
-                  ebi::util::writeline(output, line);
+                  fixed_output.copy(line);
               }
+              fixed_line.str("");
               fixer.fix(line_index, line, *error);
+              std::string fixed = fixed_line.str();
+              line.assign(fixed.begin(), fixed.end());
+              fixed_line_index = line_index;
               ++errors_fixed;
           });
+          if (fixed_line_index != 0) {
+              fixed_output.write_fixed(line, original_line, fixed_line_index);
+          }
 
           // advance input from the last error to the end of input
           while (ebi::util::readline(input, line).size() != 0) {
-              for (auto c : line) {
-                  output << c;
-              }
+              fixed_output.copy(line);
           }
+          fixed_output.finish();
 
           size_t ignored_errors = fixer.get_ignored_errors();
           if (ignored_errors != 0) {
@@ -78,4 +240,3 @@ namespace ebi
     }
   }
 }
-
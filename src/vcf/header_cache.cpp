@@ -0,0 +1,98 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <typeinfo>
+
+#include <boost/filesystem/operations.hpp>
+
+#include "util/checksum.hpp"
+#include "util/logger.hpp"
+#include "util/stream_utils.hpp"
+#include "vcf/header_cache.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    HeaderCache::HeaderCache(std::string const & directory) : directory{directory}
+    {
+        if (not boost::filesystem::is_directory(directory)) {
+            throw std::invalid_argument{"The header cache should be a directory: " + directory};
+        }
+    }
+
+    size_t HeaderCache::validate_header(std::vector<char> &line,
+                                        std::istream &input,
+                                        Parser &validator,
+                                        std::vector<std::unique_ptr<ReportWriter>> &outputs)
+    {
+        // the type and grammar of the parser are part of the key, as the states of different validation levels,
+        // versions and builds of the parsers differ
+        auto checksum = ebi::util::make_checksum("sha256");
+        std::string parser_type = typeid(validator).name();
+        checksum->update(parser_type.data(), parser_type.size() + 1);
+        std::string grammar = validator.grammar();
+        checksum->update(grammar.data(), grammar.size() + 1);
+
+        std::vector<char> header;
+        std::vector<size_t> line_ends;
+        do {
+            header.insert(header.end(), line.begin(), line.end());
+            line_ends.push_back(header.size());
+            checksum->update(line.data(), line.size());
+        } while (ebi::util::readline(input, line).size() != 0 && line[0] == '#');
+
+        boost::filesystem::path cached_path{directory};
+        cached_path /= checksum->hex_digest() + ".header";
+
+        if (boost::filesystem::exists(cached_path)) {
+            std::ifstream cached{cached_path.string(), std::ios::binary};
+            try {
+                validator.restore_header(cached);
+                BOOST_LOG_TRIVIAL(info) << "Meta and header sections restored from " << cached_path.string();
+                return line_ends.size();
+            } catch (std::runtime_error const & ex) {
+                BOOST_LOG_TRIVIAL(warning) << "Ignoring the cached header " << cached_path.string() << ": " << ex.what();
+            }
+        }
+
+        bool cacheable = true;
+        std::vector<char> header_line;
+        size_t line_start = 0;
+        for (size_t line_end : line_ends) {
+            header_line.assign(header.begin() + line_start, header.begin() + line_end);
+            validator.parse(header_line);
+            write_errors(validator, outputs);
+            cacheable = cacheable && validator.errors().empty() && validator.warnings().empty();
+            line_start = line_end;
+        }
+
+        if (cacheable && validator.is_valid()) {
+            // written with another name and then renamed, so concurrent runs never read a partial file
+            boost::filesystem::path temporary_path = cached_path;
+            temporary_path += boost::filesystem::unique_path(".%%%%%%%%.tmp");
+            {
+                std::ofstream cached{temporary_path.string(), std::ios::binary};
+                validator.save_header(cached);
+            }
+            boost::filesystem::rename(temporary_path, cached_path);
+        }
+
+        return line_ends.size();
+    }
+  }
+}
@@ -0,0 +1,93 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "vcf/limited_report_writer.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    LimitedReportWriter::LimitedReportWriter(std::vector<std::unique_ptr<ReportWriter>> outputs, ErrorLimits limits)
+            : outputs(std::move(outputs)),
+              limits(limits),
+              errors{0},
+              error_counts(ErrorClassifier::names().size(), 0),
+              warning_counts(ErrorClassifier::names().size(), 0)
+    {
+    }
+
+    void LimitedReportWriter::write_error(Error &error)
+    {
+        if (is_reported(error, error_counts, "errors")) {
+            for (auto &output : outputs) {
+                output->write_error(error);
+            }
+        }
+
+        ++errors;
+        if (limits.max_errors > 0 && errors >= limits.max_errors) {
+            std::string message = "The validation stopped after " + std::to_string(errors)
+                                  + " errors, the rest of the input was not validated and this report is truncated";
+            write_message(message);
+            flush();
+            throw ErrorLimitReached{message};
+        }
+    }
+
+    void LimitedReportWriter::write_warning(Error &error)
+    {
+        if (is_reported(error, warning_counts, "warnings")) {
+            for (auto &output : outputs) {
+                output->write_warning(error);
+            }
+        }
+    }
+
+    void LimitedReportWriter::write_message(std::string const &message)
+    {
+        for (auto &output : outputs) {
+            output->write_message(message);
+        }
+    }
+
+    void LimitedReportWriter::flush()
+    {
+        for (auto &output : outputs) {
+            output->flush();
+        }
+    }
+
+    bool LimitedReportWriter::is_reported(Error &error, std::vector<size_t> &counts, std::string const &kind)
+    {
+        if (limits.max_per_class == 0) {
+            return true;
+        }
+
+        size_t error_class = classifier.classify(error);
+        if (counts[error_class] < limits.max_per_class) {
+            ++counts[error_class];
+            return true;
+        }
+        if (counts[error_class] == limits.max_per_class) {
+            // counted once more so that the message is written only for the first one not reported
+            ++counts[error_class];
+            write_message("Only the first " + std::to_string(limits.max_per_class) + " " + kind + " of type "
+                          + ErrorClassifier::names()[error_class] + " are reported");
+        }
+        return false;
+    }
+  }
+}
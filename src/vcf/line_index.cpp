@@ -0,0 +1,165 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <fstream>
+
+#include <boost/filesystem/operations.hpp>
+
+#include "util/serialization.hpp"
+#include "util/stream_utils.hpp"
+#include "vcf/line_index.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    namespace
+    {
+      std::string const line_index_magic = "VCFLI001";
+    }
+
+    std::pair<size_t, std::streamoff> LineIndex::find(size_t line) const
+    {
+        auto next = offsets.upper_bound(line);
+        if (next == offsets.begin()) {
+            return {1, 0};
+        }
+        --next;
+        return *next;
+    }
+
+    void write_line_index(std::string const &path, LineIndex const &index)
+    {
+        boost::filesystem::path temporary_path{path};
+        temporary_path += boost::filesystem::unique_path(".%%%%%%%%.tmp");
+        {
+            std::ofstream file{temporary_path.string(), std::ios::binary};
+            file.write(line_index_magic.data(), line_index_magic.size());
+            util::write_size(file, index.interval);
+            util::write_size(file, static_cast<size_t>(index.input_size));
+            util::write_size(file, index.offsets.size());
+            for (auto &entry : index.offsets) {
+                util::write_size(file, entry.first);
+                util::write_size(file, static_cast<size_t>(entry.second));
+            }
+
+            if (not file.flush()) {
+                throw std::runtime_error{"Couldn't write the line index " + temporary_path.string()};
+            }
+        }
+        boost::filesystem::rename(temporary_path, path);
+    }
+
+    LineIndex read_line_index(std::string const &path)
+    {
+        std::ifstream file{path, std::ios::binary};
+        if (not file) {
+            throw std::runtime_error{"Couldn't open the line index " + path};
+        }
+        util::read_magic(file, line_index_magic);
+
+        LineIndex index;
+        index.interval = util::read_size(file);
+        index.input_size = static_cast<std::streamoff>(util::read_size(file));
+        for (size_t entries = util::read_size(file); entries > 0; --entries) {
+            size_t line = util::read_size(file);
+            index.offsets.emplace_hint(index.offsets.end(), line, static_cast<std::streamoff>(util::read_size(file)));
+        }
+        return index;
+    }
+
+    LineIndexBuilder::LineIndexBuilder(size_t interval)
+            : index{interval, 0, {}}, lines{0}, at_line_start{true}, recent_offsets{}, recent_first_line{1}
+    {
+    }
+
+    void LineIndexBuilder::update(char const * data, size_t size)
+    {
+        // the reader is now in this chunk, maybe still in the line that started before it
+        if (recent_offsets.size() > 1) {
+            recent_first_line += recent_offsets.size() - 1;
+            recent_offsets.erase(recent_offsets.begin(), recent_offsets.end() - 1);
+        }
+
+        char const * end = data + size;
+        for (char const * position = data; position < end; ) {
+            if (at_line_start) {
+                ++lines;
+                std::streamoff offset = index.input_size + (position - data);
+                if (index.interval > 0 && (lines - 1) % index.interval == 0) {
+                    index.offsets.emplace_hint(index.offsets.end(), lines, offset);
+                }
+                recent_offsets.push_back(offset);
+                at_line_start = false;
+            }
+            auto newline = static_cast<char const *>(std::memchr(position, '\n', end - position));
+            if (newline == nullptr) {
+                break;
+            }
+            position = newline + 1;
+            at_line_start = true;
+        }
+        index.input_size += size;
+    }
+
+    void LineIndexBuilder::add_line(size_t line)
+    {
+        if (line >= recent_first_line && line - recent_first_line < recent_offsets.size()) {
+            index.offsets.emplace(line, recent_offsets[line - recent_first_line]);
+        }
+    }
+
+    LineIndex const & LineIndexBuilder::get_index()
+    {
+        return index;
+    }
+
+    size_t extract_lines(std::istream &input,
+                         LineIndex const &index,
+                         size_t first_line,
+                         size_t last_line,
+                         std::ostream &output)
+    {
+        input.clear();
+        input.seekg(0, std::ios::end);
+        std::streamoff input_size = input.tellg();
+        if (not input || input_size < 0) {
+            throw std::invalid_argument{"The input must be a seekable file to extract lines with an index"};
+        }
+        if (input_size != index.input_size) {
+            throw std::invalid_argument{"The input has " + std::to_string(input_size) + " bytes but the index was "
+                                        "written for a file of " + std::to_string(index.input_size) + " bytes"};
+        }
+
+        auto start = index.find(first_line);
+        input.seekg(start.second);
+
+        std::vector<char> line;
+        size_t written = 0;
+        for (size_t current_line = start.first; current_line <= last_line; ++current_line) {
+            if (ebi::util::readline(input, line).size() == 0) {
+                break;
+            }
+            if (current_line >= first_line) {
+                ebi::util::writeline(output, line);
+                ++written;
+            }
+        }
+        return written;
+    }
+  }
+}
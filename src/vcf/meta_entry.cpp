@@ -33,18 +33,18 @@ namespace ebi
         
     MetaEntry::MetaEntry(size_t line,
                          std::string const & id,
-                         std::string const & plain_value,
+                         std::string plain_value,
                          std::shared_ptr<Source> source)
-    : line{line}, id{id}, structure{Structure::PlainValue}, value{plain_value}, source{source}
+    : line{line}, id{id}, structure{Structure::PlainValue}, value{std::move(plain_value)}, source{std::move(source)}
     {
         check_value();
     }
 
     MetaEntry::MetaEntry(size_t line,
                          std::string const & id,
-                         std::map<std::string, std::string> const & key_values,
+                         MetaKeyValues key_values,
                          std::shared_ptr<Source> source)
-    : line{line}, id{id}, structure{Structure::KeyValue}, value{key_values}, source{source}
+    : line{line}, id{id}, structure{Structure::KeyValue}, value{std::move(key_values)}, source{std::move(source)}
     {
         check_value();
     }
@@ -80,7 +80,7 @@ namespace ebi
         }
     }
     
-    void MetaEntryVisitor::operator()(std::map<std::string, std::string> & value) const
+    void MetaEntryVisitor::operator()(MetaKeyValues & value) const
     {
         auto & id = entry.id;
         if (id == ALT) {
@@ -111,7 +111,7 @@ namespace ebi
         }
     }
     
-    void MetaEntryVisitor::check_alt(std::map<std::string, std::string> & value) const
+    void MetaEntryVisitor::check_alt(MetaKeyValues & value) const
     {
         // It must contain an ID and Description
         check_key_is_present(ALT, ID, value.count(ID));
@@ -136,13 +136,13 @@ namespace ebi
         }
     }
 
-    void MetaEntryVisitor::check_contig(std::map<std::string, std::string> & value) const
+    void MetaEntryVisitor::check_contig(MetaKeyValues & value) const
     {
         // It must contain an ID
         check_key_is_present(CONTIG, ID, value.count(ID));
     }
     
-    void MetaEntryVisitor::check_filter(std::map<std::string, std::string> & value) const
+    void MetaEntryVisitor::check_filter(MetaKeyValues & value) const
     {
         // It must contain an ID and Description
         check_key_is_present(FILTER, ID, value.count(ID));
@@ -158,7 +158,7 @@ namespace ebi
         }
     }
 
-    void MetaEntryVisitor::check_format(std::map<std::string, std::string> & value) const
+    void MetaEntryVisitor::check_format(MetaKeyValues & value) const
     {
         // It must contain an ID, Number, Type and Description
         check_key_is_present(FORMAT, ID, value.count(ID));
@@ -199,7 +199,7 @@ namespace ebi
         }
     }
 
-    void MetaEntryVisitor::check_info(std::map<std::string, std::string> & value) const
+    void MetaEntryVisitor::check_info(MetaKeyValues & value) const
     {
         // It must contain an ID, Number, Type and Description
         check_key_is_present(INFO, ID, value.count(ID));
@@ -231,7 +231,7 @@ namespace ebi
     }
 
     void MetaEntryVisitor::check_predefined_tag(std::string const & tag_field, std::string const & meta_entry_property,
-                                                std::map<std::string, std::string> & meta_entry,
+                                                MetaKeyValues & meta_entry,
                                                 std::map<std::string, std::pair<std::string, std::string>> const & predefined_meta_entries) const
     {
         auto iterator = predefined_meta_entries.find(meta_entry[ID]);
@@ -247,7 +247,7 @@ namespace ebi
         }
     }
 
-    void MetaEntryVisitor::check_sample(std::map<std::string, std::string> & value) const
+    void MetaEntryVisitor::check_sample(MetaKeyValues & value) const
     {
         // It must contain an ID
         check_key_is_present(SAMPLE, ID, value.count(ID));
@@ -0,0 +1,155 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <stdexcept>
+
+#include "util/memory_budget.hpp"
+#include "vcf/meta_key_values.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    MetaKeyValues::value_type MetaKeyValues::const_iterator::operator*() const
+    {
+        char const * value = position + std::strlen(position) + 1;
+        return value_type{position, value};
+    }
+
+    MetaKeyValues::const_iterator & MetaKeyValues::const_iterator::operator++()
+    {
+        position += std::strlen(position) + 1;
+        position += std::strlen(position) + 1;
+        return *this;
+    }
+
+    MetaKeyValues::const_iterator MetaKeyValues::const_iterator::operator++(int)
+    {
+        const_iterator previous = *this;
+        ++*this;
+        return previous;
+    }
+
+    MetaKeyValues::MetaKeyValues(std::initializer_list<value_type> key_values)
+    {
+        for (auto & key_value : key_values) {
+            set(key_value.first, key_value.second);
+        }
+    }
+
+    MetaKeyValues::MetaKeyValues(std::map<std::string, std::string> const & key_values)
+    {
+        // already sorted and without repeated keys
+        for (auto & key_value : key_values) {
+            text.append(key_value.first).push_back('\0');
+            text.append(key_value.second).push_back('\0');
+        }
+    }
+
+    void MetaKeyValues::set(std::string const & key, std::string const & value)
+    {
+        size_t position = 0;
+        while (position < text.size()) {
+            char const * current_key = text.data() + position;
+            size_t key_length = std::strlen(current_key);
+            size_t value_position = position + key_length + 1;
+            size_t value_length = std::strlen(text.data() + value_position);
+
+            int comparison = key.compare(0, std::string::npos, current_key, key_length);
+            if (comparison == 0) {
+                text.replace(value_position, value_length, value);
+                return;
+            }
+            if (comparison < 0) {
+                break;
+            }
+            position = value_position + value_length + 1;
+        }
+
+        std::string pair = key;
+        pair.push_back('\0');
+        pair.append(value).push_back('\0');
+        text.insert(position, pair);
+    }
+
+    char const * MetaKeyValues::find_value(std::string const & key) const
+    {
+        char const * position = text.data();
+        char const * end = position + text.size();
+        while (position < end) {
+            size_t key_length = std::strlen(position);
+            char const * value = position + key_length + 1;
+            if (key_length == key.size() && key.compare(0, key_length, position, key_length) == 0) {
+                return value;
+            }
+            position = value + std::strlen(value) + 1;
+        }
+        return nullptr;
+    }
+
+    size_t MetaKeyValues::count(std::string const & key) const
+    {
+        return find_value(key) == nullptr ? 0 : 1;
+    }
+
+    std::string MetaKeyValues::operator[](std::string const & key) const
+    {
+        char const * value = find_value(key);
+        return value == nullptr ? std::string{} : std::string{value};
+    }
+
+    std::string MetaKeyValues::at(std::string const & key) const
+    {
+        char const * value = find_value(key);
+        if (value == nullptr) {
+            throw std::out_of_range{"The meta entry has no key " + key};
+        }
+        return std::string{value};
+    }
+
+    bool MetaKeyValues::has_value(std::string const & key, std::string const & value) const
+    {
+        char const * found = find_value(key);
+        return found != nullptr && std::strlen(found) == value.size() && value.compare(found) == 0;
+    }
+
+    size_t MetaKeyValues::size() const
+    {
+        size_t pairs = 0;
+        for (auto it = begin(); it != end(); ++it) {
+            ++pairs;
+        }
+        return pairs;
+    }
+
+    size_t MetaKeyValues::memory() const
+    {
+        return util::heap_size(text);
+    }
+
+    std::ostream & operator<<(std::ostream & os, MetaKeyValues const & key_values)
+    {
+        os << "<";
+        bool first = true;
+        for (auto key_value : key_values) {
+            os << (first ? "" : ",") << key_value.first << "=" << key_value.second;
+            first = false;
+        }
+        return os << ">";
+    }
+  }
+}
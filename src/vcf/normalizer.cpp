@@ -15,6 +15,9 @@
  */
 
 
+#include <algorithm>
+#include <cctype>
+
 #include "vcf/normalizer.hpp"
 #include "util/string_utils.hpp"
 
@@ -128,6 +131,38 @@ namespace ebi
         return records;
     }
     
+    std::vector<RecordCore> normalize_left_alignment(const Record &record, const ReferenceFasta &reference)
+    {
+        std::vector<RecordCore> records = normalize(record);
+        ReferenceFasta::Contig const * contig = reference.find_contig(record.chromosome);
+        if (contig == nullptr) {
+            return records;
+        }
+
+        for (RecordCore &record_core : records) {
+            // after removing the context, an indel is the bases inserted or deleted before its position
+            bool is_insertion = record_core.reference_allele.empty();
+            std::string &bases = is_insertion ? record_core.alternate_allele : record_core.reference_allele;
+            if (record_core.reference_allele.empty() == record_core.alternate_allele.empty()
+                    || bases.find_first_not_of("ACGTNacgtn") != std::string::npos
+                    || record_core.position > contig->length + 1) {
+                continue;
+            }
+
+            std::transform(bases.begin(), bases.end(), bases.begin(), ::toupper);
+
+            // moving the indel one base to the left gives the same sequence if the base before it is its last base
+            while (record_core.position > 1
+                   && reference.base(*contig, record_core.position - 1) == bases.back()) {
+                bases.pop_back();
+                bases.insert(bases.begin(), reference.base(*contig, record_core.position - 1));
+                --record_core.position;
+            }
+        }
+
+        return records;
+    }
+
     std::vector<RecordCore> normalize_right_alignment(const Record &record/* , ParsingState?*/)
     {
         std::vector<RecordCore> records;
@@ -73,6 +73,7 @@ namespace ebi
         if (transaction.has_current()) {
             transaction.commit();
         }
+        current_transaction_size = 0;
 
         {
             odb::core::connection_ptr c{db->connection()};
@@ -92,20 +93,38 @@ namespace ebi
         write(error);
     }
 
+    void OdbReportRW::write_batch(std::vector<std::unique_ptr<Error>> const &errors, Severity severity)
+    {
+        // the whole batch is persisted in the same transaction
+        start_writing();
+        for (auto &error : errors) {
+            error->severity = severity;
+            db->persist(*error);
+        }
+        finish_writing(errors.size());
+    }
+
     void OdbReportRW::write(Error &error)
+    {
+        start_writing();
+        db->persist(error);
+        finish_writing(1);
+    }
+
+    void OdbReportRW::start_writing()
     {
         if (current_transaction_size == 0) {
             // start transaction
             transaction.reset(db->begin());
         }
+    }
 
-        db->persist(error);
-
-        ++current_transaction_size;
-        if (current_transaction_size == transaction_size) {
+    void OdbReportRW::finish_writing(size_t written)
+    {
+        current_transaction_size += written;
+        if (current_transaction_size >= transaction_size) {
             // commit transaction
             flush();
-            current_transaction_size = 0;
         }
     }
 
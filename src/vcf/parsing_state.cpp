@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include "util/memory_budget.hpp"
+#include "util/serialization.hpp"
 #include "vcf/parsing_state.hpp"
 
 namespace ebi
@@ -21,22 +23,65 @@ namespace ebi
   namespace vcf
   {
 
+    namespace
+    {
+      // written first in every saved state, change it whenever the format or the parser states change
+      const std::string parsing_state_magic = "VCFPS002";
+
+      size_t meta_entry_memory(MetaEntry const & meta)
+      {
+          size_t bytes = util::tree_node_overhead + sizeof(std::pair<std::string const, MetaEntry>)
+                         + 2 * util::heap_size(meta.id);
+          if (meta.structure == MetaEntry::Structure::PlainValue) {
+              bytes += util::heap_size(boost::get<std::string>(meta.value));
+          } else if (meta.structure == MetaEntry::Structure::KeyValue) {
+              bytes += boost::get<MetaKeyValues>(meta.value).memory();
+          }
+          return bytes;
+      }
+
+      size_t defined_meta_memory(std::string const & id)
+      {
+          return util::tree_node_overhead + sizeof(std::string) + util::heap_size(id);
+      }
+
+      void reserve_meta(size_t bytes)
+      {
+          if (not util::memory_budget().reserve(bytes)) {
+              throw std::runtime_error{"The meta section of the input needs more memory than the memory limit"};
+          }
+      }
+    }
+
     ParsingState::ParsingState(std::shared_ptr<Source> source)
     : n_lines{1}, n_columns{1}, n_batches{0}, cs{0}, m_is_valid{true}, 
       source{source}, record{},
       errors{}, warnings{},
-      defined_metadata{}
+      defined_metadata{},
+      meta_memory{0}
     {
     }
 
+    ParsingState::~ParsingState()
+    {
+        util::memory_budget().release(meta_memory);
+    }
+
     void ParsingState::set_version(Version version)
     {
         source->version = version;
     }
     
-    void ParsingState::add_meta(MetaEntry const & meta)
+    void ParsingState::add_meta(MetaEntry meta)
     {
-        source->meta_entries.emplace(meta.id, meta);
+        // the meta section is needed to validate the rest of the input, it can't be partially forgotten
+        size_t bytes = meta_entry_memory(meta);
+        reserve_meta(bytes);
+        meta_memory += bytes;
+        // the entries are appended in order, so the end is the right place for every new one
+        std::string id = meta.id;
+        source->meta_entries.emplace_hint(source->meta_entries.end(), std::move(id), std::move(meta));
+        source->meta_entries_changed();
     }
     
     void ParsingState::set_record(std::unique_ptr<Record> record)
@@ -66,26 +111,135 @@ namespace ebi
         return source->samples_names;
     }
         
-    void ParsingState::set_samples(std::vector<std::string> & samples)
+    void ParsingState::set_samples(std::vector<std::string> samples)
     {
-        source->samples_names = samples;
+        source->set_samples_names(std::move(samples));
     }
     
     bool ParsingState::is_well_defined_meta(std::string const & meta_type, std::string const & id) const
     {
-        typedef std::multimap<std::string,std::string>::const_iterator iter;
-        std::pair<iter, iter> range = defined_metadata.equal_range(meta_type);
-        for (auto & current = range.first; current != range.second; ++current) {
-            if (current->second == id) {
-                return true;
-            }
-        }
-        return false;
+        auto defined = defined_metadata.find(meta_type);
+        return defined != defined_metadata.end() && defined->second.count(id) != 0;
     }
     
     void ParsingState::add_well_defined_meta(std::string const & meta_type, std::string const & id)
     {
-        defined_metadata.emplace(meta_type, id);
+        // this only saves searching the meta entries again, so it is not stored if the memory budget is exhausted
+        size_t bytes = defined_meta_memory(id);
+        if (util::memory_budget().reserve(bytes)) {
+            meta_memory += bytes;
+            defined_metadata[meta_type].insert(id);
+        }
+    }
+
+    void ParsingState::write_state(std::ostream &output, std::string const &grammar) const
+    {
+        output.write(parsing_state_magic.data(), parsing_state_magic.size());
+        util::write_string(output, grammar);
+        util::write_size(output, n_lines);
+        util::write_size(output, static_cast<size_t>(cs));
+        util::write_size(output, m_is_valid);
+
+        util::write_size(output, source->samples_names.size());
+        for (auto &name : source->samples_names) {
+            util::write_string(output, name);
+        }
+
+        util::write_size(output, source->meta_entries.size());
+        for (auto &entry : source->meta_entries) {
+            MetaEntry const &meta = entry.second;
+            util::write_size(output, meta.line);
+            util::write_string(output, meta.id);
+            util::write_size(output, static_cast<size_t>(meta.structure));
+            if (meta.structure == MetaEntry::Structure::PlainValue) {
+                util::write_string(output, boost::get<std::string>(meta.value));
+            } else if (meta.structure == MetaEntry::Structure::KeyValue) {
+                auto &key_values = boost::get<MetaKeyValues>(meta.value);
+                util::write_size(output, key_values.size());
+                for (auto key_value : key_values) {
+                    util::write_string(output, key_value.first);
+                    util::write_string(output, key_value.second);
+                }
+            }
+        }
+
+        size_t defined_count = 0;
+        for (auto &defined : defined_metadata) {
+            defined_count += defined.second.size();
+        }
+        util::write_size(output, defined_count);
+        for (auto &defined : defined_metadata) {
+            for (auto &id : defined.second) {
+                util::write_string(output, defined.first);
+                util::write_string(output, id);
+            }
+        }
+    }
+
+    void ParsingState::read_state(std::istream &input, std::string const &grammar)
+    {
+        util::read_magic(input, parsing_state_magic);
+        if (util::read_string(input) != grammar) {
+            throw std::runtime_error{"The saved validation state was written by a parser with another grammar"};
+        }
+        size_t n_lines = util::read_size(input);
+        int cs = static_cast<int>(util::read_size(input));
+        bool is_valid = util::read_size(input) != 0;
+
+        std::vector<std::string> samples_names(util::read_size(input));
+        for (auto &name : samples_names) {
+            name = util::read_string(input);
+        }
+
+        // the entries were checked before they were saved, so they are built without checking their values again
+        std::multimap<std::string, MetaEntry> meta_entries;
+        for (size_t entries = util::read_size(input); entries > 0; --entries) {
+            size_t line = util::read_size(input);
+            MetaEntry meta{line, util::read_string(input), source};
+            meta.structure = static_cast<MetaEntry::Structure>(util::read_size(input));
+            if (meta.structure == MetaEntry::Structure::PlainValue) {
+                meta.value = util::read_string(input);
+            } else if (meta.structure == MetaEntry::Structure::KeyValue) {
+                MetaKeyValues key_values;
+                for (size_t pairs = util::read_size(input); pairs > 0; --pairs) {
+                    std::string key = util::read_string(input);
+                    key_values.set(key, util::read_string(input));
+                }
+                meta.value = std::move(key_values);
+            } else if (meta.structure != MetaEntry::Structure::NoValue) {
+                throw std::runtime_error{"The saved validation state is corrupted"};
+            }
+            std::string id = meta.id;
+            meta_entries.emplace_hint(meta_entries.end(), std::move(id), std::move(meta));
+        }
+
+        std::map<std::string, std::set<std::string>> defined_metadata;
+        for (size_t defined = util::read_size(input); defined > 0; --defined) {
+            std::string meta_type = util::read_string(input);
+            defined_metadata[meta_type].insert(util::read_string(input));
+        }
+
+        size_t restored_memory = 0;
+        for (auto & meta : meta_entries) {
+            restored_memory += meta_entry_memory(meta.second);
+        }
+        for (auto & defined : defined_metadata) {
+            for (auto & id : defined.second) {
+                restored_memory += defined_meta_memory(id);
+            }
+        }
+        reserve_meta(restored_memory);
+        util::memory_budget().release(meta_memory);
+        meta_memory = restored_memory;
+
+        this->n_lines = n_lines;
+        this->n_columns = 1;
+        this->cs = cs;
+        this->m_is_valid = is_valid;
+        source->meta_entries = std::move(meta_entries);
+        source->meta_entries_changed();
+        source->set_samples_names(std::move(samples_names));
+        this->defined_metadata = std::move(defined_metadata);
     }
   }
 }
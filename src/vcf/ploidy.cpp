@@ -0,0 +1,61 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdexcept>
+#include <vector>
+
+#include "util/string_utils.hpp"
+#include "vcf/ploidy.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    Ploidy parse_ploidy(long default_ploidy, std::string const &special_ploidies)
+    {
+        const std::string message = "Please provide the special ploidies as a comma-separated list of pairs "
+                "CHROM=PLOIDY where CHROM is the name as in the VCF, and PLOIDY is a number strictly greater than 0.";
+
+
+        size_t unsigned_ploidy;
+        if (default_ploidy <= 0) {
+            throw std::invalid_argument{std::to_string(default_ploidy)
+                                                + " is not a valid ploidy, must be a number strictly greater than 0."};
+        }
+        unsigned_ploidy = static_cast<size_t>(default_ploidy);
+
+        std::map<std::string, size_t> contig_ploidies;
+        std::vector<std::string> ploidies;
+        util::string_split(special_ploidies, ",", ploidies);
+        for (std::string &ploidy_assignment : ploidies) {
+            std::vector<std::string> contig_and_ploidy;
+            util::string_split(ploidy_assignment, "=", contig_and_ploidy);
+            if (contig_and_ploidy.size() != 2) {
+                throw std::invalid_argument{ploidy_assignment + " is not a valid CHROM=PLOIDY pair. " + message};
+            }
+            size_t ploidy;
+            try {
+                ploidy = std::stoul(contig_and_ploidy[1]);
+            } catch (std::exception e) {
+                throw std::invalid_argument{contig_and_ploidy[1] + " is not a valid ploidy. " + message};
+            }
+            contig_ploidies[contig_and_ploidy[0]] = ploidy;
+        }
+
+        return Ploidy{unsigned_ploidy, contig_ploidies};
+    }
+  }
+}
@@ -0,0 +1,219 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <limits>
+#include <sstream>
+
+#include "util/stream_utils.hpp"
+#include "util/string_utils.hpp"
+#include "vcf/recheck.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    namespace
+    {
+      std::string const manifest_magic = "#vcf_debugulator manifest v1";
+      std::string const output_size_key = "#output_size=";
+      std::string const context_lines_key = "#context_lines=";
+
+      /**
+       * Consecutive lines to validate, including the context around one or several fixed ranges
+       */
+      struct RecheckWindow
+      {
+          size_t first_line;
+          std::streamoff first_offset;
+          size_t last_line;
+      };
+
+      std::string kind_name(FixedRange::Kind kind)
+      {
+          return kind == FixedRange::Kind::changed ? "changed" : "removed";
+      }
+
+      size_t parse_number(std::string const &value, std::string const &manifest_line)
+      {
+          if (value.empty() || value.find_first_not_of("0123456789") != std::string::npos) {
+              throw std::runtime_error{"Malformed line in the manifest of fixed lines: " + manifest_line};
+          }
+          return std::stoul(value);
+      }
+
+      /**
+       * Windows sorted by line and merged when they overlap or touch, so that each line is validated once
+       */
+      std::vector<RecheckWindow> get_windows(FixManifest const &manifest, size_t body_line, std::streamoff body_start)
+      {
+          std::vector<RecheckWindow> windows;
+          for (auto &range : manifest.ranges) {
+              size_t last_fixed_line = range.output_line + std::max<size_t>(range.output_lines, 1) - 1;
+              RecheckWindow window{range.context_line, range.context_offset, last_fixed_line + manifest.context_lines};
+              if (window.first_line < body_line) {
+                  window.first_line = body_line;
+                  window.first_offset = body_start;
+              }
+              windows.push_back(window);
+          }
+          std::sort(windows.begin(), windows.end(), [](RecheckWindow const &a, RecheckWindow const &b) {
+              return a.first_line < b.first_line;
+          });
+
+          std::vector<RecheckWindow> merged;
+          for (auto &window : windows) {
+              if (not merged.empty() && window.first_line <= merged.back().last_line + 1) {
+                  merged.back().last_line = std::max(merged.back().last_line, window.last_line);
+              } else {
+                  merged.push_back(window);
+              }
+          }
+          return merged;
+      }
+    }
+
+    void write_fix_manifest(std::ostream &output, FixManifest const &manifest)
+    {
+        output << manifest_magic << "\n"
+               << output_size_key << manifest.output_size << "\n"
+               << context_lines_key << manifest.context_lines << "\n"
+               << "#KIND\tOUTPUT_LINE\tOUTPUT_OFFSET\tOUTPUT_LINES\tINPUT_LINE\tINPUT_LINES\tCONTEXT_LINE\tCONTEXT_OFFSET\n";
+        for (auto &range : manifest.ranges) {
+            output << kind_name(range.kind) << "\t" << range.output_line << "\t" << range.output_offset << "\t"
+                   << range.output_lines << "\t" << range.input_line << "\t" << range.input_lines << "\t"
+                   << range.context_line << "\t" << range.context_offset << "\n";
+        }
+    }
+
+    FixManifest read_fix_manifest(std::istream &input)
+    {
+        std::string line;
+        std::getline(input, line);
+        if (line != manifest_magic) {
+            throw std::runtime_error{"The file is not a manifest of fixed lines written by vcf_debugulator"};
+        }
+
+        FixManifest manifest{-1, default_recheck_context_lines, {}};
+        while (std::getline(input, line)) {
+            if (line.compare(0, output_size_key.size(), output_size_key) == 0) {
+                manifest.output_size = parse_number(line.substr(output_size_key.size()), line);
+            } else if (line.compare(0, context_lines_key.size(), context_lines_key) == 0) {
+                manifest.context_lines = parse_number(line.substr(context_lines_key.size()), line);
+            } else if (line.empty() || line[0] == '#') {
+                continue;
+            } else {
+                std::vector<std::string> columns;
+                util::string_split(line, "\t", columns);
+                if (columns.size() != 8 || (columns[0] != kind_name(FixedRange::Kind::changed)
+                                            && columns[0] != kind_name(FixedRange::Kind::removed))) {
+                    throw std::runtime_error{"Malformed line in the manifest of fixed lines: " + line};
+                }
+                FixedRange range;
+                range.kind = columns[0] == kind_name(FixedRange::Kind::changed) ? FixedRange::Kind::changed
+                                                                                : FixedRange::Kind::removed;
+                range.output_line = parse_number(columns[1], line);
+                range.output_offset = parse_number(columns[2], line);
+                range.output_lines = parse_number(columns[3], line);
+                range.input_line = parse_number(columns[4], line);
+                range.input_lines = parse_number(columns[5], line);
+                range.context_line = parse_number(columns[6], line);
+                range.context_offset = parse_number(columns[7], line);
+                manifest.ranges.push_back(range);
+            }
+        }
+
+        if (manifest.output_size < 0) {
+            throw std::runtime_error{"The manifest of fixed lines doesn't include the size of the fixed file"};
+        }
+        return manifest;
+    }
+
+    bool is_valid_vcf_file_recheck(std::istream &input,
+                                   const std::string &sourceName,
+                                   ValidationLevel validationLevel,
+                                   Ploidy ploidy,
+                                   std::vector<std::unique_ptr<ReportWriter>> &outputs,
+                                   FixManifest const &manifest,
+                                   ValidationOptions const &validationOptions)
+    {
+        // the meta and header sections are always validated completely
+        std::vector<char> line;
+        size_t header_lines;
+        std::unique_ptr<Parser> validator = validate_up_to_body(line, input, sourceName, validationLevel, ploidy,
+                                                                outputs, validationOptions, &header_lines);
+        if (validator == nullptr) {
+            return false;
+        }
+        size_t body_line = header_lines + 1;
+
+        input.clear();
+        std::streamoff body_start = static_cast<std::streamoff>(input.tellg()) - line.size();
+        input.seekg(0, std::ios::end);
+        std::streamoff input_size = input.tellg();
+        if (not input || body_start < 0 || input_size < 0) {
+            throw std::invalid_argument{"The input must be a seekable file to validate only its fixed lines"};
+        }
+        if (input_size != manifest.output_size) {
+            throw std::invalid_argument{"The input has " + std::to_string(input_size) + " bytes but the manifest was "
+                                        "written for a file of " + std::to_string(manifest.output_size) + " bytes"};
+        }
+
+        bool header_changed = std::any_of(manifest.ranges.begin(), manifest.ranges.end(), [body_line](FixedRange const &range) {
+            return range.output_line < body_line;
+        });
+        std::vector<RecheckWindow> windows;
+        if (header_changed) {
+            write_message("The meta or header sections were fixed, all the records will be validated again", outputs);
+            windows.push_back(RecheckWindow{body_line, body_start, std::numeric_limits<size_t>::max()});
+        } else {
+            windows = get_windows(manifest, body_line, body_start);
+        }
+
+        // the input was left at its end, so the first window always seeks
+        size_t next_line = body_line;
+        size_t validated_lines = 0;
+        bool positioned = false;
+        for (auto &window : windows) {
+            if (not positioned || window.first_line != next_line) {
+                validator->skip_lines(window.first_line - next_line);
+                validator->clear_previous_records();
+                input.clear();
+                input.seekg(window.first_offset);
+                next_line = window.first_line;
+                positioned = true;
+            }
+            while (next_line <= window.last_line && ebi::util::readline(input, line).size() != 0) {
+                validator->parse(line);
+                write_errors(*validator, outputs);
+                ++next_line;
+                ++validated_lines;
+            }
+        }
+
+        // the mates of the rechecked records may be outside the windows
+        validator->clear_previous_records();
+        validator->end();
+        write_errors(*validator, outputs);
+        write_error_counts(*validator, outputs);
+
+        write_message("Validated " + std::to_string(validated_lines) + " lines around "
+                      + std::to_string(manifest.ranges.size()) + " fixed ranges of lines", outputs);
+
+        return validator->is_valid();
+    }
+  }
+}
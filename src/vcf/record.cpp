@@ -14,15 +14,78 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <unordered_set>
 #include "vcf/file_structure.hpp"
 #include "vcf/record.hpp"
+#include "vcf/reference_fasta.hpp"
 
 namespace ebi
 {
   namespace vcf
   {
+    namespace
+    {
+      bool is_digit(char c)
+      {
+          return c >= '0' && c <= '9';
+      }
+
+      /**
+       * Skips the digits from `p`, and returns whether there were between `min` and `max` of them
+       */
+      bool skip_digits(char const * & p, char const * end, size_t min, size_t max)
+      {
+          char const * begin = p;
+          while (p != end && is_digit(*p)) {
+              ++p;
+          }
+          size_t count = static_cast<size_t>(p - begin);
+          return count >= min && count <= max;
+      }
+
+      /**
+       * Checks an integer that std::stoi can read without overflow
+       */
+      bool is_small_integer(char const * begin, char const * end, bool non_negative)
+      {
+          if (not non_negative && begin != end && *begin == '-') {
+              ++begin;
+          }
+          return skip_digits(begin, end, 1, 9) && begin == end;
+      }
+
+      /**
+       * Checks a decimal number, with an exponent small enough to be read as a long double
+       */
+      bool is_plain_float(char const * begin, char const * end)
+      {
+          if (begin != end && (*begin == '-' || *begin == '+')) {
+              ++begin;
+          }
+          char const * mantissa = begin;
+          skip_digits(begin, end, 0, SIZE_MAX);
+          if (begin != end && *begin == '.') {
+              ++begin;
+              skip_digits(begin, end, 0, SIZE_MAX);
+          }
+          if (begin - mantissa < 1 || (begin - mantissa == 1 && *mantissa == '.')) {
+              return false;
+          }
+          if (begin != end && (*begin == 'e' || *begin == 'E')) {
+              ++begin;
+              if (begin != end && (*begin == '-' || *begin == '+')) {
+                  ++begin;
+              }
+              if (not skip_digits(begin, end, 1, 3)) {
+                  return false;
+              }
+          }
+          return begin == end;
+      }
+    }
 
     Record::Record(size_t const line,
             std::string const & chromosome,
@@ -35,7 +98,8 @@ namespace ebi
             std::multimap<std::string, std::string> const & info,
             std::vector<std::string> const & format,
             std::vector<std::string> const & samples,
-            std::shared_ptr<Source> source)
+            std::shared_ptr<Source> source,
+            std::vector<std::unique_ptr<Error>> * collected_errors)
     : line(line),
         chromosome{chromosome},
         position{position},
@@ -48,17 +112,20 @@ namespace ebi
         info{info}, 
         format{format}, 
         samples{samples},
-        source{source}
+        source{source},
+        collected_errors{collected_errors}
     {
         set_types();
         check_chromosome();
         check_ids();
+        run_check([this]() { check_reference_allele(); });
         check_alternate_alleles();
-        check_quality();
+        run_check([this]() { check_quality(); });
         check_filter();
         check_info();
         check_format();
         check_samples();
+        this->collected_errors = nullptr;
     }
 
     bool Record::operator==(Record const & other) const
@@ -80,6 +147,26 @@ namespace ebi
         return !(*this == other);
     }
 
+    bool Record::is_reference_block() const
+    {
+        return alternate_alleles.size() == 1 && alternate_alleles[0] == GVCF_NON_VARIANT_ALLELE;
+    }
+
+    template <typename Check>
+    void Record::run_check(Check check) const
+    {
+        if (collected_errors == nullptr) {
+            check();
+            return;
+        }
+
+        try {
+            check();
+        } catch (Error *error) {
+            collected_errors->emplace_back(error);
+        }
+    }
+
     void Record::set_types()
     {
         for (auto & alternate : alternate_alleles) {
@@ -100,8 +187,8 @@ namespace ebi
     
     void Record::check_chromosome() const
     {
-        check_chromosome_no_colons();
-        check_chromosome_no_whitespaces();
+        run_check([this]() { check_chromosome_no_colons(); });
+        run_check([this]() { check_chromosome_no_whitespaces(); });
     }
 
     void Record::check_chromosome_no_colons() const
@@ -124,8 +211,8 @@ namespace ebi
             return; // No need to check if no IDs are provided
         }
         
-        check_ids_no_semicolons_whitespaces();
-        check_ids_no_duplicates();
+        run_check([this]() { check_ids_no_semicolons_whitespaces(); });
+        run_check([this]() { check_ids_no_duplicates(); });
     }
 
     void Record::check_ids_no_semicolons_whitespaces() const
@@ -148,14 +235,35 @@ namespace ebi
         }
     }
 
+    void Record::check_reference_allele() const
+    {
+        if (source == nullptr || source->reference == nullptr || position == 0) {
+            return;
+        }
+        ReferenceFasta::Contig const * contig = source->reference->find_contig(chromosome);
+        if (contig == nullptr) {
+            return;   // reported as a warning, this check can't be done
+        }
+
+        if (position - 1 + reference_allele.size() > contig->length) {
+            throw new ReferenceAlleleBodyError{line, "Reference allele goes beyond the end of chromosome/contig '"
+                                                     + chromosome + "' in the reference sequence, whose length is "
+                                                     + std::to_string(contig->length)};
+        }
+        if (not source->reference->matches(*contig, position, reference_allele)) {
+            throw new ReferenceAlleleBodyError{line, "Reference allele does not match the reference sequence at "
+                                                     + chromosome + ":" + std::to_string(position)};
+        }
+    }
+
     void Record::check_alternate_alleles() const
     {        
         for (size_t i = 0 ; i < alternate_alleles.size(); ++i) {
             auto & alternate = alternate_alleles[i];
             auto & type = types[i];
             
-            check_alternate_allele_structure(alternate, type);
-            check_alternate_allele_symbolic_prefix(alternate);
+            run_check([&]() { check_alternate_allele_structure(alternate, type); });
+            run_check([&]() { check_alternate_allele_symbolic_prefix(alternate); });
         }
         
     }
@@ -190,7 +298,8 @@ namespace ebi
         static boost::regex square_brackets_regex("<([a-zA-Z0-9:_]+)>");
         boost::cmatch pieces_match;
 
-        if (alternate[0] == '<' && boost::regex_match(alternate.c_str(), pieces_match, square_brackets_regex)) {
+        if (alternate[0] == '<' && alternate != GVCF_NON_VARIANT_ALLELE
+                && boost::regex_match(alternate.c_str(), pieces_match, square_brackets_regex)) {
             std::string alt_id = pieces_match[1];
             if (!boost::starts_with(alt_id, DEL) && 
                 !boost::starts_with(alt_id, INS) && 
@@ -211,8 +320,8 @@ namespace ebi
     
     void Record::check_filter() const
     {
-        check_filter_no_duplicates();
-        check_filter_not_zero();
+        run_check([this]() { check_filter_no_duplicates(); });
+        run_check([this]() { check_filter_not_zero(); });
     }
 
     void Record::check_filter_no_duplicates() const
@@ -237,10 +346,8 @@ namespace ebi
 
     void Record::check_info() const
     {
-        check_info_no_duplicates();
+        run_check([this]() { check_info_no_duplicates(); });
 
-        typedef std::multimap<std::string, MetaEntry>::iterator iter;
-        std::pair<iter, iter> range = source->meta_entries.equal_range(INFO);
         std::vector<std::string> values;
 
         // Check that INFO fields listed in the meta section
@@ -248,38 +355,32 @@ namespace ebi
         for (auto & field : info) {
             if (field.first == MISSING_VALUE) { continue; } // No need to check missing data
 
-            util::string_split(field.second, ",", values);
-            bool found_in_meta = false;
-            for (iter current = range.first; current != range.second; ++current) {
-                auto & key_values = boost::get<std::map < std::string, std::string >> ((current->second).value);
-                if (key_values[ID] == field.first) {
-                    found_in_meta = true;
+            run_check([&]() {
+                util::string_split(field.second, ",", values);
+                FieldMeta const * meta = source->find_info_meta(field.first);
+                if (meta != nullptr) {
                     try {
-                        check_field_cardinality(field.second, values, key_values[NUMBER]);
-                        check_field_type(values, key_values[TYPE]);
+                        check_field_cardinality(field.second, values, meta->number);
+                        check_field_type(values, meta->type);
                     } catch (std::shared_ptr<Error> ex) {
-                        std::string message = "INFO " + key_values[ID] + "=" + field.second
+                        std::string message = "INFO " + field.first + "=" + field.second
                                 + " does not match the meta" + ex->message;
-                        throw new InfoBodyError{line, message, ErrorFix::IRRECOVERABLE_VALUE, key_values[ID]};
+                        throw new InfoBodyError{line, message, ErrorFix::IRRECOVERABLE_VALUE, field.first};
                     }
-                    
-                    break;
-                }
-            }
-            
-            if (!found_in_meta) {
-                try {
-                    if (source->version == Version::v41 || source->version == Version::v42) {
-                        check_predefined_tag(field.first, field.second, values, info_v41_v42);
-                    } else {
-                        check_predefined_tag(field.first, field.second, values, info_v43);
+                } else {
+                    try {
+                        if (source->version == Version::v41 || source->version == Version::v42) {
+                            check_predefined_tag(field.first, field.second, values, info_v41_v42);
+                        } else {
+                            check_predefined_tag(field.first, field.second, values, info_v43);
+                        }
+                    } catch (std::shared_ptr<Error> ex) {
+                        throw new InfoBodyError{line, "INFO " + ex->message, ErrorFix::IRRECOVERABLE_VALUE, field.first};
                     }
-                } catch (std::shared_ptr<Error> ex) {
-                    throw new InfoBodyError{line, "INFO " + ex->message, ErrorFix::IRRECOVERABLE_VALUE, field.first};
                 }
-            }
 
-            strict_validation_info_predefined_tags(field.first, field.second, values);
+                strict_validation_info_predefined_tags(field.first, field.second, values);
+            });
        }
     }
     
@@ -300,25 +401,21 @@ namespace ebi
             return; // Nothing to check
         }
         
-        check_format_GT();
-        check_format_no_duplicates();
+        run_check([this]() { check_format_GT(); });
+        run_check([this]() { check_format_no_duplicates(); });
     }
 
     void Record::check_format_GT() const
     {
-        if (std::find(format.begin(), format.end(), GT) != format.end() && format[0] != GT) {
+        if (source->get_format_plan(format).gt_misplaced) {
             throw new FormatBodyError{line, "GT must be the first field in the FORMAT column"};
         }
     }
 
     void Record::check_format_no_duplicates() const
     {
-        if (source->version == Version::v43) {
-            try {
-                check_no_duplicates(format);
-            } catch (const std::invalid_argument &ex) {
-                throw new FormatBodyError{line, "FORMAT must not have duplicate fields", ErrorFix::DUPLICATE_VALUES};
-            }
+        if (source->version == Version::v43 && source->get_format_plan(format).has_duplicates) {
+            throw new FormatBodyError{line, "FORMAT must not have duplicate fields", ErrorFix::DUPLICATE_VALUES};
         }
     }
 
@@ -400,16 +497,26 @@ namespace ebi
 
     void Record::check_samples() const
     {
-        check_samples_count();
+        run_check([this]() { check_samples_count(); });
         
         if (samples.size() == 0) {
             return; // Nothing to check if no samples are listed in the file
         }
         
-        std::vector<MetaEntry> format_meta = get_meta_entry_objects();
+        FormatPlan const & plan = source->get_format_plan(format);
+
+        // most lines of a gVCF are reference blocks, whose samples are checked on their text, and only go through
+        // the general checks if something looks wrong there
+        std::vector<ReferenceBlockField> block_fields;
+        bool check_block_samples = is_reference_block() && get_reference_block_fields(plan, block_fields);
 
         for (size_t i = 0; i < samples.size(); ++i) {
-            check_sample(i, format_meta);
+            if (source->is_sample_validated(i)) {
+                if (check_block_samples && is_valid_reference_block_sample(samples[i], block_fields)) {
+                    continue;
+                }
+                run_check([&]() { check_sample(i, plan); });
+            }
         }
     }
     
@@ -420,47 +527,156 @@ namespace ebi
         }
     }
 
-    std::vector<MetaEntry> Record::get_meta_entry_objects() const
+    void Record::check_sample(size_t i, FormatPlan const & plan) const
     {
-        typedef std::multimap<std::string, MetaEntry>::iterator iter;
-        std::pair<iter, iter> range = source->meta_entries.equal_range(FORMAT);
-        std::vector<MetaEntry> format_meta;
+        std::vector<std::string> subfields;
+        util::string_split(samples[i], ":", subfields);
+        
+        check_sample_subfields_count(i, subfields);
 
-        for (auto & fm : format) {
-            bool found_in_header = false;
-            
-            for (iter current = range.first; current != range.second; ++current) {
-                auto & key_values = boost::get<std::map < std::string, std::string>>((current->second).value);
+        // If the first format field is not a GT, then no alleles need to be checked
+        if (format[0] == GT) {
+            check_sample_alleles(subfields);
+        }
 
-                if (key_values[ID] == fm) {
-                    format_meta.push_back(current->second);
-                    found_in_header = true;
-                    break;
-                }
+        check_sample_subfields_cardinality_type(i, subfields, plan);
+    }
+
+    bool Record::get_reference_block_fields(FormatPlan const & plan, std::vector<ReferenceBlockField> & fields) const
+    {
+        auto & predefined_tags = source->version == Version::v43 ? format_v43 : format_v41_v42;
+
+        for (size_t j = 0; j < format.size(); ++j) {
+            if (format[j] == GP || (format[j] == CNP && source->version == Version::v43)) {
+                return false;   // their range is checked by strict_validation_format_predefined_tags
             }
-            
-            if (!found_in_header) {
-                // If not found in header, a null-value meta entry must be created to make sizes match
-                format_meta.push_back(MetaEntry{line, "", source});
+
+            std::string number;
+            std::string type;
+            bool predefined = false;
+            if (not plan.fields[j].in_meta) {
+                auto tag = predefined_tags.find(format[j]);
+                if (tag == predefined_tags.end()) {
+                    // FORMAT fields not described in the meta section can't be checked
+                    fields.push_back(ReferenceBlockField{-1, ReferenceBlockField::Kind::any});
+                    continue;
+                }
+                type = tag->second.first;
+                number = tag->second.second;
+                predefined = true;
+            } else {
+                if (plan.fields[j].number.empty()) {
+                    return false;
+                }
+                number = plan.fields[j].number;
+                type = plan.fields[j].type;
+            }
+
+            long cardinality;
+            if (not is_valid_cardinality(number, alternate_alleles.size(), cardinality)) {
+                return false;
+            }
+
+            ReferenceBlockField::Kind kind;
+            if (type == INTEGER) {
+                // predefined Integer tags are checked to be non-negative, apart from a few that are not used in FORMAT
+                kind = predefined ? ReferenceBlockField::Kind::non_negative_integer
+                                  : ReferenceBlockField::Kind::integer;
+            } else if (type == FLOAT) {
+                kind = ReferenceBlockField::Kind::floating;
+            } else if (type == CHARACTER) {
+                kind = ReferenceBlockField::Kind::character;
+            } else if (type == FLAG) {
+                return false;
+            } else {
+                kind = ReferenceBlockField::Kind::any;
             }
+            fields.push_back(ReferenceBlockField{cardinality, kind});
         }
-
-        return format_meta;
+        return true;
     }
 
-    void Record::check_sample(size_t i, std::vector<MetaEntry> const & format_meta) const
+    bool Record::is_valid_reference_block_sample(std::string const & sample,
+                                                 std::vector<ReferenceBlockField> const & fields) const
     {
-        std::vector<std::string> subfields;
-        util::string_split(samples[i], ":", subfields);
-        
-        check_sample_subfields_count(i, subfields);
+        char const * subfield = sample.data();
+        char const * end = subfield + sample.size();
 
-        // If the first format field is not a GT, then no alleles need to be checked
-        if (format[0] == GT) {
-            check_sample_alleles(subfields);
+        for (size_t j = 0; j < fields.size(); ++j) {
+            char const * subfield_end = std::find(subfield, end, ':');
+            if (subfield == subfield_end) {
+                return false;
+            }
+
+            if (j == 0 && format[0] == GT) {
+                // the allele indexes, each a missing value or a single digit, separated by '/' or '|'
+                for (char const * allele = subfield; ; allele += 2) {
+                    bool valid_index = *allele == '.'
+                                       || (is_digit(*allele)
+                                           && static_cast<size_t>(*allele - '0') <= alternate_alleles.size());
+                    if (not valid_index) {
+                        return false;
+                    }
+                    if (allele + 1 == subfield_end) {
+                        break;
+                    }
+                    if ((allele[1] != '/' && allele[1] != '|') || allele + 2 == subfield_end) {
+                        return false;
+                    }
+                }
+            }
+
+            long count = 0;
+            for (char const * value = subfield; ; ) {
+                char const * value_end = std::find(value, subfield_end, ',');
+                if (value == value_end) {
+                    return false;
+                }
+                ++count;
+
+                bool missing = value_end - value == 1 && *value == '.';
+                if (not missing) {
+                    switch (fields[j].kind) {
+                    case ReferenceBlockField::Kind::integer:
+                    case ReferenceBlockField::Kind::non_negative_integer:
+                        if (not is_small_integer(value, value_end,
+                                                 fields[j].kind == ReferenceBlockField::Kind::non_negative_integer)) {
+                            return false;
+                        }
+                        break;
+                    case ReferenceBlockField::Kind::floating:
+                        if (not is_plain_float(value, value_end)) {
+                            return false;
+                        }
+                        break;
+                    case ReferenceBlockField::Kind::character:
+                        if (value_end - value != 1) {
+                            return false;
+                        }
+                        break;
+                    case ReferenceBlockField::Kind::any:
+                        break;
+                    }
+                }
+
+                if (value_end == subfield_end) {
+                    break;
+                }
+                value = value_end + 1;
+            }
+
+            long number = fields[j].number;
+            if (number > 0 ? count != number : number == 0 && count > 1) {
+                return false;
+            }
+
+            if (subfield_end == end) {
+                return true;
+            }
+            subfield = subfield_end + 1;
         }
 
-        check_sample_subfields_cardinality_type(i, subfields, format_meta);
+        return false;   // more subfields than fields in the FORMAT column
     }
 
     void Record::check_sample_subfields_count(size_t i, std::vector<std::string> const & subfields) const
@@ -471,17 +687,17 @@ namespace ebi
         }
     }
 
-    void Record::check_sample_subfields_cardinality_type(size_t i, std::vector<std::string> const & subfields, std::vector<MetaEntry> const & format_meta) const
+    void Record::check_sample_subfields_cardinality_type(size_t i, std::vector<std::string> const & subfields, FormatPlan const & plan) const
     {
         std::vector<std::string> values;
 
         for (size_t j = 0; j < subfields.size(); ++j) {
-            MetaEntry meta = format_meta[j];
+            FieldMeta const & meta = plan.fields[j];
             auto & subfield = subfields[j];
             
             util::string_split(subfield, ",", values);
 
-            if (meta.id == "") {
+            if (not meta.in_meta) {
                 try {
                     if (source->version == Version::v41 || source->version == Version::v42) {
                         check_predefined_tag(format[j], subfield, values, format_v41_v42);
@@ -495,19 +711,17 @@ namespace ebi
                 // FORMAT fields not described in the meta section can't be checked
 
             } else {
-                auto & key_values = boost::get<std::map < std::string, std::string>>(meta.value);
-
                 try {
-                    check_field_cardinality(subfield, values, key_values[NUMBER]);
-                    check_field_type(values, key_values[TYPE]);
+                    check_field_cardinality(subfield, values, meta.number);
+                    check_field_type(values, meta.type);
                 } catch (std::shared_ptr<Error> ex) {
                     long cardinality;
-                    bool valid = is_valid_cardinality(key_values[NUMBER], alternate_alleles.size(), cardinality);
+                    bool valid = is_valid_cardinality(meta.number, alternate_alleles.size(), cardinality);
                     long number = valid ? cardinality : -1;
  
-                    std::string message = "Sample #" + std::to_string(i + 1) + ", " + key_values[ID] + "=" + subfield
+                    std::string message = "Sample #" + std::to_string(i + 1) + ", " + format[j] + "=" + subfield
                             + " does not match the meta" + ex->message;
-                    throw new SamplesFieldBodyError{line, message, key_values[ID], number};
+                    throw new SamplesFieldBodyError{line, message, format[j], number};
                 }
             }
 
@@ -703,9 +917,9 @@ namespace ebi
                                       std::multimap<std::string, MetaEntry>::iterator end)
     {
         for (std::multimap<std::string, MetaEntry>::iterator current = begin; current != end; ++current) {
-            auto & key_values = boost::get<std::map < std::string, std::string >> ((current->second).value);
+            auto & key_values = boost::get<MetaKeyValues>((current->second).value);
 
-            if (key_values[ID] == field_value) {
+            if (key_values.has_value(ID, field_value)) {
                 return true;
             }
         }
@@ -0,0 +1,61 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "vcf/record_block.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    RecordBlock::RecordBlock(size_t capacity) : capacity{capacity}
+    {
+        records.reserve(capacity);
+        lines.reserve(capacity);
+        positions.reserve(capacity);
+        contig_ids.reserve(capacity);
+    }
+
+    void RecordBlock::add(std::unique_ptr<Record> record)
+    {
+        // a sorted input has long runs of the same contig, so the contig of the previous record is tried first
+        size_t contig_id;
+        if (not contig_ids.empty() && contig_names[contig_ids.back()] == record->chromosome) {
+            contig_id = contig_ids.back();
+        } else {
+            auto inserted = contig_ids_by_name.emplace(record->chromosome, contig_names.size());
+            contig_id = inserted.first->second;
+            if (inserted.second) {
+                contig_names.push_back(record->chromosome);
+            }
+        }
+
+        lines.push_back(record->line);
+        positions.push_back(record->position);
+        contig_ids.push_back(contig_id);
+        records.push_back(std::move(record));
+    }
+
+    void RecordBlock::clear()
+    {
+        records.clear();
+        lines.clear();
+        positions.clear();
+        contig_ids.clear();
+        contig_names.clear();
+        contig_ids_by_name.clear();
+    }
+  }
+}
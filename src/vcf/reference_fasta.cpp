@@ -0,0 +1,161 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cctype>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "util/string_utils.hpp"
+#include "vcf/reference_fasta.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    namespace
+    {
+      size_t parse_number(std::string const &value, std::string const &index_line)
+      {
+          if (value.empty() || value.find_first_not_of("0123456789") != std::string::npos) {
+              throw std::runtime_error{"Malformed line in the FASTA index: " + index_line};
+          }
+          return std::stoull(value);
+      }
+
+      bool is_unambiguous(char base)
+      {
+          return base == 'A' || base == 'C' || base == 'G' || base == 'T';
+      }
+    }
+
+    ReferenceFasta::ReferenceFasta(std::string const & path) : path{path}, data{nullptr}, size{0}
+    {
+        read_index(path + ".fai");
+
+        int file = open(path.c_str(), O_RDONLY);
+        if (file < 0) {
+            throw std::runtime_error{"Couldn't open the reference FASTA " + path};
+        }
+        struct stat file_status;
+        if (fstat(file, &file_status) != 0 || file_status.st_size == 0) {
+            close(file);
+            throw std::runtime_error{"Couldn't read the reference FASTA " + path};
+        }
+        size = static_cast<size_t>(file_status.st_size);
+
+        for (auto & contig : contigs) {
+            Contig const & location = contig.second;
+            size_t full_lines = location.length == 0 ? 0 : (location.length - 1) / location.line_bases;
+            size_t end = location.offset + full_lines * location.line_width
+                         + (location.length - full_lines * location.line_bases);
+            if (end > size) {
+                close(file);
+                throw std::runtime_error{"The index of the reference FASTA " + path + " doesn't match it: contig '"
+                                         + contig.first + "' goes beyond the end of the file"};
+            }
+        }
+
+        // the mapping stays valid after closing the file
+        void * mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+        close(file);
+        if (mapping == MAP_FAILED) {
+            throw std::runtime_error{"Couldn't map the reference FASTA " + path + " in memory"};
+        }
+        data = static_cast<char const *>(mapping);
+    }
+
+    ReferenceFasta::~ReferenceFasta()
+    {
+        if (data != nullptr) {
+            munmap(const_cast<char *>(data), size);
+        }
+    }
+
+    void ReferenceFasta::read_index(std::string const & index_path)
+    {
+        std::ifstream index{index_path};
+        if (not index) {
+            throw std::runtime_error{"Couldn't open the FASTA index " + index_path
+                                     + ", please create it with 'samtools faidx'"};
+        }
+
+        std::string line;
+        while (std::getline(index, line)) {
+            util::remove_end_of_line(line);
+            if (line.empty()) {
+                continue;
+            }
+            std::vector<std::string> columns;
+            util::string_split(line, "\t", columns);
+            if (columns.size() < 5) {
+                throw std::runtime_error{"Malformed line in the FASTA index: " + line};
+            }
+            Contig contig{parse_number(columns[1], line), parse_number(columns[2], line),
+                          parse_number(columns[3], line), parse_number(columns[4], line)};
+            if (contig.line_bases == 0 || contig.line_width < contig.line_bases) {
+                throw std::runtime_error{"Malformed line in the FASTA index: " + line};
+            }
+            contigs[columns[0]] = contig;
+        }
+    }
+
+    ReferenceFasta::Contig const * ReferenceFasta::find_contig(std::string const & name) const
+    {
+        auto contig = contigs.find(name);
+        return contig == contigs.end() ? nullptr : &contig->second;
+    }
+
+    char ReferenceFasta::base(Contig const & contig, size_t position) const
+    {
+        size_t index = position - 1;
+        size_t offset = contig.offset + index / contig.line_bases * contig.line_width + index % contig.line_bases;
+        return static_cast<char>(std::toupper(static_cast<unsigned char>(data[offset])));
+    }
+
+    bool ReferenceFasta::matches(Contig const & contig, size_t position, std::string const & bases) const
+    {
+        if (position == 0 || position - 1 + bases.size() > contig.length) {
+            return false;
+        }
+
+        // walk the line of each base instead of locating every base on its own
+        size_t index = position - 1;
+        char const * current = data + contig.offset + index / contig.line_bases * contig.line_width
+                               + index % contig.line_bases;
+        size_t left_in_line = contig.line_bases - index % contig.line_bases;
+        for (char allele_base : bases) {
+            if (left_in_line == 0) {
+                current += contig.line_width - contig.line_bases;
+                left_in_line = contig.line_bases;
+            }
+            char expected = static_cast<char>(std::toupper(static_cast<unsigned char>(allele_base)));
+            char found = static_cast<char>(std::toupper(static_cast<unsigned char>(*current)));
+            if (expected != found && expected != 'N' && is_unambiguous(found)) {
+                return false;
+            }
+            ++current;
+            --left_in_line;
+        }
+        return true;
+    }
+  }
+}
@@ -0,0 +1,158 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+
+#include "util/stream_utils.hpp"
+#include "vcf/region.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    namespace
+    {
+      std::string const region_format_help = "please use the format chr:start-end, or {chr}:start-end if the "
+                                             "contig name contains ':'";
+
+      size_t parse_coordinate(std::string const & coordinate, std::string const & region)
+      {
+          if (coordinate.empty() || coordinate.find_first_not_of("0123456789") != std::string::npos) {
+              throw std::invalid_argument{"Region " + region + " is not valid, " + region_format_help};
+          }
+          return std::stoul(coordinate);
+      }
+
+      Region parse_range(std::string const & chromosome, std::string const & coordinates, std::string const & region)
+      {
+          size_t dash = coordinates.find('-');
+          size_t start = parse_coordinate(coordinates.substr(0, dash), region);
+          size_t end = dash == std::string::npos ?
+                  std::numeric_limits<size_t>::max() : parse_coordinate(coordinates.substr(dash + 1), region);
+
+          if (chromosome.empty() || start > end) {
+              throw std::invalid_argument{"Region " + region + " is not valid, " + region_format_help};
+          }
+          return Region{chromosome, start, end};
+      }
+    }
+
+    Region parse_region(std::string const & region)
+    {
+        if (not region.empty() && region.front() == '{') {
+            size_t brace = region.find('}');
+            if (brace == std::string::npos || brace == 1
+                    || (brace + 1 != region.size() && region[brace + 1] != ':')) {
+                throw std::invalid_argument{"Region " + region + " is not valid, " + region_format_help};
+            }
+            std::string chromosome = region.substr(1, brace - 1);
+            if (brace + 1 == region.size()) {
+                return Region{chromosome, 0, std::numeric_limits<size_t>::max()};
+            }
+            return parse_range(chromosome, region.substr(brace + 2), region);
+        }
+
+        size_t colon = region.rfind(':');
+        if (colon == std::string::npos) {
+            return Region{region, 0, std::numeric_limits<size_t>::max()};
+        }
+
+        std::string chromosome = region.substr(0, colon);
+        if (chromosome.find(':') != std::string::npos) {
+            // "a:b:1" could be a range of "a:b" or the whole contig "a:b:1", which can't be told apart
+            throw std::invalid_argument{"Region " + region + " is ambiguous, as the contig name contains ':'. Please "
+                                        "write it as {" + chromosome + "}:" + region.substr(colon + 1)
+                                        + " for a range of the contig " + chromosome + ", or as {" + region
+                                        + "} for the whole contig " + region};
+        }
+        return parse_range(chromosome, region.substr(colon + 1), region);
+    }
+
+    bool is_in_regions(std::vector<char> const & line, std::vector<Region> const & regions)
+    {
+        auto chromosome_end = std::find_if(line.begin(), line.end(), [](char c) {
+            return c == '\t' || c == '\n' || c == '\r';
+        });
+        std::string chromosome{line.begin(), chromosome_end};
+
+        bool requested = std::any_of(regions.begin(), regions.end(), [&chromosome](Region const & region) {
+            return region.chromosome == chromosome;
+        });
+        if (not requested) {
+            return false;
+        }
+
+        size_t position = 0;
+        auto it = chromosome_end == line.end() || *chromosome_end != '\t' ? line.end() : chromosome_end + 1;
+        auto position_start = it;
+        for (; it != line.end() && *it >= '0' && *it <= '9'; ++it) {
+            position = position * 10 + (*it - '0');
+        }
+        if (it == position_start || it == line.end() || *it != '\t') {
+            return true;
+        }
+
+        return std::any_of(regions.begin(), regions.end(), [&chromosome, position](Region const & region) {
+            return region.contains(chromosome, position);
+        });
+    }
+
+    bool is_valid_vcf_file_regions(std::istream &input,
+                                   const std::string &sourceName,
+                                   ValidationLevel validationLevel,
+                                   Ploidy ploidy,
+                                   std::vector<std::unique_ptr<ReportWriter>> &outputs,
+                                   std::vector<Region> const &regions,
+                                   ValidationOptions const &validationOptions)
+    {
+        // the meta and header sections are always validated completely
+        std::vector<char> line;
+        std::unique_ptr<Parser> validator = validate_up_to_body(line, input, sourceName, validationLevel, ploidy,
+                                                                outputs, validationOptions);
+        if (validator == nullptr) {
+            return false;
+        }
+
+        size_t validated_records = 0;
+        size_t skipped_records = 0;
+        ReportFlusher flusher;
+        while (line.size() != 0) {
+            if (is_in_regions(line, regions)) {
+                validator->parse(line);
+                write_errors(*validator, outputs);
+                flusher.line_validated(outputs);
+                ++validated_records;
+            } else {
+                validator->skip(line);
+                ++skipped_records;
+            }
+            ebi::util::readline(input, line);
+        }
+
+        // the mates of the records in the regions may be outside them
+        validator->clear_previous_records();
+        validator->end();
+        write_errors(*validator, outputs);
+        write_error_counts(*validator, outputs);
+
+        std::string message = "Validated " + std::to_string(validated_records) + " records in the requested regions, "
+                + std::to_string(skipped_records) + " records outside them were skipped";
+        write_message(message, outputs);
+
+        return validator->is_valid();
+    }
+  }
+}
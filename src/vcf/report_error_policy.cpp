@@ -30,6 +30,13 @@ namespace ebi
     {
         state.add_warning(std::unique_ptr<Error>(error));
     }
+
+    ErrorCounts const & ReportErrorPolicy::get_counts() const
+    {
+        // the errors are not counted
+        static ErrorCounts const no_counts{};
+        return no_counts;
+    }
   }
 }
 
@@ -0,0 +1,188 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <iomanip>
+#include <set>
+#include <sstream>
+
+#include "util/stream_utils.hpp"
+#include "vcf/error_classifier.hpp"
+#include "vcf/sampling.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    namespace
+    {
+      /**
+       * Errors about the meta and header sections can be raised while parsing the first record (e.g. a missing
+       * 'reference' entry), but they say nothing about the records, so they are not part of the estimates.
+       */
+      bool is_record_error_class(std::string const &error_class)
+      {
+          return error_class != "MetaSectionError" && error_class != "HeaderSectionError"
+                 && error_class != "FileformatError";
+      }
+
+      /**
+       * Adds 1 to the count of every class of error found in the last line parsed. Several errors of the same class
+       * in a line count once, as the estimates are about the proportion of affected records.
+       */
+      void count_error_classes(Parser const &validator, ErrorClassifier &classifier, std::vector<size_t> &counts)
+      {
+          std::set<size_t> classes;
+          for (auto &error : validator.errors()) {
+              classes.insert(classifier.classify(*error));
+          }
+          for (auto &error : validator.warnings()) {
+              classes.insert(classifier.classify(*error));
+          }
+          for (size_t error_class : classes) {
+              if (is_record_error_class(ErrorClassifier::names()[error_class])) {
+                  counts[error_class]++;
+              }
+          }
+      }
+
+      std::string percentage(double rate)
+      {
+          std::stringstream ss;
+          ss << std::setprecision(3) << rate * 100 << "%";
+          return ss.str();
+      }
+    }
+
+    ErrorRateEstimate estimate_error_rate(std::string const &error_class, size_t affected, size_t total)
+    {
+        if (total == 0) {
+            return ErrorRateEstimate{error_class, affected, 0, 0, 1};
+        }
+
+        double const z = 1.96;
+        double n = static_cast<double>(total);
+        double rate = affected / n;
+        double denominator = 1 + z * z / n;
+        double center = (rate + z * z / (2 * n)) / denominator;
+        double margin = z * std::sqrt(rate * (1 - rate) / n + z * z / (4 * n * n)) / denominator;
+
+        return ErrorRateEstimate{error_class, affected, rate, std::max(0.0, center - margin), std::min(1.0, center + margin)};
+    }
+
+    bool is_valid_vcf_file_sample(std::istream &input,
+                                  const std::string &sourceName,
+                                  ValidationLevel validationLevel,
+                                  Ploidy ploidy,
+                                  std::vector<std::unique_ptr<ReportWriter>> &outputs,
+                                  SamplingOptions const &options,
+                                  ValidationOptions const &validationOptions)
+    {
+        // the meta and header sections are always validated completely
+        std::vector<char> line;
+        size_t lines_read;
+        std::unique_ptr<Parser> validator = validate_up_to_body(line, input, sourceName, validationLevel, ploidy,
+                                                                outputs, validationOptions, &lines_read);
+        if (validator == nullptr) {
+            return false;
+        }
+
+        input.clear();
+        std::streamoff body_start = static_cast<std::streamoff>(input.tellg()) - line.size();
+        input.seekg(0, std::ios::end);
+        std::streamoff body_end = input.tellg();
+        if (not input || body_start < 0 || body_end < 0) {
+            throw std::invalid_argument{"The input must be a seekable file to validate a sample of it"};
+        }
+
+        // the sortedness of the records is checked inside each window, as the records between them are not read
+        std::string sorting_state;
+        {
+            std::ostringstream state;
+            validator->save_sorting(state);
+            sorting_state = state.str();
+        }
+
+        ErrorClassifier classifier;
+        std::vector<size_t> affected_records(ErrorClassifier::names().size(), 0);
+        size_t sampled_records = 0;
+        size_t sampled_bytes = 0;
+        std::streamoff window_end = body_start;
+
+        for (size_t window = 0; window < options.windows && window_end < body_end; ++window) {
+            std::streamoff offset = body_start + (body_end - body_start) * window / options.windows;
+            input.clear();
+            if (offset <= window_end) {
+                // windows are so close that they would overlap, continue where the previous one finished
+                input.seekg(window_end);
+            } else {
+                // resynchronize on the beginning of the next line
+                input.seekg(offset - 1);
+                ebi::util::readline(input, line);
+            }
+            std::streamoff window_start = input.tellg();
+            size_t first_line = lines_read + 1;
+
+            validator->clear_previous_records();
+            std::istringstream state{sorting_state};
+            validator->restore_sorting(state);
+            size_t records = 0;
+            while (records < options.records_per_window && ebi::util::readline(input, line).size() != 0) {
+                validator->parse(line);
+                count_error_classes(*validator, classifier, affected_records);
+                write_errors(*validator, outputs);
+                ++records;
+                sampled_bytes += line.size();
+            }
+            lines_read += records;
+            sampled_records += records;
+
+            input.clear();
+            window_end = records > 0 ? static_cast<std::streamoff>(input.tellg()) : body_end;
+            if (records > 0) {
+                write_message("Sample window " + std::to_string(window + 1) + " starts at byte "
+                              + std::to_string(window_start) + "; its records are reported as lines "
+                              + std::to_string(first_line) + " to " + std::to_string(lines_read), outputs);
+            }
+        }
+
+        // the mates of the sampled records may be outside the windows
+        validator->clear_previous_records();
+        validator->end();
+        write_errors(*validator, outputs);
+
+        size_t estimated_records = sampled_bytes == 0 ? 0 :
+                static_cast<size_t>(std::llround(double(body_end - body_start) * sampled_records / sampled_bytes));
+        write_message("Validated " + std::to_string(sampled_records) + " sampled records out of about "
+                      + std::to_string(estimated_records) + " in the file", outputs);
+
+        for (size_t error_class = 0; error_class < affected_records.size(); ++error_class) {
+            if (affected_records[error_class] == 0) {
+                continue;
+            }
+            ErrorRateEstimate estimate = estimate_error_rate(ErrorClassifier::names()[error_class],
+                                                             affected_records[error_class], sampled_records);
+            write_message("Estimated rate of records with " + estimate.error_class + ": "
+                          + percentage(estimate.rate) + " (95% confidence interval " + percentage(estimate.lower_bound)
+                          + " to " + percentage(estimate.upper_bound) + "), about "
+                          + std::to_string(std::llround(estimate.rate * estimated_records)) + " records in the file",
+                          outputs);
+        }
+
+        return validator->is_valid();
+    }
+  }
+}
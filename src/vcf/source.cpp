@@ -14,13 +14,25 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <set>
+
+#include "util/logger.hpp"
 #include "vcf/file_structure.hpp"
 
 namespace ebi
 {
   namespace vcf
   {
-    
+    namespace
+    {
+      /**
+       * Files with more distinct FORMAT columns than this are unusual, and the plans are resolved again instead of
+       * growing without limit
+       */
+      size_t const max_format_plans = 1000;
+    }
+
     Source::Source(std::string const & name,
                    unsigned const input_format,
                    Version version,
@@ -37,5 +49,80 @@ namespace ebi
         
     }
 
+    void Source::set_samples_names(std::vector<std::string> names)
+    {
+        samples_names = std::move(names);
+        validated_samples.clear();
+        if (sample_selection.is_everything_selected()) {
+            return;
+        }
+
+        validated_samples.reserve(samples_names.size());
+        for (auto & name : samples_names) {
+            validated_samples.push_back(sample_selection.is_selected(name));
+        }
+        for (auto & name : sample_selection.selected_names()) {
+            if (std::find(samples_names.begin(), samples_names.end(), name) == samples_names.end()) {
+                BOOST_LOG_TRIVIAL(warning) << "Sample " << name << " was selected for validation but it is not listed in the header line";
+            }
+        }
+    }
+
+    FormatPlan const & Source::get_format_plan(std::vector<std::string> const & format)
+    {
+        auto found = format_plans.find(format);
+        if (found != format_plans.end()) {
+            return found->second;
+        }
+
+        if (format_plans.size() >= max_format_plans) {
+            format_plans.clear();
+        }
+
+        FormatPlan plan;
+        plan.gt_misplaced = std::find(format.begin(), format.end(), GT) != format.end() && format[0] != GT;
+        plan.has_duplicates = std::set<std::string>(format.begin(), format.end()).size() != format.size();
+
+        auto range = meta_entries.equal_range(FORMAT);
+        for (auto & field : format) {
+            FieldMeta field_meta{false, "", ""};
+            for (auto current = range.first; current != range.second; ++current) {
+                auto key_values = boost::get<MetaKeyValues>(&current->second.value);
+                if (key_values != nullptr && key_values->has_value(ID, field)) {
+                    field_meta = FieldMeta{true, (*key_values)[NUMBER], (*key_values)[TYPE]};
+                    break;
+                }
+            }
+            plan.fields.push_back(field_meta);
+        }
+
+        return format_plans.emplace(format, std::move(plan)).first->second;
+    }
+
+    FieldMeta const * Source::find_info_meta(std::string const & id)
+    {
+        if (not info_meta_resolved) {
+            auto range = meta_entries.equal_range(INFO);
+            for (auto current = range.first; current != range.second; ++current) {
+                auto key_values = boost::get<MetaKeyValues>(&current->second.value);
+                if (key_values != nullptr && key_values->count(ID) != 0) {
+                    // emplace keeps the first entry of each ID
+                    info_meta.emplace((*key_values)[ID], FieldMeta{true, (*key_values)[NUMBER], (*key_values)[TYPE]});
+                }
+            }
+            info_meta_resolved = true;
+        }
+
+        auto found = info_meta.find(id);
+        return found == info_meta.end() ? nullptr : &found->second;
+    }
+
+    void Source::meta_entries_changed()
+    {
+        format_plans.clear();
+        info_meta.clear();
+        info_meta_resolved = false;
+    }
+
   }
 }
@@ -14,21 +14,41 @@
  * limitations under the License.
  */
 
+#include <limits>
+
+#include "util/memory_budget.hpp"
+#include "util/serialization.hpp"
 #include "vcf/parse_policy.hpp"
 
 namespace ebi
 {
   namespace vcf
   {
+    namespace
+    {
+      size_t contig_memory(std::string const & contig)
+      {
+          return util::tree_node_overhead + sizeof(std::pair<std::string const, bool>) + util::heap_size(contig);
+      }
+    }
+
+    StoreParsePolicy::~StoreParsePolicy()
+    {
+        util::memory_budget().release(contigs_memory);
+    }
 
     void StoreParsePolicy::handle_token_begin(ParsingState const & state)
     {
         m_current_token = std::string{};
+        // the columns of the samples not selected are left empty, so they are not stored nor checked
+        m_skip_token = state.n_columns > 9 && not state.source->is_sample_validated(state.n_columns - 10);
     }
 
     void StoreParsePolicy::handle_token_char(ParsingState const & state, char c)
     {
-        m_current_token.push_back(c);
+        if (not m_skip_token) {
+            m_current_token.push_back(c);
+        }
     }
 
     void StoreParsePolicy::handle_token_end(ParsingState const & state) 
@@ -92,11 +112,11 @@ namespace ebi
             state.add_meta(MetaEntry{state.n_lines, m_line_typeid, m_grouped_tokens[0], state.source});
 
         } else if (m_grouped_tokens.size() % 2 == 0) { // TypeID=<Key-value pairs>
-            auto key_values = std::map<std::string, std::string>{};
+            MetaKeyValues key_values;
             for (size_t i = 0; i < m_grouped_tokens.size(); i += 2) {
-                key_values[m_grouped_tokens[i]] = m_grouped_tokens[i+1];
+                key_values.set(m_grouped_tokens[i], m_grouped_tokens[i+1]);
             }
-            state.add_meta(MetaEntry{state.n_lines, m_line_typeid, key_values, state.source});
+            state.add_meta(MetaEntry{state.n_lines, m_line_typeid, std::move(key_values), state.source});
 
         } else {
             throw new MetaSectionError{state.n_lines, "Meta line description is not a value, nor a TypeID=value, nor a TypeID=<Key-value pairs>"};
@@ -111,7 +131,8 @@ namespace ebi
 
     void StoreParsePolicy::handle_header_line(ParsingState & state)
     {
-        state.set_samples(m_grouped_tokens);
+        state.set_samples(std::move(m_grouped_tokens));
+        m_grouped_tokens.clear();
     }
 
 
@@ -156,7 +177,7 @@ namespace ebi
         m_grouped_tokens = std::vector<std::string>{};
     }
 
-    void StoreParsePolicy::handle_body_line(ParsingState & state)
+    std::vector<std::unique_ptr<Error>> StoreParsePolicy::handle_body_line(ParsingState & state)
     {
         size_t position;
         try {
@@ -194,7 +215,8 @@ namespace ebi
         auto samples = m_line_tokens.find(SAMPLES) != m_line_tokens.end() ?
                        m_line_tokens[SAMPLES] : std::vector<std::string>{};
 
-        state.set_record(std::unique_ptr<Record>{new Record{
+        std::vector<std::unique_ptr<Error>> collected_errors;
+        std::unique_ptr<Record> record{new Record{
                 state.n_lines,
                 m_line_tokens[CHROM][0],
                 position,
@@ -206,10 +228,48 @@ namespace ebi
                 info,
                 format,
                 samples,
-                state.source
-        }});
+                state.source,
+                state.source->collect_all_errors ? &collected_errors : nullptr
+        }};
 
-        check_sorted(state, position);
+        if (not collected_errors.empty()) {
+            // the record is discarded like when the first error is thrown
+            return collected_errors;
+        }
+        if (state.source->record_blocks) {
+            state.record_block.add(std::move(record));
+            return {};
+        }
+        state.set_record(std::move(record));
+
+        check_sorted(m_line_tokens[CHROM][0], position, state.n_lines);
+        return {};
+    }
+
+    std::vector<std::unique_ptr<Error>> StoreParsePolicy::handle_body_block(ParsingState & state,
+                                                                            RecordBlock const & block)
+    {
+        std::vector<std::unique_ptr<Error>> errors;
+
+        // after a record that left its contig as the previous one, the next records with the same contig id are only
+        // compared to the previous position, without comparing the names
+        size_t const no_contig = std::numeric_limits<size_t>::max();
+        size_t previous_contig_id = no_contig;
+        for (size_t i = 0; i < block.size(); ++i) {
+            std::string const & contig = block.contig_names[block.contig_ids[i]];
+            try {
+                if (block.contig_ids[i] == previous_contig_id) {
+                    check_sorted_position(contig, block.positions[i], block.lines[i]);
+                } else {
+                    previous_contig_id = no_contig;
+                    check_sorted(contig, block.positions[i], block.lines[i]);
+                    previous_contig_id = block.contig_ids[i];
+                }
+            } catch (Error *error) {
+                errors.emplace_back(error);
+            }
+        }
+        return errors;
     }
     
     std::string StoreParsePolicy::current_token() const
@@ -226,33 +286,93 @@ namespace ebi
         }
     }
 
-    void StoreParsePolicy::check_sorted(ParsingState &state, size_t position)
+    void StoreParsePolicy::write_state(std::ostream & output) const
+    {
+        util::write_size(output, finished_contigs.size());
+        for (auto & contig : finished_contigs) {
+            util::write_string(output, contig.first);
+            util::write_size(output, contig.second);
+        }
+        util::write_string(output, previous_contig);
+        util::write_size(output, previous_position);
+    }
+
+    void StoreParsePolicy::read_state(std::istream & input)
+    {
+        std::map<std::string, bool> contigs;
+        for (size_t count = util::read_size(input); count > 0; --count) {
+            std::string contig = util::read_string(input);
+            contigs[contig] = util::read_size(input) != 0;
+        }
+        std::string contig = util::read_string(input);
+        size_t position = util::read_size(input);
+
+        util::memory_budget().release(contigs_memory);
+        contigs_memory = 0;
+        finished_contigs.clear();
+        for (auto & restored : contigs) {
+            if (reserve_contig(restored.first)) {
+                finished_contigs.emplace_hint(finished_contigs.end(), restored);
+            }
+        }
+        previous_contig = contig;
+        previous_position = position;
+    }
+
+    bool StoreParsePolicy::reserve_contig(std::string const & contig)
     {
-        // check contigs are contiguous
-        auto iterator = finished_contigs.find(m_line_tokens[CHROM][0]);
+        size_t bytes = contig_memory(contig);
+        if (not util::memory_budget().reserve(bytes)) {
+            util::memory_budget().add_note("The memory limit was reached, so some chromosomes were not checked to be "
+                                           "contiguous");
+            return false;
+        }
+        contigs_memory += bytes;
+        return true;
+    }
+
+    void StoreParsePolicy::check_sorted(std::string const & contig, size_t position, size_t line)
+    {
+        // check contigs are contiguous, which only needs the table of contigs when the contig changes: the rest of
+        // the records are only compared to the previous position, even in a contig that didn't fit in the memory
+        // budget and so is not in the table
+        if (contig == previous_contig && not previous_contig.empty()) {
+            check_sorted_position(contig, position, line);
+            return;
+        }
+
+        auto iterator = finished_contigs.find(contig);
         bool contig_not_found = iterator == finished_contigs.end();
-        bool contig_already_finished = iterator->second;
+        bool contig_already_finished = not contig_not_found && iterator->second;
         if (contig_not_found) {
             // contig not found in the map: finishing the previous contig, and starting a new one
-            if (finished_contigs.size() != 0) {
+            auto previous = finished_contigs.find(previous_contig);
+            if (previous != finished_contigs.end()) {
                 // with the first contig there's no previous contig
-                finished_contigs[previous_contig] = true;
+                previous->second = true;
+            }
+            if (reserve_contig(contig)) {
+                finished_contigs[contig] = false;
             }
-            finished_contigs[m_line_tokens[CHROM][0]] = false;
-            previous_contig = m_line_tokens[CHROM][0];
+            previous_contig = contig;
             previous_position = 0;  // position sorting is reset
         } else if (contig_already_finished) {
             std::stringstream ss;
-            ss << "Variant " << m_line_tokens[CHROM][0] << ":" << position << " is not contiguous to the rest of the contig";
-            throw new BodySectionError{state.n_lines, ss.str()};
+            ss << "Variant " << contig << ":" << position << " is not contiguous to the rest of the contig";
+            throw new BodySectionError{line, ss.str()};
         }
 
+        check_sorted_position(contig, position, line);
+    }
+
+    void StoreParsePolicy::check_sorted_position(std::string const & contig, size_t position, size_t line)
+    {
         // check all positions are sorted within a contig
         if (position < previous_position) {
             std::stringstream ss;
-            ss << "Contig " << m_line_tokens[CHROM][0] << " is not sorted by position: "
+            ss << "Contig " << contig << " is not sorted by position: "
                << position << " found after " << previous_position;
-            throw new PositionBodyError{state.n_lines, ss.str()};
+            throw new PositionBodyError{line, ss.str()};
         }
         previous_position = position;
     }
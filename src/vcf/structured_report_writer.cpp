@@ -0,0 +1,239 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+
+#include "vcf/error_classifier.hpp"
+#include "vcf/structured_report_writer.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    namespace
+    {
+      std::string const binary_report_magic = "VCFRB001";
+
+      /**
+       * Copies into ErrorFields the members of each class of Error
+       */
+      class ErrorFieldsVisitor : public ErrorVisitor
+      {
+        public:
+          ErrorFieldsVisitor(ErrorFields &fields) : fields(fields) { }
+
+          virtual void visit(Error &error) override { }
+          virtual void visit(MetaSectionError &error) override
+          {
+              fields.value = error.value;
+              fields.expected_value = error.expected_value;
+          }
+          virtual void visit(HeaderSectionError &error) override { }
+          virtual void visit(BodySectionError &error) override { }
+          virtual void visit(NoMetaDefinitionError &error) override
+          {
+              fields.column = error.column;
+              fields.field = error.field;
+          }
+          virtual void visit(FileformatError &error) override
+          {
+              fields.value = error.value;
+              fields.expected_value = error.expected_value;
+          }
+          virtual void visit(ChromosomeBodyError &error) override { }
+          virtual void visit(PositionBodyError &error) override { }
+          virtual void visit(IdBodyError &error) override { }
+          virtual void visit(ReferenceAlleleBodyError &error) override { }
+          virtual void visit(AlternateAllelesBodyError &error) override { }
+          virtual void visit(QualityBodyError &error) override { }
+          virtual void visit(FilterBodyError &error) override
+          {
+              fields.field = error.field;
+          }
+          virtual void visit(InfoBodyError &error) override
+          {
+              fields.field = error.field;
+              fields.expected_value = error.expected_value;
+          }
+          virtual void visit(FormatBodyError &error) override { }
+          virtual void visit(SamplesBodyError &error) override { }
+          virtual void visit(SamplesFieldBodyError &error) override
+          {
+              fields.field = error.field;
+          }
+          virtual void visit(NormalizationError &error) override { }
+          virtual void visit(DuplicationError &error) override { }
+
+        private:
+          ErrorFields &fields;
+      };
+
+      void write_json_string(std::ostream &output, std::string const &text)
+      {
+          output << '"';
+          for (char c : text) {
+              switch (c) {
+              case '"':
+                  output << "\\\"";
+                  break;
+              case '\\':
+                  output << "\\\\";
+                  break;
+              case '\n':
+                  output << "\\n";
+                  break;
+              case '\r':
+                  output << "\\r";
+                  break;
+              case '\t':
+                  output << "\\t";
+                  break;
+              default:
+                  if (static_cast<unsigned char>(c) < 0x20) {
+                      char escaped[7];
+                      std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned char>(c));
+                      output << escaped;
+                  } else {
+                      output << c;
+                  }
+              }
+          }
+          output << '"';
+      }
+
+      void write_json_member(std::ostream &output, char const * name, std::string const &value)
+      {
+          if (not value.empty()) {
+              output << ",\"" << name << "\":";
+              write_json_string(output, value);
+          }
+      }
+
+      void append_number(std::string &record, uint64_t value, size_t bytes)
+      {
+          for (size_t i = 0; i < bytes; ++i) {
+              record.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+          }
+      }
+
+      void append_string(std::string &record, std::string const &text)
+      {
+          append_number(record, text.size(), 4);
+          record += text;
+      }
+    }
+
+    ErrorFields get_error_fields(Error &error)
+    {
+        ErrorFields fields{ErrorClassifier{}.classify(error), "", "", "", ""};
+        ErrorFieldsVisitor visitor{fields};
+        error.apply_visitor(visitor);
+        return fields;
+    }
+
+    JsonReportWriter::JsonReportWriter(std::string const &filename) : buffer(default_report_buffer_size)
+    {
+        file.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+        file.open(filename, std::ios::out);
+    }
+
+    void JsonReportWriter::write_error(Error &error)
+    {
+        write(error, "error");
+    }
+
+    void JsonReportWriter::write_warning(Error &error)
+    {
+        write(error, "warning");
+    }
+
+    void JsonReportWriter::write_message(std::string const &message)
+    {
+        file << "{\"severity\":\"message\",\"message\":";
+        write_json_string(file, message);
+        file << "}\n";
+    }
+
+    void JsonReportWriter::flush()
+    {
+        file.flush();
+    }
+
+    void JsonReportWriter::write(Error &error, char const * severity)
+    {
+        ErrorFields fields = get_error_fields(error);
+        file << "{\"severity\":\"" << severity << "\",\"code\":\"" << ErrorClassifier::names()[fields.code]
+             << "\",\"line\":" << error.line << ",\"message\":";
+        write_json_string(file, error.message);
+        write_json_member(file, "column", fields.column);
+        write_json_member(file, "field", fields.field);
+        write_json_member(file, "value", fields.value);
+        write_json_member(file, "expected_value", fields.expected_value);
+        file << "}\n";
+    }
+
+    BinaryReportWriter::BinaryReportWriter(std::string const &filename) : buffer(default_report_buffer_size)
+    {
+        file.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+        file.open(filename, std::ios::out | std::ios::binary);
+        file.write(binary_report_magic.data(), binary_report_magic.size());
+    }
+
+    void BinaryReportWriter::write_error(Error &error)
+    {
+        ErrorFields fields = get_error_fields(error);
+        write(0, static_cast<uint8_t>(fields.code), error.line, error.message, fields);
+    }
+
+    void BinaryReportWriter::write_warning(Error &error)
+    {
+        ErrorFields fields = get_error_fields(error);
+        write(1, static_cast<uint8_t>(fields.code), error.line, error.message, fields);
+    }
+
+    void BinaryReportWriter::write_message(std::string const &message)
+    {
+        write(2, 0, 0, message, ErrorFields{0, "", "", "", ""});
+    }
+
+    void BinaryReportWriter::flush()
+    {
+        file.flush();
+    }
+
+    void BinaryReportWriter::write(uint8_t kind, uint8_t code, size_t line, std::string const &message,
+                                   ErrorFields const &fields)
+    {
+        // the record is built first to know its length, reusing the same string for every record
+        record.clear();
+        record.push_back(static_cast<char>(kind));
+        record.push_back(static_cast<char>(code));
+        append_number(record, line, 8);
+        append_string(record, message);
+        append_string(record, fields.column);
+        append_string(record, fields.field);
+        append_string(record, fields.value);
+        append_string(record, fields.expected_value);
+
+        char length[4];
+        for (size_t i = 0; i < sizeof(length); ++i) {
+            length[i] = static_cast<char>((record.size() >> (8 * i)) & 0xff);
+        }
+        file.write(length, sizeof(length));
+        file.write(record.data(), record.size());
+    }
+  }
+}
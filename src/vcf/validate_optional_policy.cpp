@@ -15,11 +15,54 @@
  */
 
 #include "vcf/optional_policy.hpp"
+#include "vcf/reference_fasta.hpp"
 
 namespace ebi
 {
   namespace vcf
   {
+    namespace
+    {
+      /**
+       * Amount of alleles in the genotype of a sample, counted like splitting the sample by ':' and its first field
+       * by '/' or '|' (whose first character is never a split point), without copying them
+       */
+      size_t count_genotype_alleles(std::string const & sample)
+      {
+          if (sample.empty()) {
+              return 0;
+          }
+          size_t genotype_end = std::min(sample.find(':', 1), sample.size());
+          size_t alleles = 0;
+          for (size_t i = 1; i < genotype_end; ++i) {
+              if (sample[i] == '/' || sample[i] == '|') {
+                  ++alleles;
+              }
+          }
+          bool ends_with_separator = genotype_end > 1
+                                     && (sample[genotype_end - 1] == '/' || sample[genotype_end - 1] == '|');
+          return ends_with_separator ? alleles : alleles + 1;
+      }
+
+      /**
+       * Runs a check. If all the errors are collected, a warning is added to the collected ones and the following
+       * checks still run; otherwise it is thrown.
+       */
+      template <typename Check>
+      void run_check(ParsingState & state, std::vector<std::unique_ptr<Error>> & warnings, Check check)
+      {
+          if (not state.source->collect_all_errors) {
+              check();
+              return;
+          }
+
+          try {
+              check();
+          } catch (Error *warning) {
+              warnings.emplace_back(warning);
+          }
+      }
+    }
     
     void ValidateOptionalPolicy::optional_check_meta_section(ParsingState const & state) const
     {
@@ -28,58 +71,127 @@ namespace ebi
         }
     }
     
-    void ValidateOptionalPolicy::optional_check_body_entry(ParsingState & state, Record const & record) //const
+    std::vector<std::unique_ptr<Error>> ValidateOptionalPolicy::optional_check_body_entry(ParsingState & state,
+                                                                                        Record const & record) //const
+    {
+        return check_body_entry(state, record, nullptr, 0);
+    }
+
+    std::vector<std::unique_ptr<Error>> ValidateOptionalPolicy::optional_check_body_entry(ParsingState & state,
+                                                                                        RecordBlock const & block,
+                                                                                        size_t index)
+    {
+        return check_body_entry(state, *block.records[index], &block, index);
+    }
+
+    std::vector<std::unique_ptr<Error>> ValidateOptionalPolicy::check_body_entry(ParsingState & state,
+                                                                               Record const & record,
+                                                                               RecordBlock const * block,
+                                                                               size_t index)
     {
+        std::vector<std::unique_ptr<Error>> warnings;
+
         // All samples should have the same ploidy
-        check_body_entry_ploidy(state, record);
+        run_check(state, warnings, [&]() { check_body_entry_ploidy(state, record); });
         
-        // Position zero should only be used for telomeres
-        check_body_entry_position_zero(state, record);
+        // Position zero should only be used for telomeres (in a block, only the records found at zero are checked)
+        if (block == nullptr || block_positions_zero[index]) {
+            run_check(state, warnings, [&]() { check_body_entry_position_zero(state, record); });
+        }
         
         // The standard separator is semi-colon, commas are accepted but most probably a mistake
-        check_body_entry_id_commas(state, record);
+        run_check(state, warnings, [&]() { check_body_entry_id_commas(state, record); });
         
         // Reference and alternate alleles in indels should share the first nucleotide
-        check_body_entry_reference_alternate_matching(state, record);
+        run_check(state, warnings, [&]() { check_body_entry_reference_alternate_matching(state, record); });
 
         // 0/0 genotypes should be present when ALT is <*>, as it is supposed to be a reference region
-        check_body_entry_alt_gvcf_gt_value(state, record);
+        run_check(state, warnings, [&]() { check_body_entry_alt_gvcf_gt_value(state, record); });
 
         // gVCF fields should provide END, as <*> is supposed to represent a region
-        check_body_entry_info_gvcf_end(state, record);
+        run_check(state, warnings, [&]() { check_body_entry_info_gvcf_end(state, record); });
 
         // If a variant is flagged as precise, then it should not contain imprecise variant fields like CIPOS or CIEND
-        check_body_entry_info_imprecise(state, record);
+        run_check(state, warnings, [&]() { check_body_entry_info_imprecise(state, record); });
 
         // The number of values in SVLEN should match the number of alternate alleles
-        check_body_entry_info_svlen(state, record);
+        run_check(state, warnings, [&]() { check_body_entry_info_svlen(state, record); });
 
         // Confidence interval tags should have first value <=0 and second value >= 0
-        check_body_entry_info_confidence_interval(state, record);
+        run_check(state, warnings, [&]() { check_body_entry_info_confidence_interval(state, record); });
 
         /*
          * Once some meta-data is marked as in/correct there is no need again, so all the following have been 
          * optimised using a map for correctly defined meta-data and another one for incorrectly defined.
          */
         
-        // The chromosome/contig should be described in the meta section
-        check_contig_meta(state, record);
+        // The chromosome/contig should be described in the meta section (in a block, each contig is looked up once)
+        if (block == nullptr || not block_contigs_described[block->contig_ids[index]]) {
+            run_check(state, warnings, [&]() { check_contig_meta(state, record); });
+        }
+
+        // The chromosome/contig should be in the reference sequence, if provided, to check the reference allele
+        run_check(state, warnings, [&]() { check_contig_reference(state, record); });
         
         // Alternate alleles of the form <SOME_ALT> should be described in the meta section
-        check_alternate_allele_meta(state, record);
+        run_check(state, warnings, [&]() { check_alternate_allele_meta(state, record); });
         
         // Filters should be described in the meta section
-        check_filter_meta(state, record);
+        run_check(state, warnings, [&]() { check_filter_meta(state, record); });
         
         // Info fields should be described in the meta section
-        check_info_meta(state, record);
+        run_check(state, warnings, [&]() { check_info_meta(state, record); });
         
         // Format fields should be described in the meta section
-        check_format_meta(state, record);
+        run_check(state, warnings, [&]() { check_format_meta(state, record); });
+
+        return warnings;
     }
     
-    void ValidateOptionalPolicy::optional_check_body_section(ParsingState const & state) const
+    void ValidateOptionalPolicy::optional_check_body_block(ParsingState & state, RecordBlock const & block)
+    {
+        // the common case of no position zero is a loop without branches, that the compiler can vectorize
+        size_t const * positions = block.positions.data();
+        size_t size = block.size();
+        bool any_zero = false;
+        for (size_t i = 0; i < size; ++i) {
+            any_zero |= positions[i] == 0;
+        }
+        block_positions_zero.assign(size, false);
+        for (size_t i = 0; any_zero && i < size; ++i) {
+            block_positions_zero[i] = positions[i] == 0;
+        }
+
+        block_contigs_described.clear();
+        for (auto & contig : block.contig_names) {
+            block_contigs_described.push_back(is_contig_described(state, contig));
+        }
+    }
+
+    std::vector<std::unique_ptr<Error>> ValidateOptionalPolicy::optional_check_body_records(Record const & record)
+    {
+        return cross_record_checker.check(record);
+    }
+
+    void ValidateOptionalPolicy::optional_clear_body_records()
+    {
+        cross_record_checker.clear();
+        reference_checked_contigs.clear();
+    }
+
+    std::vector<std::unique_ptr<Error>> ValidateOptionalPolicy::optional_check_body_section(ParsingState const & state)
+    {
+        return cross_record_checker.finish();
+    }
+
+    void ValidateOptionalPolicy::write_state(std::ostream & output, size_t first_line) const
     {
+        cross_record_checker.write_state(output, first_line);
+    }
+
+    void ValidateOptionalPolicy::read_state(std::istream & input, size_t first_line)
+    {
+        cross_record_checker.read_state(input, first_line);
     }
     
     void ValidateOptionalPolicy::check_body_entry_ploidy(ParsingState & state, Record const & record)
@@ -90,27 +202,32 @@ namespace ebi
             size_t ploidy = 0;
             size_t i = 1;
             for (auto &sample : record.samples) {
-                std::vector<std::string> subfields;
-                util::string_split(sample, ":", subfields);
-                std::vector<std::string> alleles;
-                util::string_split(subfields[0], "|/", alleles);
+                if (not state.source->is_sample_validated(i - 1)) {
+                    ++i;
+                    continue;
+                }
+                size_t alleles = count_genotype_alleles(sample);
 
                 if (ploidy > 0) {
-                    if (alleles.size() != ploidy) {
+                    if (alleles != ploidy) {
                         throw new SamplesFieldBodyError{
                                 state.n_lines,
-                                "Sample #" + std::to_string(i) + " has " + std::to_string(alleles.size())
+                                "Sample #" + std::to_string(i) + " has " + std::to_string(alleles)
                                         + " allele(s), but " + std::to_string(ploidy) + " were found in others",
                                 GT,
                                 static_cast<long>(ploidy)};
                     }
                 } else {
-                    ploidy = alleles.size();
+                    ploidy = alleles;
                 }
 
                 ++i;
             }
 
+            if (ploidy == 0) {
+                return; // no sample was validated
+            }
+
             size_t provided_ploidy = state.source->ploidy.get_ploidy(record.chromosome);
             if (provided_ploidy != ploidy) {
                 std::stringstream ss;
@@ -156,11 +273,19 @@ namespace ebi
     {
         if (std::find(record.alternate_alleles.begin(), record.alternate_alleles.end(), GVCF_NON_VARIANT_ALLELE)
             != record.alternate_alleles.end() && record.format[0] == vcf::GT) {
-            for (auto & sample : record.samples) {
-                if (sample_has_reference_in_all_alleles(sample)) {
+            bool any_sample_validated = false;
+            for (size_t i = 0; i < record.samples.size(); ++i) {
+                if (not state.source->is_sample_validated(i)) {
+                    continue;
+                }
+                any_sample_validated = true;
+                if (sample_has_reference_in_all_alleles(record.samples[i])) {
                     return;
                 }
             }
+            if (not any_sample_validated) {
+                return;
+            }
             throw new AlternateAllelesBodyError{state.n_lines,
                     "At least one sample should report a genotype with all reference alleles, when ALT is " + GVCF_NON_VARIANT_ALLELE
                     + " as it is supposed to be a reference region"};
@@ -169,11 +294,11 @@ namespace ebi
 
     bool ValidateOptionalPolicy::sample_has_reference_in_all_alleles(std::string const & sample) const
     {
-        std::string gt_subfield = sample.substr(0, sample.find(':'));
-        std::vector<std::string> alleles;
-        util::string_split(gt_subfield, "/|", alleles);
-        for (auto & allele : alleles) {
-            if (allele != "0") {
+        // read on the text of the sample, as this runs for every sample of every reference block: the genotype must
+        // be empty or like 0/0, and a separator at the end is ignored, like when splitting it
+        size_t gt_end = std::min(sample.find(':'), sample.size());
+        for (size_t i = 0; i < gt_end; i += 2) {
+            if (sample[i] != '0' || (i + 1 < gt_end && sample[i + 1] != '/' && sample[i + 1] != '|')) {
                 return false;
             }
         }
@@ -243,17 +368,9 @@ namespace ebi
     void ValidateOptionalPolicy::check_contig_meta(ParsingState & state, Record const & record) const
     {
         // The associated 'contig' meta entry should exist (notify only once)
-        std::string current_chromosome = record.chromosome;
+        std::string const & current_chromosome = record.chromosome;
 
-        if (state.is_well_defined_meta(CONTIG, current_chromosome)) {
-            return; // Check only once
-        }
-        
-        std::pair<meta_iterator, meta_iterator> range = state.source->meta_entries.equal_range(CONTIG);
-
-        if (is_record_subfield_in_header(current_chromosome, range.first, range.second)) {
-            state.add_well_defined_meta(CONTIG, current_chromosome);
-        } else {
+        if (not is_contig_described(state, current_chromosome)) {
             throw new NoMetaDefinitionError{
                     state.n_lines,
                     "Chromosome/contig '" + current_chromosome + "' is not described in a 'contig' meta description",
@@ -262,22 +379,54 @@ namespace ebi
             };
         }
     }
+
+    bool ValidateOptionalPolicy::is_contig_described(ParsingState & state, std::string const & contig) const
+    {
+        if (state.is_well_defined_meta(CONTIG, contig)) {
+            return true; // Check only once
+        }
+
+        std::pair<meta_iterator, meta_iterator> range = state.source->meta_entries.equal_range(CONTIG);
+        if (is_record_subfield_in_header(contig, range.first, range.second)) {
+            state.add_well_defined_meta(CONTIG, contig);
+            return true;
+        }
+        return false;
+    }
     
+    void ValidateOptionalPolicy::check_contig_reference(ParsingState & state, Record const & record)
+    {
+        // The contig should be in the reference sequence (notify only once)
+        auto & reference = state.source->reference;
+        if (reference == nullptr || not reference_checked_contigs.insert(record.chromosome).second) {
+            return;
+        }
+
+        if (reference->find_contig(record.chromosome) == nullptr) {
+            throw new ChromosomeBodyError{
+                    state.n_lines,
+                    "Chromosome/contig '" + record.chromosome + "' is not in the reference sequence, so its "
+                    "reference alleles were not checked"
+            };
+        }
+    }
+
     void ValidateOptionalPolicy::check_alternate_allele_meta(ParsingState & state, Record const & record) const
     {
         static boost::regex square_brackets_regex("<([a-zA-Z0-9:_]+)>");
-        std::pair<meta_iterator, meta_iterator> range = state.source->meta_entries.equal_range(ALT);
         boost::cmatch pieces_match;
         
         for (auto & alternate : record.alternate_alleles) {
             // Check alternate ID is present in meta-entry (only applies to the form <SOME_ALT_ID>)
-            if (alternate[0] == '<' && boost::regex_match(alternate.c_str(), pieces_match, square_brackets_regex)) {
+            if (alternate[0] == '<' && alternate != GVCF_NON_VARIANT_ALLELE
+                    && boost::regex_match(alternate.c_str(), pieces_match, square_brackets_regex)) {
                 std::string alt_id = pieces_match[1];
                 
                 if (state.is_well_defined_meta(ALT, alt_id)) {
                     continue; // Check only once
                 }
                 
+                std::pair<meta_iterator, meta_iterator> range = state.source->meta_entries.equal_range(ALT);
                 if (is_record_subfield_in_header(alt_id, range.first, range.second)) {
                     state.add_well_defined_meta(ALT, alt_id);
                 } else {
@@ -294,8 +443,6 @@ namespace ebi
     
     void ValidateOptionalPolicy::check_filter_meta(ParsingState & state, Record const & record) const
     {
-        std::pair<meta_iterator, meta_iterator> range = state.source->meta_entries.equal_range(FILTER);
-        
         for (auto & filter : record.filters) {
             if (filter == PASS || filter == MISSING_VALUE) { continue; } // No need to check PASS or missing data
             
@@ -303,6 +450,7 @@ namespace ebi
                 continue; // Check only once
             }
             
+            std::pair<meta_iterator, meta_iterator> range = state.source->meta_entries.equal_range(FILTER);
             if (is_record_subfield_in_header(filter, range.first, range.second)) {
                 state.add_well_defined_meta(FILTER, filter);
             } else {
@@ -318,8 +466,6 @@ namespace ebi
     
     void ValidateOptionalPolicy::check_info_meta(ParsingState & state, Record const & record) const
     {
-        std::pair<meta_iterator, meta_iterator> range = state.source->meta_entries.equal_range(INFO);
-        
         for (auto & field : record.info) {
             auto & id = field.first;
             if (field.first == MISSING_VALUE) { continue; } // No need to check missing data
@@ -328,6 +474,7 @@ namespace ebi
                 continue; // Check only once
             }
             
+            std::pair<meta_iterator, meta_iterator> range = state.source->meta_entries.equal_range(INFO);
             if (is_record_subfield_in_header(id, range.first, range.second)) {
                 state.add_well_defined_meta(INFO, id);
             } else {
@@ -343,13 +490,12 @@ namespace ebi
     
     void ValidateOptionalPolicy::check_format_meta(ParsingState & state, Record const & record) const
     {
-        std::pair<meta_iterator, meta_iterator> range = state.source->meta_entries.equal_range(FORMAT);
-        
         for (auto & fm : record.format) {
             if (state.is_well_defined_meta(FORMAT, fm)) {
                 continue; // Check only once
             }
             
+            std::pair<meta_iterator, meta_iterator> range = state.source->meta_entries.equal_range(FORMAT);
             if (is_record_subfield_in_header(fm, range.first, range.second)) {
                 state.add_well_defined_meta(FORMAT, fm);
             } else {
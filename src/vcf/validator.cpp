@@ -14,50 +14,80 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+#include "vcf/body_line_prefilter.hpp"
+#include "vcf/header_cache.hpp"
 #include "vcf/validator.hpp"
 
 namespace ebi
 {
   namespace vcf
   {
-    Version detect_version(const std::vector<char> &line);
-
-    std::unique_ptr<Parser> build_parser(std::string const &path,
-                                         ValidationLevel level,
-                                         Version version,
-                                         Ploidy ploidy);
-
-    bool validate(const std::vector<char> &firstLine,
-                  std::istream &input,
-                  ebi::vcf::Parser &validator,
-                  std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs);
+    namespace
+    {
+      /**
+       * Version of the Ragel machines in validator_detail_v4x.hpp. Increase it whenever they are generated again:
+       * the saved parser states store the current state of the machine, which means nothing in another machine.
+       */
+      int const grammar_version = 1;
+    }
 
-    void write_errors(const Parser &validator, const std::vector<std::unique_ptr<ReportWriter>> &outputs);
+    std::string grammar_fingerprint(std::string const &machine, std::vector<int> const &states)
+    {
+        std::string fingerprint = machine + " grammar " + std::to_string(grammar_version) + ", states";
+        for (int state : states) {
+            fingerprint += " " + std::to_string(state);
+        }
+        return fingerprint;
+    }
 
     ParserImpl::ParserImpl(std::shared_ptr<Source> source)
-            : ParsingState{source}
+            : ParsingState{source}, well_formed_line_state{-1}
     {
         
     }
 
     void ParserImpl::parse(std::vector<char> const & text)
     {
-        char const * p = &text[0];
-        char const * pe = &text[0] + text.size();
-        char const * eof = nullptr;
-
-        clear();
-        parse_buffer(p, pe, eof);
+        parse(text.data(), text.data() + text.size());
     }
 
     void ParserImpl::parse(std::string const & text)
     {
-        char const * p = text.data();
-        char const * pe = text.data() + text.size();
+        parse(text.data(), text.data() + text.size());
+    }
+
+    void ParserImpl::parse(char const * p, char const * pe)
+    {
         char const * eof = nullptr;
 
         clear();
+        bool prefiltered = static_cast<size_t>(pe - p) >= min_prefiltered_line_length;
+        if (prefiltered && cs == well_formed_line_state && is_well_formed_body_line(p, pe)) {
+            // the parser would only count the line, as in the line_break action
+            ++n_lines;
+            if (n_lines % 10000 == 0) {
+                BOOST_LOG_TRIVIAL(info) << "Lines read: " << n_lines;
+            }
+            return;
+        }
+
         parse_buffer(p, pe, eof);
+
+        if (not record_block.empty()) {
+            // what is found in the lines of a block is reported in order with the checks of its records
+            hold_block_lines();
+            if (record_block.full()) {
+                report_record_block();
+            }
+        }
+
+        if (prefiltered && skips_well_formed_body_lines() && errors().empty() && is_well_formed_body_line(p, pe)) {
+            well_formed_line_state = cs;
+        }
     }
 
     void ParserImpl::end()
@@ -65,6 +95,82 @@ namespace ebi
         char const * empty = "";
         clear();
         parse_buffer(empty, empty, empty);
+
+        if (not record_block.empty()) {
+            hold_block_lines();
+            report_record_block();
+        }
+    }
+
+    void ParserImpl::report_record_block()
+    {
+        check_record_block();
+        record_block.clear();
+        report_block_lines(std::numeric_limits<size_t>::max());
+    }
+
+    void ParserImpl::report_block_lines(size_t line)
+    {
+        auto report_until_line = [line](std::vector<std::unique_ptr<Error>> & found,
+                                        std::vector<std::unique_ptr<Error>> & reported) {
+            auto end = std::find_if(found.begin(), found.end(),
+                                    [line](std::unique_ptr<Error> const & error) { return error->line > line; });
+            std::move(found.begin(), end, std::back_inserter(reported));
+            found.erase(found.begin(), end);
+        };
+        report_until_line(block_errors, ParsingState::errors);
+        report_until_line(block_warnings, ParsingState::warnings);
+    }
+
+    void ParserImpl::hold_block_lines()
+    {
+        std::move(ParsingState::errors.begin(), ParsingState::errors.end(), std::back_inserter(block_errors));
+        std::move(ParsingState::warnings.begin(), ParsingState::warnings.end(), std::back_inserter(block_warnings));
+        ParsingState::errors.clear();
+        ParsingState::warnings.clear();
+    }
+
+    void ParserImpl::clear_previous_records()
+    {
+        previous_records.clear();
+    }
+
+    void ParserImpl::skip(std::vector<char> const & text)
+    {
+        clear();
+        ++n_lines;
+    }
+
+    void ParserImpl::skip_lines(size_t count)
+    {
+        clear();
+        n_lines += count;
+    }
+
+    void ParserImpl::save_header(std::ostream & output) const
+    {
+        write_state(output, grammar());
+    }
+
+    void ParserImpl::restore_header(std::istream & input)
+    {
+        clear();
+        read_state(input, grammar());
+    }
+
+    void ParserImpl::save(std::ostream & output) const
+    {
+        write_state(output, grammar());
+        previous_records.write_state(output);
+        save_policies(output);
+    }
+
+    void ParserImpl::restore(std::istream & input)
+    {
+        clear();
+        read_state(input, grammar());
+        previous_records.read_state(input);
+        restore_policies(input);
     }
 
     bool ParserImpl::is_valid() const
@@ -85,9 +191,14 @@ namespace ebi
     std::unique_ptr<ebi::vcf::Parser> build_parser(std::string const &path,
                                                    ValidationLevel level,
                                                    ebi::vcf::Version version,
-                                                   ebi::vcf::Ploidy ploidy)
+                                                   ebi::vcf::Ploidy ploidy,
+                                                   ValidationOptions const &validationOptions)
     {
         std::shared_ptr<Source> source = std::make_shared<Source>(path, InputFormat::VCF_FILE_VCF, version, ploidy);
+        source->sample_selection = validationOptions.sample_selection;
+        source->collect_all_errors = validationOptions.collect_all_errors;
+        source->reference = validationOptions.reference;
+        source->record_blocks = validationOptions.record_blocks && level == ValidationLevel::warning;
         auto records = std::vector<Record>{};
 
         switch (level) {
@@ -127,30 +238,93 @@ namespace ebi
                 throw std::invalid_argument{"Please choose one of the accepted VCF fileformat versions"};
             }
 
+        case ValidationLevel::count:
+            switch (version) {
+            case ebi::vcf::Version::v41:
+                return std::unique_ptr<ebi::vcf::Parser>(new ebi::vcf::CountingValidator_v41(source));
+            case ebi::vcf::Version::v42:
+                return std::unique_ptr<ebi::vcf::Parser>(new ebi::vcf::CountingValidator_v42(source));
+            case ebi::vcf::Version::v43:
+                return std::unique_ptr<ebi::vcf::Parser>(new ebi::vcf::CountingValidator_v43(source));
+            default:
+                throw std::invalid_argument{"Please choose one of the accepted VCF fileformat versions"};
+            }
+
         default:
             throw std::invalid_argument{"Please choose one of the accepted validation levels"};
         }
     }
 
-    bool is_valid_vcf_file(std::istream &input,
-                           const std::string &sourceName,
-                           ValidationLevel validationLevel,
-                           Ploidy ploidy,
-                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs)
+    std::unique_ptr<Parser> build_input_parser(std::vector<char> &line,
+                                               std::istream &input,
+                                               const std::string &sourceName,
+                                               ValidationLevel validationLevel,
+                                               Ploidy ploidy,
+                                               std::vector<std::unique_ptr<ReportWriter>> &outputs,
+                                               ValidationOptions const &validationOptions)
     {
-        std::vector<char> line;
+        line.reserve(default_line_buffer_size);
         ebi::util::readline(input, line);
-        ebi::vcf::Version version;
+        Version version;
         try {
             version = detect_version(line);
         } catch (FileformatError * error) {
             for (auto &output : outputs) {
                 output->write_error(*error);
             }
+            delete error;
+            return nullptr;
+        }
+        return build_parser(sourceName, validationLevel, version, ploidy, validationOptions);
+    }
+
+    std::unique_ptr<Parser> validate_up_to_body(std::vector<char> &line,
+                                                std::istream &input,
+                                                const std::string &sourceName,
+                                                ValidationLevel validationLevel,
+                                                Ploidy ploidy,
+                                                std::vector<std::unique_ptr<ReportWriter>> &outputs,
+                                                ValidationOptions const &validationOptions,
+                                                size_t *header_lines)
+    {
+        std::unique_ptr<Parser> validator = build_input_parser(line, input, sourceName, validationLevel, ploidy,
+                                                               outputs, validationOptions);
+        if (validator != nullptr) {
+            size_t lines = validate_header(line, input, *validator, outputs, validationOptions.header_cache);
+            if (header_lines != nullptr) {
+                *header_lines = lines;
+            }
+        }
+        return validator;
+    }
+
+    bool is_valid_vcf_file(std::istream &input,
+                           const std::string &sourceName,
+                           ValidationLevel validationLevel,
+                           Ploidy ploidy,
+                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                           ValidationOptions const &validationOptions)
+    {
+        std::vector<char> line;
+        std::unique_ptr<Parser> validator = validate_up_to_body(line, input, sourceName, validationLevel, ploidy,
+                                                                outputs, validationOptions);
+        if (validator == nullptr) {
             return false;
         }
-        std::unique_ptr<Parser> validator = build_parser(sourceName, validationLevel, version, ploidy);
-        return validate(line, input, *validator, outputs);
+
+        ReportFlusher flusher;
+        while (line.size() != 0) {
+            validator->parse(line);
+            write_errors(*validator, outputs);
+            flusher.line_validated(outputs);
+            ebi::util::readline(input, line);
+        }
+
+        validator->end();
+        write_errors(*validator, outputs);
+        write_error_counts(*validator, outputs);
+
+        return validator->is_valid();
     }
 
     Version detect_version(const std::vector<char> &vector_line)
@@ -174,40 +348,55 @@ namespace ebi
                     + common_substring + " and the value must be one of 'VCFv4.1', 'VCFv4.2' or 'VCFv4.3')"};
     }
 
-    bool validate(const std::vector<char> &firstLine,
-                  std::istream &input,
-                  ebi::vcf::Parser &validator,
-                  std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs)
+    size_t validate_header(std::vector<char> &line,
+                           std::istream &input,
+                           Parser &validator,
+                           std::vector<std::unique_ptr<ReportWriter>> &outputs,
+                           HeaderCache *headerCache)
     {
-        std::vector<char> line;
-        line.reserve(default_line_buffer_size);
-
-        validator.parse(firstLine);
-        write_errors(validator, outputs);
+        if (headerCache != nullptr) {
+            return headerCache->validate_header(line, input, validator, outputs);
+        }
 
-        while (ebi::util::readline(input, line).size() != 0) {
+        size_t lines = 0;
+        do {
             validator.parse(line);
             write_errors(validator, outputs);
-        }
-
-        validator.end();
-        write_errors(validator, outputs);
-
-        return validator.is_valid();
+            ++lines;
+        } while (ebi::util::readline(input, line).size() != 0 && line[0] == '#');
+        return lines;
     }
 
     void write_errors(const Parser &validator, const std::vector<std::unique_ptr<ReportWriter>> &outputs)
     {
-        for (auto &error : validator.errors()) {
+        if (not validator.errors().empty()) {
             for (auto &output : outputs) {
-                output->write_error(*error);
+                output->write_batch(validator.errors(), Severity::ERROR);
             }
         }
-        for (auto &error : validator.warnings()) {
+        if (not validator.warnings().empty()) {
             for (auto &output : outputs) {
-                output->write_warning(*error);
+                output->write_batch(validator.warnings(), Severity::WARNING);
             }
         }
     }
+
+    void write_error_counts(const Parser &validator, const std::vector<std::unique_ptr<ReportWriter>> &outputs)
+    {
+        ErrorCounts const & counts = validator.error_counts();
+        auto write_counts = [&outputs](std::vector<size_t> const & class_counts, std::string const & kind) {
+            for (size_t error_class = 0; error_class < class_counts.size(); ++error_class) {
+                if (class_counts[error_class] > 0) {
+                    std::string message = kind + " of type " + ErrorClassifier::names()[error_class] + ": "
+                                          + std::to_string(class_counts[error_class]);
+                    for (auto &output : outputs) {
+                        output->write_message(message);
+                    }
+                }
+            }
+        };
+        write_counts(counts.errors, "Errors");
+        write_counts(counts.warnings, "Warnings");
+    }
   }
 }
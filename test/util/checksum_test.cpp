@@ -0,0 +1,64 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <string>
+
+#include "catch/catch.hpp"
+
+#include "util/checksum.hpp"
+
+namespace ebi
+{
+  namespace
+  {
+    std::string digest(std::string const & algorithm, std::string const & content, size_t chunk_size)
+    {
+        auto checksum = util::make_checksum(algorithm);
+        for (size_t i = 0; i < content.size(); i += chunk_size) {
+            checksum->update(content.data() + i, std::min(chunk_size, content.size() - i));
+        }
+        return checksum->hex_digest();
+    }
+  }
+
+  TEST_CASE("MD5 checksum", "[checksum]")
+  {
+      CHECK(digest(util::MD5, "", 1) == "d41d8cd98f00b204e9800998ecf8427e");
+      CHECK(digest(util::MD5, "abc", 1) == "900150983cd24fb0d6963f7d28e17f72");
+
+      std::string long_content = "12345678901234567890123456789012345678901234567890123456789012345678901234567890";
+      CHECK(digest(util::MD5, long_content, long_content.size()) == "57edf4a22be3c955ac49da2e2107b67a");
+      CHECK(digest(util::MD5, long_content, 7) == "57edf4a22be3c955ac49da2e2107b67a");
+  }
+
+  TEST_CASE("SHA-256 checksum", "[checksum]")
+  {
+      CHECK(digest(util::SHA256, "", 1) == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+      CHECK(digest(util::SHA256, "abc", 1) == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+
+      std::string long_content = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+      CHECK(digest(util::SHA256, long_content, long_content.size())
+            == "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+      CHECK(digest(util::SHA256, long_content, 5)
+            == "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+  }
+
+  TEST_CASE("Unsupported checksum", "[checksum]")
+  {
+      CHECK_THROWS_AS(util::make_checksum("crc32"), std::invalid_argument);
+  }
+}
@@ -0,0 +1,68 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "catch/catch.hpp"
+
+#include "util/follow_streambuf.hpp"
+#include "util/stream_utils.hpp"
+
+namespace ebi
+{
+  TEST_CASE("FollowStreambuf waits for the file to grow", "[follow]")
+  {
+      auto path = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path()).string();
+      std::string first_part = "##fileformat=VCFv4.1\n#CHROM\tPOS\n1\t1";
+      std::string second_part = "00\n1\t200\n";
+
+      std::ofstream producer{path};
+      producer << first_part << std::flush;
+
+      std::atomic<bool> done{false};
+      std::thread writer{[&]() {
+          std::this_thread::sleep_for(std::chrono::milliseconds{100});
+          producer << second_part << std::flush;
+          done = true;
+      }};
+
+      // a small buffer and poll interval force several reads and waits
+      size_t waits = 0;
+      util::FollowStreambuf follow{path, [&]() { return done.load(); }, std::chrono::milliseconds{10}, 7,
+                                   [&waits]() { ++waits; }};
+      std::istream input{&follow};
+
+      std::vector<char> line;
+      std::vector<std::string> lines;
+      while (util::readline(input, line).size() != 0) {
+          lines.emplace_back(line.begin(), line.end());
+      }
+      writer.join();
+
+      // the line split between both writes is read complete
+      CHECK(lines == (std::vector<std::string>{"##fileformat=VCFv4.1\n", "#CHROM\tPOS\n", "1\t100\n", "1\t200\n"}));
+      CHECK(waits > 0);
+
+      boost::filesystem::remove(path);
+  }
+}
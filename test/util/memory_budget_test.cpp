@@ -0,0 +1,59 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+
+#include "catch/catch.hpp"
+
+#include "util/memory_budget.hpp"
+
+namespace ebi
+{
+  TEST_CASE("Memory budget", "[memory_budget]")
+  {
+      SECTION("Reservations within the limit")
+      {
+          util::MemoryBudget budget;
+          budget.set_limit(100);
+          CHECK(budget.reserve(60));
+          CHECK_FALSE(budget.reserve(50));
+          CHECK(budget.get_used() == 60);
+          budget.release(20);
+          CHECK(budget.reserve(50));
+          CHECK(budget.get_used() == 90);
+          CHECK(budget.get_peak() == 90);
+          budget.release(90);
+          CHECK(budget.get_used() == 0);
+          CHECK(budget.get_peak() == 90);
+      }
+
+      SECTION("Without a limit everything is accounted")
+      {
+          util::MemoryBudget budget;
+          CHECK(budget.reserve(1000000));
+          CHECK(budget.get_used() == 1000000);
+      }
+
+      SECTION("Repeated notes are kept once")
+      {
+          util::MemoryBudget budget;
+          budget.add_note("first");
+          budget.add_note("second");
+          budget.add_note("first");
+          CHECK((budget.get_notes() == std::vector<std::string>{"first", "second"}));
+      }
+  }
+}
@@ -0,0 +1,60 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "util/stream_utils.hpp"
+#include "util/tee_streambuf.hpp"
+
+namespace ebi
+{
+  TEST_CASE("TeeStreambuf forwards every byte read", "[tee]")
+  {
+      std::string content = "##fileformat=VCFv4.1\n#CHROM\tPOS\n1\t100\n1\t200";
+      std::stringstream source{content};
+      std::string forwarded;
+
+      // a small buffer forces several reads from the source
+      util::TeeStreambuf tee{*source.rdbuf(), 7};
+      tee.add_sink([&](char const * data, size_t size) { forwarded.append(data, size); });
+      std::istream input{&tee};
+
+      SECTION("Reading line by line")
+      {
+          std::vector<char> line;
+          std::string read;
+          while (util::readline(input, line).size() != 0) {
+              read.append(line.begin(), line.end());
+          }
+          CHECK(read == content);
+          CHECK(forwarded == content);
+      }
+
+      SECTION("Stopping early and draining the rest")
+      {
+          std::vector<char> line;
+          util::readline(input, line);
+          CHECK(std::string(line.begin(), line.end()) == "##fileformat=VCFv4.1\n");
+
+          tee.drain();
+          CHECK(forwarded == content);
+      }
+  }
+}
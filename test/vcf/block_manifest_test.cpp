@@ -0,0 +1,250 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "catch/catch.hpp"
+
+#include "vcf/block_manifest.hpp"
+#include "test_utils.hpp"
+
+namespace ebi
+{
+  std::string block_manifest_records(size_t first_position, size_t records, std::string const &chromosome = "1")
+  {
+      std::string body;
+      for (size_t position = first_position; position < first_position + records; ++position) {
+          // some records with a wrong INFO value and some without ALT, to have errors and warnings in every block
+          std::string alternate = position % 500 == 0 ? "." : "C";
+          std::string info = position % 700 == 0 ? "DP=x" : "DP=" + std::to_string(position % 50);
+          body += chromosome + "\t" + std::to_string(position) + "\t.\tA\t" + alternate + "\t.\t.\t" + info + "\n";
+      }
+      return body;
+  }
+
+  struct BlockValidation
+  {
+      bool is_valid;
+      std::vector<size_t> errors;
+      std::vector<size_t> warnings;
+      std::string message;
+  };
+
+  BlockValidation validate_blocks(std::string const &content, vcf::BlockManifest &manifest,
+                                  vcf::BlockManifest const *previous, std::string const &settings = "")
+  {
+      std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+      outputs.emplace_back(new MemoryReportWriter{});
+      auto & report = static_cast<MemoryReportWriter &>(*outputs[0]);
+      std::stringstream input{content};
+      bool is_valid = vcf::is_valid_vcf_file_blocks(input, "blocks.vcf", vcf::ValidationLevel::warning,
+                                                    vcf::Ploidy{2}, outputs, settings, manifest, previous);
+      return {is_valid, report.errors, report.warnings, report.messages.empty() ? "" : report.messages.back()};
+  }
+
+  TEST_CASE("Validate again only the blocks that changed", "[block_manifest]")
+  {
+      std::string header{"##fileformat=VCFv4.1\n"
+                         "##contig=<ID=1>\n"
+                         "##INFO=<ID=DP,Number=1,Type=Integer,Description=\"Depth\">\n"
+                         "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n"};
+      std::string first_part = block_manifest_records(1, 6000);
+      std::string second_part = block_manifest_records(6001, 6000);
+
+      vcf::BlockManifest previous;
+      BlockValidation first = validate_blocks(header + first_part + second_part, previous, nullptr);
+      CHECK_FALSE(first.is_valid);
+      REQUIRE(previous.blocks.size() > 3);
+      CHECK(previous.blocks.front().first_line == 5);
+      CHECK_FALSE(first.errors.empty());
+      CHECK_FALSE(first.warnings.empty());
+
+      SECTION("The manifest can be written and read")
+      {
+          auto path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+          vcf::write_block_manifest(path.string(), previous);
+          vcf::BlockManifest read = vcf::read_block_manifest(path.string());
+          boost::filesystem::remove(path);
+
+          CHECK(read.key == previous.key);
+          REQUIRE(read.blocks.size() == previous.blocks.size());
+          for (size_t i = 0; i < read.blocks.size(); ++i) {
+              CHECK(read.blocks[i].hash == previous.blocks[i].hash);
+              CHECK(read.blocks[i].first_line == previous.blocks[i].first_line);
+              CHECK(read.blocks[i].lines == previous.blocks[i].lines);
+              CHECK(read.blocks[i].errors == previous.blocks[i].errors);
+              CHECK(read.blocks[i].warnings == previous.blocks[i].warnings);
+          }
+
+          CHECK_THROWS_AS(vcf::read_block_manifest((path / "missing").string()), std::runtime_error);
+      }
+
+      SECTION("An unchanged file reuses every block")
+      {
+          vcf::BlockManifest manifest;
+          BlockValidation again = validate_blocks(header + first_part + second_part, manifest, &previous);
+          CHECK_FALSE(again.is_valid);
+          CHECK(again.errors == first.errors);
+          CHECK(again.warnings == first.warnings);
+          CHECK(again.message == "Validated 0 blocks of lines, the results of " + std::to_string(previous.blocks.size())
+                                 + " unchanged blocks were reused from the previous manifest");
+      }
+
+      SECTION("Inserted lines only validate their block and the ones after it")
+      {
+          // a duplicate at the start of the second part, and a new line that moves the next ones
+          std::string changed = header + first_part + "1\t6000\t.\tA\tC\t.\t.\tDP=1\n" + second_part;
+
+          vcf::BlockManifest full_manifest;
+          BlockValidation full = validate_blocks(changed, full_manifest, nullptr);
+
+          vcf::BlockManifest manifest;
+          BlockValidation delta = validate_blocks(changed, manifest, &previous);
+          CHECK(delta.is_valid == full.is_valid);
+          CHECK(delta.errors == full.errors);
+          CHECK(delta.warnings == full.warnings);
+          CHECK(delta.message.find("Validated " + std::to_string(manifest.blocks.size())) == std::string::npos);
+
+          REQUIRE(manifest.blocks.size() == full_manifest.blocks.size());
+          for (size_t i = 0; i < manifest.blocks.size(); ++i) {
+              CHECK(manifest.blocks[i].hash == full_manifest.blocks[i].hash);
+              CHECK(manifest.blocks[i].errors == full_manifest.blocks[i].errors);
+          }
+      }
+
+      SECTION("A manifest of other settings is not reused")
+      {
+          vcf::BlockManifest manifest;
+          BlockValidation other = validate_blocks(header + first_part + second_part, manifest, &previous, "ploidy=1");
+          CHECK(other.errors == first.errors);
+          CHECK(other.message == "The previous manifest was written for another header or other settings, all the "
+                                 "blocks will be validated");
+      }
+  }
+
+  TEST_CASE("Validate the blocks after a change of the contigs read before them", "[block_manifest]")
+  {
+      std::string header{"##fileformat=VCFv4.1\n"
+                         "##contig=<ID=1>\n"
+                         "##contig=<ID=2>\n"
+                         "##contig=<ID=3>\n"
+                         "##INFO=<ID=DP,Number=1,Type=Integer,Description=\"Depth\">\n"
+                         "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n"};
+      // contig 3 is read in the first blocks, so it is not contiguous when it starts again many blocks later
+      std::string without_contig = header + block_manifest_records(1, 6000) + block_manifest_records(1, 6000, "2")
+                                   + block_manifest_records(1, 6000, "3");
+      std::string with_contig = header + block_manifest_records(1, 2000) + block_manifest_records(1, 1, "3")
+                                + block_manifest_records(2001, 4000) + block_manifest_records(1, 6000, "2")
+                                + block_manifest_records(1, 6000, "3");
+
+      auto check_delta = [](std::string const &before, std::string const &after) {
+          vcf::BlockManifest previous;
+          validate_blocks(before, previous, nullptr);
+
+          vcf::BlockManifest full_manifest;
+          BlockValidation full = validate_blocks(after, full_manifest, nullptr);
+
+          vcf::BlockManifest manifest;
+          BlockValidation delta = validate_blocks(after, manifest, &previous);
+          CHECK(delta.is_valid == full.is_valid);
+          CHECK(delta.errors == full.errors);
+          CHECK(delta.warnings == full.warnings);
+          REQUIRE(manifest.blocks.size() == full_manifest.blocks.size());
+          for (size_t i = 0; i < manifest.blocks.size(); ++i) {
+              CHECK(manifest.blocks[i].errors == full_manifest.blocks[i].errors);
+              CHECK(manifest.blocks[i].sorting_state == full_manifest.blocks[i].sorting_state);
+          }
+          return full.errors;
+      };
+
+      SECTION("A contig added in a changed block")
+      {
+          auto errors = check_delta(without_contig, with_contig);
+          CHECK(std::find(errors.begin(), errors.end(), 6 + 2000 + 1 + 4000 + 6000 + 1) != errors.end());
+      }
+
+      SECTION("A contig removed from a changed block")
+      {
+          auto errors = check_delta(with_contig, without_contig);
+          CHECK(std::find(errors.begin(), errors.end(), 6 + 12000 + 1) == errors.end());
+      }
+  }
+
+  TEST_CASE("Validate the blocks after a change of the breakend mates expected before them", "[block_manifest]")
+  {
+      std::string header{"##fileformat=VCFv4.1\n"
+                         "##contig=<ID=1>\n"
+                         "##INFO=<ID=DP,Number=1,Type=Integer,Description=\"Depth\">\n"
+                         "##INFO=<ID=MATEID,Number=.,Type=String,Description=\"ID of mate breakends\">\n"
+                         "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n"};
+      // the mate expected by the breakend in the first block is missing, which is only known many blocks later
+      std::string breakend{"1\t10\tbnd_a\tA\tA[1:11000[\t.\t.\tMATEID=bnd_b\n"};
+      size_t breakend_line = 5 + 10;
+      std::string with_breakend = header + block_manifest_records(1, 9) + breakend + block_manifest_records(11, 11990);
+      std::string without_breakend = header + block_manifest_records(1, 12000);
+
+      auto check_delta = [](std::string const &before, std::string const &after) {
+          vcf::BlockManifest previous;
+          validate_blocks(before, previous, nullptr);
+
+          vcf::BlockManifest full_manifest;
+          BlockValidation full = validate_blocks(after, full_manifest, nullptr);
+
+          vcf::BlockManifest manifest;
+          BlockValidation delta = validate_blocks(after, manifest, &previous);
+          CHECK(delta.is_valid == full.is_valid);
+          CHECK(delta.errors == full.errors);
+          CHECK(delta.warnings == full.warnings);
+          REQUIRE(manifest.blocks.size() == full_manifest.blocks.size());
+          for (size_t i = 0; i < manifest.blocks.size(); ++i) {
+              CHECK(manifest.blocks[i].warnings == full_manifest.blocks[i].warnings);
+              CHECK(manifest.blocks[i].record_checks_state == full_manifest.blocks[i].record_checks_state);
+          }
+          return full.warnings;
+      };
+
+      SECTION("A breakend removed from a changed block is not reported by the unchanged ones")
+      {
+          auto warnings = check_delta(with_breakend, without_breakend);
+          CHECK(std::find(warnings.begin(), warnings.end(), breakend_line) == warnings.end());
+      }
+
+      SECTION("A breakend added in a changed block is reported by the unchanged ones")
+      {
+          auto warnings = check_delta(without_breakend, with_breakend);
+          CHECK(std::find(warnings.begin(), warnings.end(), breakend_line) != warnings.end());
+      }
+
+      SECTION("A block changed after the breakend is validated still expecting its mate")
+      {
+          std::string changed = header + block_manifest_records(1, 9) + breakend + block_manifest_records(11, 7989)
+                                + "1\t8000\t.\tA\tG\t.\t.\tDP=1\n" + block_manifest_records(8001, 4000);
+
+          vcf::BlockManifest previous;
+          validate_blocks(with_breakend, previous, nullptr);
+          REQUIRE(previous.blocks.size() > 2);
+          REQUIRE(previous.blocks[2].first_line <= 5 + 8000);
+
+          auto warnings = check_delta(with_breakend, changed);
+          CHECK(std::find(warnings.begin(), warnings.end(), breakend_line) != warnings.end());
+      }
+  }
+}
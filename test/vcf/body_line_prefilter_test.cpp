@@ -0,0 +1,245 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "catch/catch.hpp"
+
+#include "util/stream_utils.hpp"
+#include "vcf/body_line_prefilter.hpp"
+#include "vcf/validator.hpp"
+
+namespace ebi
+{
+  bool is_well_formed(std::string const &line)
+  {
+      return vcf::is_well_formed_body_line(line.data(), line.data() + line.size());
+  }
+
+  /**
+   * Builds a quick validator for the version declared in the first line, or returns null if it's not valid
+   */
+  std::unique_ptr<vcf::Parser> build_quick_validator(std::vector<char> const &first_line)
+  {
+      try {
+          return vcf::build_parser("test.vcf", vcf::ValidationLevel::error, vcf::detect_version(first_line),
+                                   vcf::Ploidy{2});
+      } catch (vcf::FileformatError *error) {
+          delete error;
+          return nullptr;
+      }
+  }
+
+  /**
+   * Errors of the quick validation of a file, as line and message
+   */
+  std::vector<std::pair<size_t, std::string>> quick_errors(std::istream &input, bool line_by_line)
+  {
+      std::vector<char> line;
+      auto validator = build_quick_validator(util::readline(input, line));
+      std::vector<std::pair<size_t, std::string>> errors;
+      if (validator == nullptr) {
+          return errors;
+      }
+
+      auto keep_errors = [&]() {
+          for (auto &error : validator->errors()) {
+              errors.emplace_back(error->line, error->message);
+          }
+      };
+
+      if (line_by_line) {
+          do {
+              validator->parse(line);
+              keep_errors();
+          } while (util::readline(input, line).size() != 0);
+      } else {
+          // a text of several lines is never skipped
+          std::stringstream content;
+          content << std::string{line.begin(), line.end()} << input.rdbuf();
+          validator->parse(content.str());
+          keep_errors();
+      }
+      validator->end();
+      keep_errors();
+      return errors;
+  }
+
+  std::vector<std::pair<size_t, std::string>> quick_errors(std::string const &path, bool line_by_line)
+  {
+      std::ifstream input{path};
+      return quick_errors(input, line_by_line);
+  }
+
+  TEST_CASE("Prefilter of body lines", "[body_line_prefilter]")
+  {
+      SECTION("Common shapes are accepted")
+      {
+          CHECK(is_well_formed("1\t100\t.\tA\tC\t.\t.\t.\n"));
+          CHECK(is_well_formed("chr1\t100\trs1;rs2\tACG\tA,TTT\t29.5\tPASS\tDP=10;AF=0.5,0.1;DB\n"));
+          CHECK(is_well_formed("1\t100\t.\tA\tC\t10\tq10;s50\t.\tGT:DP\t0|1:12\t./.:.\t1/1\n"));
+      }
+
+      SECTION("Other lines are left to the parser")
+      {
+          CHECK_FALSE(is_well_formed("1\t100\t.\tA\tC\t.\t.\t.")); // no end of line
+          CHECK_FALSE(is_well_formed("1\t100\t.\tA\tC\t.\t.\t.\r\n"));
+          CHECK_FALSE(is_well_formed("1\t100\t.\tA\tC\t.\t.\n"));
+          CHECK_FALSE(is_well_formed("1\t100\t.\tA\tC\t.\t.\t.\tGT\n"));
+          CHECK_FALSE(is_well_formed("1\t1e2\t.\tA\tC\t.\t.\t.\n"));
+          CHECK_FALSE(is_well_formed("1\t100\t.\tA\t<DEL>\t.\t.\t.\n"));
+          CHECK_FALSE(is_well_formed("1\t100\t.\tA\tC,\t.\t.\t.\n"));
+          CHECK_FALSE(is_well_formed("1\t100\t.\tA\tC\t1e5\t.\t.\n"));
+          CHECK_FALSE(is_well_formed("1\t100\t.\tA\tC\t.\t.\tDP=;AF=1\n"));
+          CHECK_FALSE(is_well_formed("1\t100\t.\tA\tC\t.\t.\tDP=1;\n"));
+          CHECK_FALSE(is_well_formed("1\t100\t.\tA\tC\t.\t.\tDP=\n"));
+          CHECK_FALSE(is_well_formed("1\t100\t.\tA\tC\t.\t.\tDP=,1\n"));
+          CHECK_FALSE(is_well_formed("1\t100\t.\tA\tC\t.\t.\tDP=1,,2\n"));
+          CHECK_FALSE(is_well_formed("1\t100\t.\tA\tC\t.\t.\tDP=1,\n"));
+          CHECK_FALSE(is_well_formed("1\t100\t.\tA\tC\t.\t.\t1000G\n"));
+          CHECK_FALSE(is_well_formed("1\t100\t.\tA\tC\t.\t.\t.\tGT:\t0/1\n"));
+          CHECK_FALSE(is_well_formed("1\t100\t.\tA\tC\t.\t.\t.\tGT\t0/1:\n"));
+          CHECK_FALSE(is_well_formed("1\t100\t.\tA\tC\t.\t.\t.\tGT\t\n"));
+          CHECK_FALSE(is_well_formed("1\t100\t.\tA\tC\t.\t.\t.\n1\t200\t.\tA\tC\t.\t.\t.\n"));
+      }
+
+      SECTION("Empty or wrong values are found anywhere in the samples")
+      {
+          std::string const fixed_columns = "1\t100\t.\tA\tC\t.\t.\t.\tGT:DP\t";
+          std::string const samples = "0|1:12\t1|1:7\t0/0:30\t./.:.\t0|1:12\t1|1:7\t0/0:30";
+          CHECK(is_well_formed(fixed_columns + samples + "\n"));
+          for (size_t i = 0; i < samples.size(); ++i) {
+              std::string text = samples;
+              text[i] = ' ';
+              INFO(text);
+              CHECK_FALSE(is_well_formed(fixed_columns + text + "\n"));
+              if (text[i + 1] == ':' || text[i + 1] == '\t') {
+                  text[i] = samples[i + 1] == ':' ? '\t' : ':';
+                  CHECK_FALSE(is_well_formed(fixed_columns + text + "\n"));
+              }
+          }
+      }
+
+      SECTION("The accepted lines of the test files are accepted by the parser")
+      {
+          for (std::string version : {"v4.1", "v4.2", "v4.3"}) {
+              for (std::string result : {"passed", "failed"}) {
+                  boost::filesystem::path folder{"test/input_files/" + version + "/" + result};
+                  for (auto it = boost::filesystem::directory_iterator{folder};
+                       it != boost::filesystem::directory_iterator{}; ++it) {
+                      std::ifstream input{it->path().string()};
+                      std::vector<char> first_line;
+                      util::readline(input, first_line);
+
+                      std::vector<char> line;
+                      while (util::readline(input, line).size() != 0) {
+                          if (not vcf::is_well_formed_body_line(line.data(), line.data() + line.size())) {
+                              continue;
+                          }
+                          // parsed right after the header, the line can't be skipped
+                          auto validator = build_quick_validator(first_line);
+                          if (validator == nullptr) {
+                              break;
+                          }
+                          validator->parse(first_line);
+                          validator->parse(std::string{"#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\tFORMAT\tS1\n"});
+                          validator->parse(line);
+                          std::string text(line.begin(), line.end());
+                          INFO(it->path().string() + ": " + text);
+                          CHECK(validator->errors().empty());
+                      }
+                  }
+              }
+          }
+      }
+
+      SECTION("The reported errors are the same as without skipping lines")
+      {
+          for (std::string version : {"v4.1", "v4.2", "v4.3"}) {
+              for (std::string result : {"passed", "failed"}) {
+                  boost::filesystem::path folder{"test/input_files/" + version + "/" + result};
+                  for (auto it = boost::filesystem::directory_iterator{folder};
+                       it != boost::filesystem::directory_iterator{}; ++it) {
+                      INFO(it->path().string());
+                      CHECK(quick_errors(it->path().string(), true) == quick_errors(it->path().string(), false));
+                  }
+              }
+          }
+
+          // the test files have short lines, that are always parsed
+          std::string samples;
+          for (size_t i = 0; i < 100; ++i) {
+              samples += "\t0|1:12";
+          }
+          std::string const header = "##fileformat=VCFv4.1\n#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\tFORMAT";
+          std::string header_samples;
+          for (size_t i = 0; i < 100; ++i) {
+              header_samples += "\tS" + std::to_string(i);
+          }
+          std::stringstream body;
+          body << header << header_samples << "\n";
+          for (size_t position = 1; position <= 20; ++position) {
+              body << "1\t" << position << "\t.\tA\tC\t.\t.\t.\tGT:DP" << samples << "\n";
+              if (position == 5) {
+                  body << "1\t" << position << "\t.\tA\tC\t.\t.\t.\tGT:DP" << samples << "\t\n";
+              }
+              if (position == 10) {
+                  body << "1\t" << position << "\t.\tA\tC\t.\tPASS\t.\tGT:DP" << samples << "\n";
+              }
+          }
+          std::stringstream body_copy{body.str()};
+          auto errors = quick_errors(body, true);
+          CHECK(errors.size() == 1);
+          CHECK(errors == quick_errors(body_copy, false));
+      }
+
+      SECTION("Long lines with empty INFO values are not skipped")
+      {
+          std::string samples;
+          std::string header_samples;
+          for (size_t i = 0; i < 100; ++i) {
+              samples += "\t0|1:12";
+              header_samples += "\tS" + std::to_string(i);
+          }
+          std::stringstream body;
+          body << "##fileformat=VCFv4.1\n#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\tFORMAT" << header_samples << "\n";
+          size_t position = 1;
+          for (std::string info : {"DP=", "DP=,1", "DP=1,,2", "DP=1,"}) {
+              body << "1\t" << position++ << "\t.\tA\tC\t.\t.\tDP=1,2\tGT:DP" << samples << "\n";
+              std::string line = "1\t" + std::to_string(position++) + "\t.\tA\tC\t.\t.\t" + info + "\tGT:DP" + samples;
+              REQUIRE(line.size() >= 256);
+              body << line << "\n";
+          }
+          std::stringstream body_copy{body.str()};
+          auto errors = quick_errors(body, true);
+          std::set<size_t> error_lines;
+          for (auto &error : errors) {
+              error_lines.insert(error.first);
+          }
+          // the grammar only rejects the empty value; the other lines must get the same errors with and without skipping
+          CHECK(error_lines == (std::set<size_t>{4}));
+          CHECK(errors == quick_errors(body_copy, false));
+      }
+  }
+}
@@ -0,0 +1,248 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "catch/catch.hpp"
+
+#include "util/stream_utils.hpp"
+#include "vcf/checkpoint.hpp"
+#include "vcf/summary_report_writer.hpp"
+
+namespace ebi
+{
+  std::string read_file(boost::filesystem::path const & path)
+  {
+      std::ifstream file{path.string()};
+      std::stringstream content;
+      content << file.rdbuf();
+      return content.str();
+  }
+
+  TEST_CASE("Resume a validation from a checkpoint", "[checkpoint]")
+  {
+      auto directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+      boost::filesystem::create_directory(directory);
+      auto checkpoint_path = (directory / "validation.checkpoint").string();
+
+      std::string header{"##fileformat=VCFv4.1\n"
+                         "##reference=ref.fasta\n"
+                         "##contig=<ID=1>\n"
+                         "##INFO=<ID=DP,Number=1,Type=Integer,Description=\"Depth\">\n"
+                         "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n"};
+      std::string first_half{"1\t100\t.\tA\tC\t.\t.\tDP=x\n"
+                             "1\t200\t.\tA\tC\t.\t.\tDP=5\n"};
+      std::string second_half{"1\t200\t.\tA\tC\t.\t.\tDP=5\n"
+                              "1\t300\t.\tA\tC\t.\t.\tDP=y\n"};
+      std::string content = header + first_half + second_half;
+
+      vcf::CheckpointOptions options{checkpoint_path, 1024, "ploidy=2"};
+
+      // uninterrupted validation
+      auto expected_report = directory / "expected.txt";
+      bool expected_validity;
+      {
+          std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+          outputs.emplace_back(new vcf::SummaryReportWriter{expected_report.string()});
+          std::stringstream input{content};
+          expected_validity = vcf::is_valid_vcf_file_checkpointed(input, "checkpoint.vcf", vcf::ValidationLevel::warning,
+                                                                  vcf::Ploidy{2}, outputs, options);
+      }
+      CHECK_FALSE(expected_validity);
+      CHECK_FALSE(boost::filesystem::exists(checkpoint_path));
+
+      // validation interrupted after the first half, one line after its last checkpoint
+      auto resumed_report = directory / "resumed.txt";
+      {
+          std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+          outputs.emplace_back(new vcf::SummaryReportWriter{resumed_report.string()});
+          std::stringstream input{content};
+          std::vector<char> line;
+          util::readline(input, line);
+          auto validator = vcf::build_parser("checkpoint.vcf", vcf::ValidationLevel::warning, vcf::detect_version(line),
+                                             vcf::Ploidy{2});
+          vcf::validate_header(line, input, *validator, outputs);
+          for (size_t i = 0; i < 2; ++i) {
+              validator->parse(line);
+              vcf::write_errors(*validator, outputs);
+              util::readline(input, line);
+          }
+          std::streamoff offset = (header + first_half).size();
+          vcf::write_checkpoint(options, offset, vcf::input_digest(input, offset), *validator, outputs);
+
+          validator->parse(line);
+          vcf::write_errors(*validator, outputs);
+      }
+
+      vcf::Checkpoint checkpoint = vcf::read_checkpoint(checkpoint_path);
+      CHECK(checkpoint.input_offset == static_cast<std::streamoff>((header + first_half).size()));
+      {
+          auto outputs = vcf::resume_outputs(checkpoint);
+          std::stringstream input{content};
+          bool validity = vcf::is_valid_vcf_file_checkpointed(input, "checkpoint.vcf", vcf::ValidationLevel::warning,
+                                                              vcf::Ploidy{2}, outputs, options, &checkpoint);
+          CHECK(validity == expected_validity);
+      }
+
+      // the duplicate of a record before the checkpoint is found, and nothing is reported twice
+      CHECK(read_file(resumed_report) == read_file(expected_report));
+      CHECK(read_file(resumed_report).find("Duplicated") != std::string::npos);
+      CHECK_FALSE(boost::filesystem::exists(checkpoint_path));
+
+      SECTION("The checkpoint is only valid for the same kind of parser")
+      {
+          std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+          auto validator = vcf::build_parser("checkpoint.vcf", vcf::ValidationLevel::error, vcf::Version::v41,
+                                             vcf::Ploidy{2});
+          vcf::write_checkpoint(options, 0, "", *validator, outputs);
+
+          checkpoint = vcf::read_checkpoint(checkpoint_path);
+          std::stringstream input{content};
+          CHECK_THROWS_AS(vcf::is_valid_vcf_file_checkpointed(input, "checkpoint.vcf", vcf::ValidationLevel::warning,
+                                                              vcf::Ploidy{2}, outputs, options, &checkpoint),
+                          std::invalid_argument);
+      }
+
+      SECTION("The checkpoint is only valid for the same grammar")
+      {
+          std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+          auto validator = vcf::build_parser("checkpoint.vcf", vcf::ValidationLevel::warning, vcf::Version::v41,
+                                             vcf::Ploidy{2});
+          vcf::write_checkpoint(options, 0, "", *validator, outputs);
+
+          checkpoint = vcf::read_checkpoint(checkpoint_path);
+          CHECK(checkpoint.parser_grammar == validator->grammar());
+          checkpoint.parser_grammar += " (older build)";
+          std::stringstream input{content};
+          CHECK_THROWS_AS(vcf::is_valid_vcf_file_checkpointed(input, "checkpoint.vcf", vcf::ValidationLevel::warning,
+                                                              vcf::Ploidy{2}, outputs, options, &checkpoint),
+                          std::invalid_argument);
+      }
+
+      SECTION("The checkpoint is only valid for the same settings")
+      {
+          std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+          auto validator = vcf::build_parser("checkpoint.vcf", vcf::ValidationLevel::warning, vcf::Version::v41,
+                                             vcf::Ploidy{2});
+          vcf::write_checkpoint(options, 0, "", *validator, outputs);
+
+          checkpoint = vcf::read_checkpoint(checkpoint_path);
+          CHECK(checkpoint.settings == options.settings);
+          vcf::CheckpointOptions other_options{checkpoint_path, 1024, "ploidy=3"};
+          std::stringstream input{content};
+          CHECK_THROWS_AS(vcf::is_valid_vcf_file_checkpointed(input, "checkpoint.vcf", vcf::ValidationLevel::warning,
+                                                              vcf::Ploidy{3}, outputs, other_options, &checkpoint),
+                          std::invalid_argument);
+      }
+
+      SECTION("The checkpoint is only valid for the same input before its offset")
+      {
+          std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+          auto validator = vcf::build_parser("checkpoint.vcf", vcf::ValidationLevel::warning, vcf::Version::v41,
+                                             vcf::Ploidy{2});
+          std::stringstream original{content};
+          std::streamoff offset = (header + first_half).size();
+          vcf::write_checkpoint(options, offset, vcf::input_digest(original, offset), *validator, outputs);
+          checkpoint = vcf::read_checkpoint(checkpoint_path);
+
+          std::string modified = content;
+          modified.replace(modified.find("DP=5"), 4, "DP=6");
+          std::stringstream modified_input{modified};
+          CHECK_THROWS_AS(vcf::is_valid_vcf_file_checkpointed(modified_input, "checkpoint.vcf",
+                                                              vcf::ValidationLevel::warning, vcf::Ploidy{2}, outputs,
+                                                              options, &checkpoint),
+                          std::invalid_argument);
+
+          std::stringstream truncated_input{header + "1\t100\t.\tA\tC\t.\t.\tDP=x\n"};
+          CHECK_THROWS_AS(vcf::is_valid_vcf_file_checkpointed(truncated_input, "checkpoint.vcf",
+                                                              vcf::ValidationLevel::warning, vcf::Ploidy{2}, outputs,
+                                                              options, &checkpoint),
+                          std::invalid_argument);
+      }
+
+      boost::filesystem::remove_all(directory);
+  }
+
+  TEST_CASE("Resume a validation between breakend mates", "[checkpoint]")
+  {
+      auto directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+      boost::filesystem::create_directory(directory);
+      auto checkpoint_path = (directory / "validation.checkpoint").string();
+
+      std::string header{"##fileformat=VCFv4.1\n"
+                         "##reference=ref.fasta\n"
+                         "##contig=<ID=1>\n"
+                         "##INFO=<ID=MATEID,Number=.,Type=String,Description=\"ID of mate breakends\">\n"
+                         "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n"};
+      std::string first_half{"1\t100\tbnd_a\tA\tA[1:300[\t.\t.\tMATEID=bnd_b\n"
+                             "1\t200\tbnd_c\tA\tA[1:400[\t.\t.\tMATEID=bnd_d\n"};
+      std::string second_half{"1\t300\tbnd_b\tA\t]1:100]A\t.\t.\tMATEID=bnd_a\n"
+                              "1\t500\t.\tA\tC\t.\t.\t.\n"};
+      std::string content = header + first_half + second_half;
+
+      vcf::CheckpointOptions options{checkpoint_path, 1024, "ploidy=2"};
+
+      auto validate = [&](std::string const &report, vcf::Checkpoint const *resume) {
+          std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+          if (resume == nullptr) {
+              outputs.emplace_back(new vcf::SummaryReportWriter{report});
+          } else {
+              outputs = vcf::resume_outputs(*resume);
+          }
+          std::stringstream input{content};
+          return vcf::is_valid_vcf_file_checkpointed(input, "checkpoint.vcf", vcf::ValidationLevel::warning,
+                                                     vcf::Ploidy{2}, outputs, options, resume);
+      };
+
+      auto expected_report = directory / "expected.txt";
+      validate(expected_report.string(), nullptr);
+
+      // validation interrupted between each breakend and its mate
+      auto resumed_report = directory / "resumed.txt";
+      {
+          std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+          outputs.emplace_back(new vcf::SummaryReportWriter{resumed_report.string()});
+          std::stringstream input{content};
+          std::vector<char> line;
+          util::readline(input, line);
+          auto validator = vcf::build_parser("checkpoint.vcf", vcf::ValidationLevel::warning, vcf::detect_version(line),
+                                             vcf::Ploidy{2});
+          vcf::validate_header(line, input, *validator, outputs);
+          for (size_t i = 0; i < 2; ++i) {
+              validator->parse(line);
+              vcf::write_errors(*validator, outputs);
+              util::readline(input, line);
+          }
+          std::streamoff offset = (header + first_half).size();
+          vcf::write_checkpoint(options, offset, vcf::input_digest(input, offset), *validator, outputs);
+      }
+      vcf::Checkpoint checkpoint = vcf::read_checkpoint(checkpoint_path);
+      validate(resumed_report.string(), &checkpoint);
+
+      // bnd_a is paired with bnd_b across the checkpoint, and the missing mate of bnd_c is still found
+      CHECK(read_file(resumed_report) == read_file(expected_report));
+      CHECK(read_file(resumed_report).find("Breakend mate bnd_d") != std::string::npos);
+      CHECK(read_file(resumed_report).find("Breakend mate bnd_a") == std::string::npos);
+      CHECK(read_file(resumed_report).find("Breakend mate bnd_b") == std::string::npos);
+
+      boost::filesystem::remove_all(directory);
+  }
+}
@@ -0,0 +1,84 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "vcf/validator.hpp"
+#include "test_utils.hpp"
+
+namespace ebi
+{
+  TEST_CASE("Report all the errors and warnings of each record", "[collect_all_errors]")
+  {
+      std::string content{"##fileformat=VCFv4.1\n"
+                          "##reference=ref.fasta\n"
+                          "##contig=<ID=1>\n"
+                          "##INFO=<ID=DP,Number=1,Type=Integer,Description=\"Depth\">\n"
+                          "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n"
+                          "1\t100\t.\tA\tA\t-1\t0\tDP=x\n"
+                          "2\t0\t.\tA\tC\t.\tq10\tDP=5\n"};
+
+      std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+      outputs.emplace_back(new MemoryReportWriter{});
+      auto & report = static_cast<MemoryReportWriter &>(*outputs[0]);
+      vcf::ValidationOptions collect_all;
+      collect_all.collect_all_errors = true;
+
+      SECTION("Only the first error of a record by default")
+      {
+          std::stringstream input{content};
+          CHECK_FALSE(vcf::is_valid_vcf_file(input, "collect.vcf", vcf::ValidationLevel::warning, vcf::Ploidy{2},
+                                             outputs));
+          CHECK(report.errors == std::vector<size_t>{6});
+          CHECK(report.warnings == std::vector<size_t>{7});
+      }
+
+      SECTION("All the errors and warnings")
+      {
+          std::stringstream input{content};
+          CHECK_FALSE(vcf::is_valid_vcf_file(input, "collect.vcf", vcf::ValidationLevel::warning, vcf::Ploidy{2},
+                                             outputs, collect_all));
+          // REF and ALT are the same, negative quality, reserved FILTER 0, wrong DP type
+          CHECK(report.errors == (std::vector<size_t>{6, 6, 6, 6}));
+          // position zero, undefined contig and undefined filter
+          CHECK(report.warnings == (std::vector<size_t>{7, 7, 7}));
+      }
+
+      SECTION("All the errors are counted")
+      {
+          std::string repeated{"##fileformat=VCFv4.1\n"
+                               "##reference=ref.fasta\n"
+                               "##contig=<ID=1>\n"
+                               "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n"};
+          for (size_t position = 1; position <= 5; ++position) {
+              repeated += "1\t" + std::to_string(position) + "\t.\tA\tC\t-1\t0\t.\n";
+          }
+
+          std::stringstream input{repeated};
+          CHECK_FALSE(vcf::is_valid_vcf_file(input, "collect.vcf", vcf::ValidationLevel::count, vcf::Ploidy{2},
+                                             outputs, collect_all));
+          // negative quality and reserved FILTER 0, only the first one of each class is reported
+          CHECK(report.errors == (std::vector<size_t>{5, 5}));
+          CHECK(report.warnings.empty());
+          CHECK(report.messages == (std::vector<std::string>{"Errors of type QualityBodyError: 5",
+                                                             "Errors of type FilterBodyError: 5"}));
+      }
+  }
+}
@@ -0,0 +1,99 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "vcf/validator.hpp"
+#include "test_utils.hpp"
+
+namespace ebi
+{
+  TEST_CASE("Count the errors of each class", "[count_error_policy]")
+  {
+      std::string content{"##fileformat=VCFv4.1\n"
+                          "##contig=<ID=1>\n"
+                          "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n"};
+      for (size_t position = 1; position <= 6; ++position) {
+          content += "1\t" + std::to_string(position) + "\t.\tA\tA\t.\t.\t.\n";
+      }
+      for (size_t position = 7; position <= 9; ++position) {
+          content += "1\t" + std::to_string(position) + "\t.\tA\tC\t-1\t.\t.\n";
+      }
+
+      std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+      outputs.emplace_back(new MemoryReportWriter{});
+      auto & report = static_cast<MemoryReportWriter &>(*outputs[0]);
+
+      SECTION("Only the first error of each class is kept")
+      {
+          std::stringstream input{content};
+          CHECK_FALSE(vcf::is_valid_vcf_file(input, "count.vcf", vcf::ValidationLevel::count, vcf::Ploidy{2},
+                                             outputs));
+          CHECK(report.errors == (std::vector<size_t>{4, 10}));
+          CHECK(report.warnings == (std::vector<size_t>{4}));
+          CHECK(report.messages == (std::vector<std::string>{"Errors of type AlternateAllelesBodyError: 6",
+                                                             "Errors of type QualityBodyError: 3",
+                                                             "Warnings of type MetaSectionError: 1"}));
+      }
+
+      SECTION("The counts are available from the validator")
+      {
+          std::unique_ptr<vcf::Parser> validator = vcf::build_parser("count.vcf", vcf::ValidationLevel::count,
+                                                                     vcf::Version::v41, vcf::Ploidy{2});
+          std::stringstream lines{content};
+          std::string line;
+          while (std::getline(lines, line)) {
+              validator->parse(line + "\n");
+          }
+          validator->end();
+
+          vcf::ErrorCounts const & counts = validator->error_counts();
+          REQUIRE(counts.errors.size() == vcf::ErrorClassifier::names().size());
+          CHECK(counts.errors[10] == 6);
+          CHECK(counts.errors[11] == 3);
+          CHECK(validator->errors().empty());
+      }
+
+      SECTION("Other validation levels don't count")
+      {
+          std::unique_ptr<vcf::Parser> validator = vcf::build_parser("count.vcf", vcf::ValidationLevel::warning,
+                                                                     vcf::Version::v41, vcf::Ploidy{2});
+          CHECK(validator->error_counts().errors.empty());
+      }
+  }
+
+  TEST_CASE("Classes of the errors not built", "[count_error_policy]")
+  {
+      // the syntax errors are only built when they are the first of their class, so their class is static
+      vcf::ErrorClassifier classifier;
+      vcf::Error error{1};
+      vcf::MetaSectionError meta_section_error{1};
+      vcf::FileformatError fileformat_error{1};
+      vcf::QualityBodyError quality_error{1};
+      vcf::SamplesFieldBodyError samples_field_error{1, "Sample #1 does not start with a valid genotype", "GT"};
+      vcf::DuplicationError duplication_error{1};
+      CHECK(vcf::ErrorClassifier::index<vcf::Error>() == classifier.classify(error));
+      CHECK(vcf::ErrorClassifier::index<vcf::MetaSectionError>() == classifier.classify(meta_section_error));
+      CHECK(vcf::ErrorClassifier::index<vcf::FileformatError>() == classifier.classify(fileformat_error));
+      CHECK(vcf::ErrorClassifier::index<vcf::QualityBodyError>() == classifier.classify(quality_error));
+      CHECK(vcf::ErrorClassifier::index<vcf::SamplesFieldBodyError>() == classifier.classify(samples_field_error));
+      CHECK(vcf::ErrorClassifier::index<vcf::DuplicationError>() == classifier.classify(duplication_error));
+  }
+}
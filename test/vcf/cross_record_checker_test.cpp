@@ -0,0 +1,126 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "util/memory_budget.hpp"
+#include "vcf/cross_record_checker.hpp"
+
+namespace ebi
+{
+  TEST_CASE("Rules between records", "[cross_record_checker]")
+  {
+      std::shared_ptr<vcf::Source> source{new vcf::Source{"cross_record.vcf", vcf::VCF_FILE_VCF, vcf::Version::v43,
+                                                          vcf::Ploidy{2}}};
+      size_t line = 0;
+
+      // checks a record and returns the lines of the warnings found, sorted as they were found
+      auto check = [&](vcf::CrossRecordChecker &checker, std::string const &chromosome, size_t position,
+                       std::string const &id, std::string const &alternate,
+                       std::multimap<std::string, std::string> const &info) {
+          ++line;
+          vcf::Record record{line, chromosome, position, {id}, "A", {alternate}, 0, {vcf::PASS}, info, {}, {}, source};
+          std::vector<size_t> lines;
+          for (auto &warning : checker.check(record)) {
+              lines.push_back(warning->line);
+          }
+          return lines;
+      };
+      std::multimap<std::string, std::string> const no_info{{vcf::MISSING_VALUE, ""}};
+
+      SECTION("gVCF reference blocks should not overlap the next records")
+      {
+          vcf::CrossRecordChecker checker;
+          CHECK(check(checker, "1", 100, ".", "<*>", {{vcf::END, "150"}}).empty());
+          CHECK(check(checker, "1", 151, ".", "<*>", {{vcf::END, "200"}}).empty());
+          CHECK(check(checker, "1", 200, ".", "C", no_info) == std::vector<size_t>{3});
+          CHECK(check(checker, "1", 201, ".", "C", no_info).empty());
+          CHECK(check(checker, "1", 300, ".", "<*>", {{vcf::END, "400"}}).empty());
+          CHECK(check(checker, "2", 350, ".", "C", no_info).empty());
+      }
+
+      SECTION("Breakend mates should be present and point back")
+      {
+          vcf::CrossRecordChecker checker;
+          CHECK(check(checker, "1", 100, "bnd_a", "A[2:300[", {{vcf::MATEID, "bnd_b"}}).empty());
+          CHECK(check(checker, "1", 200, "bnd_c", "A]1:250]", {{vcf::MATEID, "bnd_d"}}).empty());
+          CHECK(check(checker, "1", 250, "bnd_e", "A]1:200]", {{vcf::MATEID, "bnd_f"}}) == std::vector<size_t>{3});
+          // the mate of line 2 is reported as soon as the input moves past its position
+          CHECK(check(checker, "1", 260, ".", "C", no_info) == std::vector<size_t>{2});
+          CHECK(check(checker, "2", 300, "bnd_b", "]1:100]A", {{vcf::MATEID, "bnd_a"}}).empty());
+          CHECK(check(checker, "2", 400, "bnd_g", "A[3:100[", {{vcf::MATEID, "bnd_h"}}).empty());
+          // the mate expected in contig 3 is reported when contig 3 is left
+          CHECK(check(checker, "3", 50, ".", "C", no_info).empty());
+          CHECK(check(checker, "4", 50, ".", "C", no_info) == std::vector<size_t>{6});
+      }
+
+      SECTION("Mates before the start of the input are not checked")
+      {
+          vcf::CrossRecordChecker checker;
+          CHECK(check(checker, "1", 200, "bnd_b", "]1:100]A", {{vcf::MATEID, "bnd_a"}}).empty());
+          CHECK(check(checker, "1", 300, "bnd_c", "]1:250]A", {{vcf::MATEID, "bnd_d"}}) == std::vector<size_t>{2});
+
+          checker.clear();
+          CHECK(check(checker, "1", 300, "bnd_c", "]1:250]A", {{vcf::MATEID, "bnd_d"}}).empty());
+      }
+
+      SECTION("Mates still pending at the end of the input are reported")
+      {
+          vcf::CrossRecordChecker checker;
+          CHECK(check(checker, "1", 100, "bnd_a", "A[3:300[", {{vcf::MATEID, "bnd_b"}}).empty());
+          CHECK(check(checker, "2", 100, "bnd_c", "A[2:500[", {{vcf::MATEID, "bnd_d"}}).empty());
+          CHECK(check(checker, "2", 200, ".", "C", no_info).empty());
+
+          // the mate of line 2 was after the last record of contig 2, and contig 3 was never read
+          std::vector<size_t> lines;
+          for (auto &warning : checker.finish()) {
+              lines.push_back(warning->line);
+          }
+          CHECK(lines == (std::vector<size_t>{1, 2}));
+          CHECK(checker.finish().empty());
+      }
+
+      SECTION("IDs should not be repeated in a window of positions")
+      {
+          vcf::CrossRecordChecker checker{100};
+          CHECK(check(checker, "1", 100, "rs1", "C", no_info).empty());
+          CHECK(check(checker, "1", 150, "rs2", "C", no_info).empty());
+          CHECK(check(checker, "1", 200, "rs1", "C", no_info) == std::vector<size_t>{3});
+          CHECK(check(checker, "1", 201, "rs1", "C", no_info).empty());
+          CHECK(check(checker, "1", 201, "rs3", "C", no_info).empty());
+          CHECK(check(checker, "2", 201, "rs2", "C", no_info).empty());
+
+          source->version = vcf::Version::v42;
+          CHECK(check(checker, "2", 202, "rs2", "C", no_info).empty());
+      }
+
+      SECTION("The memory of the tables is reserved")
+      {
+          size_t used = util::memory_budget().get_used();
+          {
+              vcf::CrossRecordChecker checker;
+              check(checker, "1", 100, "bnd_a", "A[2:300[", {{vcf::MATEID, "bnd_b"}});
+              check(checker, "1", 110, "rs1", "<*>", {{vcf::END, "150"}});
+              CHECK(util::memory_budget().get_used() > used);
+          }
+          CHECK(util::memory_budget().get_used() == used);
+      }
+  }
+}
@@ -0,0 +1,131 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <boost/filesystem.hpp>
+
+#include "catch/catch.hpp"
+
+#include "vcf/daemon.hpp"
+#include "vcf/string_constants.hpp"
+
+namespace ebi
+{
+  TEST_CASE("Validate files in a daemon", "[daemon]")
+  {
+      auto directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+      boost::filesystem::create_directory(directory);
+      auto socket_path = (directory / "validatord.sock").string();
+
+      vcf::Daemon daemon{socket_path, 2};
+      std::thread server{[&daemon]() { daemon.run(); }};
+
+      std::string content{"##fileformat=VCFv4.1\n"
+                          "##reference=ref.fasta\n"
+                          "##contig=<ID=1>\n"
+                          "##INFO=<ID=DP,Number=1,Type=Integer,Description=\"Depth\">\n"
+                          "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n"
+                          "1\t100\t.\tA\tC\t.\t.\tDP=5\n"
+                          "1\t200\t.\tA\tC\t.\t.\tDP=x\n"};
+      std::vector<std::string> report;
+      auto add_to_report = [&report](std::string const & line) { report.push_back(line); };
+
+      SECTION("Input sent through the socket")
+      {
+          std::stringstream input{content};
+          CHECK_FALSE(vcf::validate_in_daemon(socket_path, vcf::DaemonRequest{vcf::STDIN, vcf::WARNING, 2, ""},
+                                              input, add_to_report));
+          REQUIRE(report.size() == 1);
+          CHECK(report[0] == "Line 7: INFO DP=x does not match the meta specification Type=Integer");
+      }
+
+      SECTION("Input read by the daemon")
+      {
+          auto path = (directory / "input.vcf").string();
+          std::ofstream{path} << content.substr(0, content.rfind("1\t200"));
+          std::stringstream no_input;
+          CHECK(vcf::validate_in_daemon(socket_path, vcf::DaemonRequest{path, vcf::WARNING, 2, "Y=1"},
+                                        no_input, add_to_report));
+          CHECK(report.empty());
+      }
+
+      SECTION("Validations that can't run")
+      {
+          std::stringstream no_input;
+          CHECK_THROWS_AS(vcf::validate_in_daemon(socket_path,
+                                                  vcf::DaemonRequest{(directory / "missing.vcf").string(),
+                                                                     vcf::WARNING, 2, ""},
+                                                  no_input, add_to_report),
+                          std::runtime_error);
+          CHECK_THROWS_AS(vcf::validate_in_daemon(socket_path, vcf::DaemonRequest{vcf::STDIN, vcf::WARNING, 0, ""},
+                                                  no_input, add_to_report),
+                          std::runtime_error);
+      }
+
+      SECTION("Only the user that started the daemon can reach it")
+      {
+          struct stat status;
+          REQUIRE(::stat(socket_path.c_str(), &status) == 0);
+          CHECK((status.st_mode & 0777) == 0600);
+
+          // the socket of a running daemon is not replaced
+          CHECK_THROWS_AS(vcf::Daemon(socket_path, 1), std::runtime_error);
+          std::stringstream input{content};
+          CHECK_FALSE(vcf::validate_in_daemon(socket_path, vcf::DaemonRequest{vcf::STDIN, vcf::WARNING, 2, ""},
+                                              input, add_to_report));
+
+          auto regular_file = (directory / "regular_file").string();
+          std::ofstream{regular_file} << "not a socket";
+          CHECK_THROWS_AS(vcf::Daemon(regular_file, 1), std::runtime_error);
+          CHECK(boost::filesystem::is_regular_file(regular_file));
+      }
+
+      SECTION("The socket of a daemon that is not running is replaced")
+      {
+          auto stale_path = (directory / "stale.sock").string();
+          sockaddr_un address;
+          std::memset(&address, 0, sizeof(address));
+          address.sun_family = AF_UNIX;
+          std::strcpy(address.sun_path, stale_path.c_str());
+          int stale = ::socket(AF_UNIX, SOCK_STREAM, 0);
+          REQUIRE(::bind(stale, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == 0);
+          ::close(stale);
+
+          vcf::Daemon replacement{stale_path, 1};
+          std::thread replacement_server{[&replacement]() { replacement.run(); }};
+          std::stringstream input{content};
+          CHECK_FALSE(vcf::validate_in_daemon(stale_path, vcf::DaemonRequest{vcf::STDIN, vcf::WARNING, 2, ""},
+                                              input, add_to_report));
+          replacement.stop();
+          replacement_server.join();
+      }
+
+      daemon.stop();
+      server.join();
+      boost::filesystem::remove_all(directory);
+  }
+}
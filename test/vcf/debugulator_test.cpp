@@ -22,6 +22,7 @@
 #include "vcf/odb_report.hpp"
 #include "vcf/debugulator.hpp"
 #include "vcf/string_constants.hpp"
+#include "test_utils.hpp"
 
 namespace ebi
 {
@@ -502,6 +503,24 @@ namespace ebi
       }
   }
 
+  TEST_CASE("Fixing several errors of a line", "[debugulator]")
+  {
+      std::stringstream input{"#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n"
+                              "1\t100\tdupid;dupid\tA\tC\t.\t0;q10\t.\n"
+                              "1\t200\tid\tA\tC\t.\tq10;q10\t.\n"};
+      MemoryReportReader report{{
+              std::make_shared<vcf::IdBodyError>(2, "Duplicate ID fields", vcf::ErrorFix::DUPLICATE_VALUES),
+              std::make_shared<vcf::FilterBodyError>(2, "Invalid filter string 0", vcf::ErrorFix::IRRECOVERABLE_VALUE, "0"),
+              std::make_shared<vcf::FilterBodyError>(3, "Duplicate filter strings", vcf::ErrorFix::DUPLICATE_VALUES)}};
+
+      std::stringstream output;
+      vcf::debugulator::fix_vcf_file(input, report, output);
+
+      CHECK(output.str() == "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n"
+                            "1\t100\tdupid\tA\tC\t.\tq10\t.\n"
+                            "1\t200\tid\tA\tC\t.\tq10\t.\n");
+  }
+
   TEST_CASE("Empty report", "[debugulator]")
   {
       boost::filesystem::path path{"test/input_files/complexfile_passed_000.vcf.errors.1472743634194.db"};
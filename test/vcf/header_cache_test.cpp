@@ -0,0 +1,122 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "catch/catch.hpp"
+
+#include "vcf/header_cache.hpp"
+#include "test_utils.hpp"
+
+namespace ebi
+{
+  bool is_valid_cached(std::string const & content,
+                       vcf::HeaderCache &cache,
+                       std::vector<std::unique_ptr<vcf::ReportWriter>> &outputs)
+  {
+      std::stringstream input{content};
+      vcf::ValidationOptions options;
+      options.header_cache = &cache;
+      return vcf::is_valid_vcf_file(input, "cached.vcf", vcf::ValidationLevel::warning, vcf::Ploidy{2}, outputs,
+                                    options);
+  }
+
+  size_t count_cached_headers(boost::filesystem::path const & directory)
+  {
+      return std::distance(boost::filesystem::directory_iterator{directory}, boost::filesystem::directory_iterator{});
+  }
+
+  TEST_CASE("Validate files with a cached header", "[header_cache]")
+  {
+      auto directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+      boost::filesystem::create_directory(directory);
+      vcf::HeaderCache cache{directory.string()};
+
+      std::string header{"##fileformat=VCFv4.1\n"
+                         "##reference=ref.fasta\n"
+                         "##contig=<ID=1>\n"
+                         "##INFO=<ID=DP,Number=1,Type=Integer,Description=\"Depth\">\n"
+                         "##FORMAT=<ID=GT,Number=1,Type=String,Description=\"Genotype\">\n"
+                         "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\tFORMAT\tS1\tS2\n"};
+
+      std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+      outputs.emplace_back(new MemoryReportWriter{});
+      auto & report = static_cast<MemoryReportWriter &>(*outputs[0]);
+
+      SECTION("A restored header gives the same results")
+      {
+          CHECK(is_valid_cached(header + "1\t100\t.\tA\tC\t.\t.\tDP=5\tGT\t0/1\t1/1\n", cache, outputs));
+          CHECK(count_cached_headers(directory) == 1);
+
+          CHECK(is_valid_cached(header + "1\t200\t.\tA\tC\t.\t.\tDP=5\tGT\t0/1\t1/1\n", cache, outputs));
+          CHECK(count_cached_headers(directory) == 1);
+
+          // the INFO and FORMAT definitions and the samples come from the cache
+          CHECK_FALSE(is_valid_cached(header + "1\t300\t.\tA\tC\t.\t.\tDP=x\tGT\t0/1\t1/1\n", cache, outputs));
+          CHECK_FALSE(is_valid_cached(header + "1\t300\t.\tA\tC\t.\t.\tDP=5\tGT\t0/1\n", cache, outputs));
+          CHECK(report.errors == (std::vector<size_t>{7, 7}));
+      }
+
+      SECTION("Headers with errors are not cached")
+      {
+          std::string wrong_header{"##fileformat=VCFv4.1\n"
+                                   "##INFO=<ID=DP,Number=x,Type=Integer,Description=\"Depth\">\n"
+                                   "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n"};
+          CHECK_FALSE(is_valid_cached(wrong_header + "1\t100\t.\tA\tC\t.\t.\t.\n", cache, outputs));
+          CHECK(count_cached_headers(directory) == 0);
+      }
+
+      SECTION("Corrupted files are ignored")
+      {
+          CHECK(is_valid_cached(header + "1\t100\t.\tA\tC\t.\t.\tDP=5\tGT\t0/1\t1/1\n", cache, outputs));
+          auto cached_file = boost::filesystem::directory_iterator{directory}->path();
+          boost::filesystem::resize_file(cached_file, 20);
+
+          CHECK_FALSE(is_valid_cached(header + "1\t300\t.\tA\tC\t.\t.\tDP=x\tGT\t0/1\t1/1\n", cache, outputs));
+          CHECK(report.errors == std::vector<size_t>{7});
+      }
+
+      SECTION("States written by a parser with another grammar are not restored")
+      {
+          auto validator = vcf::build_parser("cached.vcf", vcf::ValidationLevel::warning, vcf::Version::v41,
+                                             vcf::Ploidy{2});
+          validator->parse(header);
+          std::ostringstream saved;
+          validator->save_header(saved);
+
+          std::string state = saved.str();
+          std::string grammar = validator->grammar();
+          size_t grammar_start = state.find(grammar);
+          REQUIRE(grammar_start != std::string::npos);
+          state[grammar_start + grammar.size() - 1] ^= 1;
+
+          std::istringstream other_grammar{state};
+          auto restored = vcf::build_parser("cached.vcf", vcf::ValidationLevel::warning, vcf::Version::v41,
+                                            vcf::Ploidy{2});
+          CHECK_THROWS_AS(restored->restore_header(other_grammar), std::runtime_error);
+
+          // the grammar is part of the key too, so the parsers of each version never share a cached header
+          CHECK(grammar != vcf::build_parser("cached.vcf", vcf::ValidationLevel::warning, vcf::Version::v42,
+                                             vcf::Ploidy{2})->grammar());
+      }
+
+      boost::filesystem::remove_all(directory);
+  }
+}
@@ -0,0 +1,75 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "vcf/limited_report_writer.hpp"
+#include "vcf/validator.hpp"
+#include "test_utils.hpp"
+
+namespace ebi
+{
+  TEST_CASE("Limits of the amount of errors", "[limited_report_writer]")
+  {
+      std::string content{"##fileformat=VCFv4.1\n"
+                          "##contig=<ID=1>\n"
+                          "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n"};
+      for (size_t position = 1; position <= 6; ++position) {
+          content += "1\t" + std::to_string(position) + "\t.\tA\tA\t.\t.\t.\n";
+      }
+      for (size_t position = 7; position <= 9; ++position) {
+          content += "1\t" + std::to_string(position) + "\t.\tA\tC\t-1\t.\t.\n";
+      }
+
+      auto report = new MemoryReportWriter{};
+      std::vector<std::unique_ptr<vcf::ReportWriter>> inner_outputs;
+      inner_outputs.emplace_back(report);
+
+      SECTION("Errors of each type")
+      {
+          std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+          outputs.emplace_back(new vcf::LimitedReportWriter{std::move(inner_outputs), vcf::ErrorLimits{0, 2}});
+
+          std::stringstream input{content};
+          CHECK_FALSE(vcf::is_valid_vcf_file(input, "limited.vcf", vcf::ValidationLevel::warning, vcf::Ploidy{2},
+                                             outputs));
+          CHECK(report->errors == (std::vector<size_t>{4, 5, 10, 11}));
+          CHECK(report->messages == (std::vector<std::string>{
+                  "Only the first 2 errors of type AlternateAllelesBodyError are reported",
+                  "Only the first 2 errors of type QualityBodyError are reported"}));
+      }
+
+      SECTION("Errors of the whole validation")
+      {
+          std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+          outputs.emplace_back(new vcf::LimitedReportWriter{std::move(inner_outputs), vcf::ErrorLimits{5, 2}});
+
+          std::stringstream input{content};
+          CHECK_THROWS_AS(vcf::is_valid_vcf_file(input, "limited.vcf", vcf::ValidationLevel::warning, vcf::Ploidy{2},
+                                                 outputs),
+                          vcf::ErrorLimitReached);
+          // the errors not reported are counted too
+          CHECK(report->errors == (std::vector<size_t>{4, 5}));
+          REQUIRE(report->messages.size() == 2);
+          CHECK(report->messages[1] == "The validation stopped after 5 errors, the rest of the input was not "
+                                       "validated and this report is truncated");
+      }
+  }
+}
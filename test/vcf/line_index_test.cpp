@@ -0,0 +1,144 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+#include <boost/filesystem.hpp>
+
+#include "catch/catch.hpp"
+
+#include "vcf/debugulator.hpp"
+#include "vcf/line_index.hpp"
+#include "test_utils.hpp"
+
+namespace ebi
+{
+  vcf::LineIndex build_line_index(std::string const &content, size_t interval, size_t chunk_size,
+                                   std::vector<size_t> const &error_lines)
+  {
+      vcf::LineIndexBuilder builder{interval};
+      size_t next_error = 0;
+      size_t lines_read = 0;
+      for (size_t start = 0; start < content.size(); start += chunk_size) {
+          std::string chunk = content.substr(start, chunk_size);
+          builder.update(chunk.data(), chunk.size());
+
+          // the errors are reported once their line has been completely given to the builder
+          lines_read += std::count(chunk.begin(), chunk.end(), '\n');
+          for (; next_error < error_lines.size() && error_lines[next_error] <= lines_read; ++next_error) {
+              builder.add_line(error_lines[next_error]);
+          }
+      }
+      return builder.get_index();
+  }
+
+  TEST_CASE("Line index", "[line_index]")
+  {
+      std::string content{"##fileformat=VCFv4.1\n"   // 0
+                          "#CHROM\tPOS\n"            // 21
+                          "1\t100\n"                 // 32
+                          "1\t200\n"                 // 38
+                          "1\t300\n"                 // 44
+                          "1\t400\n"                 // 50
+                          "1\t500\n"};               // 56
+
+      SECTION("Every interval and the lines with errors are indexed")
+      {
+          vcf::LineIndex index = build_line_index(content, 3, 4, {2, 6});
+          CHECK(index.input_size == 62);
+          CHECK((index.offsets == std::map<size_t, std::streamoff>{{1, 0}, {2, 21}, {4, 38}, {6, 50}, {7, 56}}));
+
+          CHECK((index.find(3) == std::pair<size_t, std::streamoff>{2, 21}));
+          CHECK((index.find(6) == std::pair<size_t, std::streamoff>{6, 50}));
+          CHECK((index.find(100) == std::pair<size_t, std::streamoff>{7, 56}));
+      }
+
+      SECTION("Lines read long ago are not indexed")
+      {
+          vcf::LineIndexBuilder builder{0};
+          builder.update(content.data(), 40);
+          builder.update(content.data() + 40, content.size() - 40);
+          builder.add_line(2);
+          builder.add_line(4);
+          builder.add_line(5);
+          CHECK((builder.get_index().offsets == std::map<size_t, std::streamoff>{{4, 38}, {5, 44}}));
+      }
+
+      SECTION("Write, read and extract lines")
+      {
+          vcf::LineIndex index = build_line_index(content, 2, 1024, {});
+          auto path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+          vcf::write_line_index(path.string(), index);
+          vcf::LineIndex read = vcf::read_line_index(path.string());
+          boost::filesystem::remove(path);
+
+          CHECK(read.interval == 2);
+          CHECK(read.input_size == index.input_size);
+          CHECK(read.offsets == index.offsets);
+
+          std::stringstream input{content};
+          std::stringstream output;
+          CHECK(vcf::extract_lines(input, read, 4, 5, output) == 2);
+          CHECK(output.str() == "1\t200\n1\t300\n");
+
+          output.str("");
+          CHECK(vcf::extract_lines(input, read, 7, 9, output) == 1);
+          CHECK(output.str() == "1\t500\n");
+
+          std::stringstream other_input{content + "1\t600\n"};
+          CHECK_THROWS_AS(vcf::extract_lines(other_input, read, 1, 1, output), std::invalid_argument);
+      }
+
+      SECTION("The debugulator copies the lines before the closest indexed line")
+      {
+          std::string header{"##fileformat=VCFv4.1\n"
+                             "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n"};
+          std::string body;
+          for (size_t position = 1; position <= 100; ++position) {
+              body += "1\t" + std::to_string(position) + "\t" + (position % 30 == 0 ? "id;id" : "id")
+                      + "\tA\tC\t.\t.\t.\n";
+          }
+          std::vector<std::shared_ptr<vcf::Error>> errors;
+          for (size_t line = 32; line <= 102; line += 30) {
+              errors.push_back(std::make_shared<vcf::IdBodyError>(line, "Duplicate ID fields",
+                                                                  vcf::ErrorFix::DUPLICATE_VALUES));
+          }
+
+          std::stringstream expected;
+          {
+              std::stringstream input{header + body};
+              MemoryReportReader report{errors};
+              vcf::debugulator::fix_vcf_file(input, report, expected);
+          }
+
+          vcf::LineIndex index = build_line_index(header + body, 16, 100, {32, 62, 92});
+          std::stringstream input{header + body};
+          MemoryReportReader report{errors};
+          std::stringstream output;
+          vcf::FixManifest manifest{0, 5, {}};
+          vcf::debugulator::fix_vcf_file(input, report, output, &manifest, &index);
+
+          CHECK(output.str() == expected.str());
+          CHECK(output.str().find("id;id") == std::string::npos);
+          REQUIRE(manifest.ranges.size() == 3);
+          CHECK(manifest.ranges[1].output_line == 62);
+          CHECK(manifest.ranges[1].context_line == 57);
+          CHECK(expected.str().substr(manifest.ranges[1].context_offset, 6) == "1\t55\ti");
+      }
+  }
+}
@@ -0,0 +1,71 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "util/memory_budget.hpp"
+#include "vcf/validator.hpp"
+
+namespace ebi
+{
+  TEST_CASE("Validate when the memory limit is reached", "[memory_limit]")
+  {
+      std::string header{"##fileformat=VCFv4.1\n"
+                         "##reference=ref.fasta\n"
+                         "##contig=<ID=1>\n"
+                         "##contig=<ID=2>\n"
+                         "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n"};
+      std::string body{"1\t100\t.\tA\tC\t.\t.\t.\n"
+                       "1\t50\t.\tA\tC\t.\t.\t.\n"
+                       "1\t150\t.\tA\tC\t.\t.\t.\n"
+                       "2\t10\t.\tA\tC\t.\t.\t.\n"
+                       "2\t5\t.\tA\tC\t.\t.\t.\n"};
+
+      std::unique_ptr<vcf::Parser> validator = vcf::build_parser("memory_limit.vcf", vcf::ValidationLevel::warning,
+                                                                 vcf::Version::v41, vcf::Ploidy{2});
+      validator->parse(header);
+
+      // nothing else fits, so the contigs are neither kept in the table of finished contigs nor as defined in the
+      // meta section, but their records are still checked to be sorted by position
+      util::MemoryBudget & budget = util::memory_budget();
+      REQUIRE(budget.get_used() > 0);
+      budget.set_limit(budget.get_used());
+
+      std::vector<size_t> errors;
+      std::vector<size_t> warnings;
+      std::stringstream lines{body};
+      std::string line;
+      while (std::getline(lines, line)) {
+          validator->parse(line + "\n");
+          for (auto & error : validator->errors()) {
+              errors.push_back(error->line);
+          }
+          for (auto & warning : validator->warnings()) {
+              warnings.push_back(warning->line);
+          }
+      }
+      validator->end();
+      budget.set_limit(0);
+
+      CHECK(errors == (std::vector<size_t>{7, 10}));
+      CHECK(warnings.empty());
+  }
+}
@@ -49,7 +49,7 @@ namespace ebi
             CHECK( meta.id == vcf::REFERENCE );
             CHECK( meta.structure == vcf::MetaEntry::Structure::NoValue );
             CHECK( boost::get<std::string>(meta.value) == std::string {} );
-            CHECK_THROWS_AS( (boost::get<std::map<std::string,std::string>>(meta.value)),
+            CHECK_THROWS_AS( (boost::get<vcf::MetaKeyValues>(meta.value)),
                             boost::bad_get);
         }
     }
@@ -77,7 +77,7 @@ namespace ebi
             CHECK( meta.structure == vcf::MetaEntry::Structure::PlainValue );
             CHECK( meta.id == vcf::ASSEMBLY );
             CHECK( boost::get<std::string>(meta.value) == std::string{"GRCh37"} );
-            CHECK_THROWS_AS( (boost::get<std::map<std::string,std::string>>(meta.value)),
+            CHECK_THROWS_AS( (boost::get<vcf::MetaKeyValues>(meta.value)),
                             boost::bad_get);
         }
                 
@@ -121,7 +121,7 @@ namespace ebi
             CHECK( meta.structure == vcf::MetaEntry::Structure::KeyValue );
             CHECK_THROWS_AS( boost::get<std::string>(meta.value),
                             boost::bad_get);
-            CHECK( (boost::get<std::map<std::string,std::string>>(meta.value)) == (std::map<std::string,std::string>{ {vcf::ID, "contig_1"} }) );
+            CHECK( (boost::get<vcf::MetaKeyValues>(meta.value)) == (vcf::MetaKeyValues{ {vcf::ID, "contig_1"} }) );
         }
         
     }
@@ -2056,4 +2056,36 @@ namespace ebi
                             vcf::MetaSectionError* );
         }
     }
+
+    TEST_CASE("Key-value pairs of a meta entry", "[constructor][keyvalue]")
+    {
+        vcf::MetaKeyValues key_values{ {vcf::NUMBER, "1"}, {vcf::ID, "DP"}, {vcf::TYPE, "Integer"} };
+
+        SECTION ("Values are found by key")
+        {
+            CHECK( key_values.size() == 3 );
+            CHECK( key_values.count(vcf::ID) == 1 );
+            CHECK( key_values.count(vcf::DESCRIPTION) == 0 );
+            CHECK( key_values[vcf::TYPE] == "Integer" );
+            CHECK( key_values[vcf::DESCRIPTION] == "" );
+            CHECK( key_values.has_value(vcf::ID, "DP") );
+            CHECK_FALSE( key_values.has_value(vcf::ID, "D") );
+            CHECK_THROWS_AS( key_values.at(vcf::DESCRIPTION), std::out_of_range );
+        }
+
+        SECTION ("Pairs are sorted by key and a key is only kept once, like in a std::map")
+        {
+            key_values.set(vcf::ID, "AD");
+            key_values.set(vcf::DESCRIPTION, "");
+
+            std::map<std::string, std::string> expected{ {vcf::DESCRIPTION, ""}, {vcf::ID, "AD"}, {vcf::NUMBER, "1"},
+                                                         {vcf::TYPE, "Integer"} };
+            std::map<std::string, std::string> found{key_values.begin(), key_values.end()};
+            CHECK( found == expected );
+            CHECK( (std::vector<std::pair<std::string, std::string>>{key_values.begin(), key_values.end()})
+                   == (std::vector<std::pair<std::string, std::string>>{expected.begin(), expected.end()}) );
+            CHECK( key_values == vcf::MetaKeyValues{expected} );
+            CHECK( key_values != vcf::MetaKeyValues{} );
+        }
+    }
 }
@@ -0,0 +1,130 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "vcf/debugulator.hpp"
+#include "vcf/recheck.hpp"
+#include "test_utils.hpp"
+
+namespace ebi
+{
+  TEST_CASE("Manifest of fixed lines", "[recheck]")
+  {
+      vcf::FixManifest manifest{1234, 10, {
+              {vcf::FixedRange::Kind::changed, 6, 120, 2, 6, 2, 4, 80},
+              {vcf::FixedRange::Kind::removed, 9, 190, 0, 10, 1, 7, 150}}};
+
+      std::stringstream text;
+      vcf::write_fix_manifest(text, manifest);
+      vcf::FixManifest read = vcf::read_fix_manifest(text);
+
+      CHECK(read.output_size == 1234);
+      CHECK(read.context_lines == 10);
+      REQUIRE(read.ranges.size() == 2);
+      CHECK(read.ranges[0].kind == vcf::FixedRange::Kind::changed);
+      CHECK(read.ranges[0].output_line == 6);
+      CHECK(read.ranges[0].output_lines == 2);
+      CHECK(read.ranges[0].context_offset == 80);
+      CHECK(read.ranges[1].kind == vcf::FixedRange::Kind::removed);
+      CHECK(read.ranges[1].input_line == 10);
+      CHECK(read.ranges[1].output_offset == 190);
+
+      std::stringstream not_a_manifest{"##fileformat=VCFv4.1\n"};
+      CHECK_THROWS_AS(vcf::read_fix_manifest(not_a_manifest), std::runtime_error);
+
+      std::stringstream malformed{"#vcf_debugulator manifest v1\n#output_size=10\nchanged\t1\t2\n"};
+      CHECK_THROWS_AS(vcf::read_fix_manifest(malformed), std::runtime_error);
+  }
+
+  TEST_CASE("Validate again only the fixed lines", "[recheck]")
+  {
+      std::string header{"##fileformat=VCFv4.1\n"
+                         "##contig=<ID=1>\n"
+                         "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n"};
+      std::stringstream input{header +
+                              "1\t100\t.\tA\tC\t.\t.\t.\n"
+                              "1\t200\t.\tA\t.\t.\t.\t.\t.\n"
+                              "1\t300\tid;id\tA\tC\t.\t.\t.\n"
+                              "1\t400\t.\tA\tC\t.\t.\t.\n"
+                              "1\t400\t.\tA\tC\t.\t.\t.\n"
+                              "1\t500\t.\tA\tC\t.\t.\t.\n"
+                              "1\t600\t.\tA\t.\t.\t.\t.\t.\n"
+                              "1\t700\t.\tA\tC\t.\t.\t.\n"
+                              "1\t800\t.\tA\tC\t.\t.\t.\n"
+                              "1\t900\t.\tA\t.\t.\t.\t.\t.\n"};
+      MemoryReportReader errors{{
+              std::make_shared<vcf::IdBodyError>(6, "Duplicate ID fields", vcf::ErrorFix::DUPLICATE_VALUES),
+              std::make_shared<vcf::DuplicationError>(8, "Duplicated variant")}};
+
+      // the context is smaller than the default to leave some lines out of the windows
+      vcf::FixManifest manifest{0, 1, {}};
+      std::stringstream fixed;
+      vcf::debugulator::fix_vcf_file(input, errors, fixed, &manifest);
+
+      std::string fixed_content = fixed.str();
+      CHECK(manifest.output_size == static_cast<std::streamoff>(fixed_content.size()));
+      REQUIRE(manifest.ranges.size() == 2);
+
+      auto &changed = manifest.ranges[0];
+      CHECK(changed.kind == vcf::FixedRange::Kind::changed);
+      CHECK(changed.output_line == 6);
+      CHECK(changed.output_lines == 1);
+      CHECK(changed.context_line == 5);
+      CHECK(fixed_content.substr(changed.output_offset, 10) == "1\t300\tid\tA");
+      CHECK(fixed_content.substr(changed.context_offset, 6) == "1\t200\t");
+
+      auto &removed = manifest.ranges[1];
+      CHECK(removed.kind == vcf::FixedRange::Kind::removed);
+      CHECK(removed.input_line == 8);
+      CHECK(removed.output_line == 8);
+      CHECK(removed.output_lines == 0);
+      CHECK(fixed_content.substr(removed.output_offset, 6) == "1\t500\t");
+      CHECK(fixed_content.substr(removed.context_offset, 6) == "1\t400\t");
+
+      std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+      outputs.emplace_back(new MemoryReportWriter{});
+      auto & report = static_cast<MemoryReportWriter &>(*outputs[0]);
+
+      SECTION("Only the windows around the fixed ranges are validated, with the line numbers of the whole file")
+      {
+          CHECK_FALSE(vcf::is_valid_vcf_file_recheck(fixed, "fixed.vcf", vcf::ValidationLevel::warning,
+                                                     vcf::Ploidy{2}, outputs, manifest));
+          CHECK((report.errors == std::vector<size_t>{5, 9}));
+          CHECK(report.messages.back() == "Validated 5 lines around 2 fixed ranges of lines");
+      }
+
+      SECTION("A fixed header needs validating the whole body")
+      {
+          manifest.ranges.push_back(vcf::FixedRange{vcf::FixedRange::Kind::changed, 2, 21, 1, 2, 1, 2, 21});
+          CHECK_FALSE(vcf::is_valid_vcf_file_recheck(fixed, "fixed.vcf", vcf::ValidationLevel::warning,
+                                                     vcf::Ploidy{2}, outputs, manifest));
+          CHECK((report.errors == std::vector<size_t>{5, 9, 12}));
+      }
+
+      SECTION("The manifest must belong to the same file")
+      {
+          manifest.output_size += 1;
+          CHECK_THROWS_AS(vcf::is_valid_vcf_file_recheck(fixed, "fixed.vcf", vcf::ValidationLevel::warning,
+                                                         vcf::Ploidy{2}, outputs, manifest),
+                          std::invalid_argument);
+      }
+  }
+}
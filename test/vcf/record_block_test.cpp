@@ -0,0 +1,149 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "vcf/record_block.hpp"
+#include "vcf/validator.hpp"
+#include "test_utils.hpp"
+
+namespace ebi
+{
+  namespace
+  {
+    /** report writer that keeps the line and the message of each error and warning, in order */
+    class MessageReportWriter : public vcf::ReportWriter
+    {
+      public:
+        virtual void write_error(vcf::Error &error) override { errors.push_back(describe(error)); }
+        virtual void write_warning(vcf::Error &error) override { warnings.push_back(describe(error)); }
+        virtual void write_message(std::string const &message) override { }
+
+        std::vector<std::string> errors;
+        std::vector<std::string> warnings;
+
+      private:
+        std::string describe(vcf::Error &error) { return std::to_string(error.line) + ": " + error.message; }
+    };
+
+    std::vector<size_t> lines_of(std::vector<std::string> const & reports)
+    {
+        std::vector<size_t> lines;
+        for (auto & report : reports) {
+            lines.push_back(std::stoul(report));
+        }
+        return lines;
+    }
+  }
+
+  TEST_CASE("Fields of the records stored by blocks", "[record_block]")
+  {
+      std::shared_ptr<vcf::Source> source{
+          new vcf::Source{"block.vcf", vcf::InputFormat::VCF_FILE_VCF, vcf::Version::v41, vcf::Ploidy{2}}};
+      auto build_record = [&](size_t line, std::string const &chromosome, size_t position) {
+          return std::unique_ptr<vcf::Record>{new vcf::Record{line, chromosome, position, { vcf::MISSING_VALUE }, "A",
+                                                              { "C", "G" }, 1.0, { vcf::PASS }, {}, {}, {}, source}};
+      };
+
+      vcf::RecordBlock block{4};
+      block.add(build_record(10, "1", 100));
+      block.add(build_record(11, "1", 200));
+      block.add(build_record(12, "2", 50));
+      CHECK_FALSE(block.full());
+      block.add(build_record(13, "1", 300));
+      CHECK(block.full());
+
+      SECTION("The contigs are interned")
+      {
+          CHECK(block.contig_names == (std::vector<std::string>{"1", "2"}));
+          CHECK(block.contig_ids == (std::vector<size_t>{0, 0, 1, 0}));
+          CHECK(block.positions == (std::vector<size_t>{100, 200, 50, 300}));
+          CHECK(block.lines == (std::vector<size_t>{10, 11, 12, 13}));
+          REQUIRE(block.records.size() == 4);
+          CHECK(block.records[2]->chromosome == "2");
+      }
+
+      SECTION("A cleared block starts interning again")
+      {
+          block.clear();
+          CHECK(block.empty());
+          CHECK(block.records.empty());
+          block.add(build_record(14, "2", 60));
+          CHECK(block.contig_names == std::vector<std::string>{"2"});
+          CHECK(block.contig_ids == std::vector<size_t>{0});
+      }
+  }
+
+  TEST_CASE("Check the records by blocks", "[record_block]")
+  {
+      std::string content{"##fileformat=VCFv4.1\n"
+                          "##reference=ref.fasta\n"
+                          "##contig=<ID=1>\n"
+                          "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n"
+                          "1\t0\ta,b\tA\tC\t.\t.\t.\n"};
+      // several blocks, with a negative quality, an unsorted record that would also be a duplicate with a warning, a
+      // contig not described in the meta section, a contig that is not contiguous and a duplicate of a previous record
+      for (size_t position = 1; position <= 3000; ++position) {
+          std::string quality = position == 500 ? "-1" : ".";
+          std::string id = position == 2500 ? "c,d" : ".";
+          content += "1\t" + std::to_string(position) + "\t" + id + "\tA\tC\t" + quality + "\t.\t.\n";
+          if (position == 1500) {
+              content += "1\t1499\te,f\tA\tC\t.\t.\t.\n";
+          }
+      }
+      content += "2\t1\t.\tA\tC\t.\t.\t.\n"
+                 "2\t2\t.\tA\tC\t.\t.\t.\n"
+                 "1\t3001\t.\tA\tC\t.\t.\t.\n"
+                 "2\t2\t.\tA\tC\t.\t.\t.\n";
+
+      auto validate = [&](bool record_blocks, bool collect_all_errors) {
+          std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+          outputs.emplace_back(new MessageReportWriter{});
+          auto & report = static_cast<MessageReportWriter &>(*outputs[0]);
+          vcf::ValidationOptions options;
+          options.record_blocks = record_blocks;
+          options.collect_all_errors = collect_all_errors;
+          std::stringstream input{content};
+          CHECK_FALSE(vcf::is_valid_vcf_file(input, "blocks.vcf", vcf::ValidationLevel::warning, vcf::Ploidy{2},
+                                             outputs, options));
+          return std::make_pair(report.errors, report.warnings);
+      };
+
+      SECTION("The errors and warnings are the same, in the same order")
+      {
+          auto by_record = validate(false, false);
+          auto by_block = validate(true, false);
+          CHECK(lines_of(by_record.first) == (std::vector<size_t>{505, 1506, 3009, 3008, 3010}));
+          CHECK(lines_of(by_record.second) == (std::vector<size_t>{5, 2506, 3007, 3008, 3010}));
+          CHECK(by_block.first == by_record.first);
+          CHECK(by_block.second == by_record.second);
+      }
+
+      SECTION("The errors and warnings are the same, in the same order, collecting all of them")
+      {
+          auto by_record = validate(false, true);
+          auto by_block = validate(true, true);
+          CHECK(lines_of(by_record.second) == (std::vector<size_t>{5, 5, 2506, 3007, 3008, 3010}));
+          CHECK(by_block.first == by_record.first);
+          CHECK(by_block.second == by_record.second);
+      }
+  }
+}
@@ -14,11 +14,13 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <memory>
 #include <iostream>
 
 #include "catch/catch.hpp"
 
+#include "util/memory_budget.hpp"
 #include "vcf/record_cache.hpp"
 #include "test_utils.hpp"
 
@@ -127,4 +129,30 @@ namespace ebi
             CHECK( count_duplicates_and_rethrow_error(cache, {100, "GA", {"GT"}}) == 1 );
         }
     }
+
+    TEST_CASE("RecordCache tests: memory budget")
+    {
+        util::MemoryBudget & budget = util::memory_budget();
+        size_t used_before = budget.get_used();
+        {
+            vcf::RecordCache cache{0};
+            cache.check_duplicates(build_mock_record({100, "A", {"T"}}));
+            size_t entry_size = budget.get_used() - used_before;
+            REQUIRE(entry_size > 0);
+
+            // only two records fit
+            budget.set_limit(budget.get_used() + entry_size + entry_size / 2);
+            cache.check_duplicates(build_mock_record({101, "A", {"T"}}));
+            cache.check_duplicates(build_mock_record({102, "A", {"T"}}));
+            CHECK(budget.get_used() == used_before + 2 * entry_size);
+
+            CHECK(cache.check_duplicates(build_mock_record({102, "A", {"T"}})).size() == 2);
+            CHECK(cache.check_duplicates(build_mock_record({100, "A", {"T"}})).empty());
+            budget.set_limit(0);
+        }
+        CHECK(budget.get_used() == used_before);
+        auto notes = budget.get_notes();
+        CHECK(std::find(notes.begin(), notes.end(), "The memory limit was reached, so duplicated variants were only "
+                                                     "searched among fewer records than usual") != notes.end());
+    }
 }
@@ -681,6 +681,32 @@ namespace ebi
                                 source}) );
        }
 
+        SECTION("Samples of gVCF reference blocks are checked like the others")
+        {
+            auto sample_error = [&source](std::string const & alternate, std::string const & sample) {
+                try {
+                    vcf::Record{1, "chr1", 123456, { "id123" }, "A", { alternate }, 1.0, { vcf::PASS },
+                                { {vcf::AN, "12"} }, { vcf::GT, vcf::DP, "FormatTag", vcf::AD }, { sample }, source};
+                    return std::string{};
+                } catch (vcf::Error * error) {
+                    std::string message = error->message;
+                    delete error;
+                    return message;
+                }
+            };
+
+            // a SNV has the same amount of alleles, and its samples always go through the general checks
+            for (std::string sample : { "0/0:12:1.5,2:3,4", "0|0:.:.,.", "./.:3", "0/0:12:-1.5e-5,2.", "00/0:1",
+                                        "0/1:12:1,.:.", "0/2:12", "0/:1", "/0:1", "0/0:1.5", "0/0:-3", "0/0:12:1.5",
+                                        "0/0:12:1,x", "0/0:12:1,2:3,-4", "0/0:12:1,2:7,8:9", "0/0::1",
+                                        "0/0:12:1e99999,1", "0/0:99999999999", "a/0:1", "0/0:12:1,2,", "0/0:" }) {
+                INFO(sample);
+                CHECK( sample_error(vcf::GVCF_NON_VARIANT_ALLELE, sample) == sample_error("C", sample) );
+            }
+            CHECK( sample_error(vcf::GVCF_NON_VARIANT_ALLELE, "0/0:12:1.5,2:3,4").empty() );
+            CHECK_FALSE( sample_error(vcf::GVCF_NON_VARIANT_ALLELE, "0/0:12:1.5").empty() );
+       }
+
         SECTION("Duplicate IDs") 
         {
             CHECK_THROWS_AS( (vcf::Record{
@@ -864,4 +890,138 @@ namespace ebi
                         vcf::InfoBodyError*);
         }
     }
+
+    TEST_CASE("Record constructor collecting all errors", "[constructor]")
+    {
+        std::shared_ptr<vcf::Source> source{
+            new vcf::Source{
+                "Example VCF source",
+                vcf::InputFormat::VCF_FILE_VCF,
+                vcf::Version::v41,
+                vcf::Ploidy{2},
+                {},
+                { "Sample1" }}};
+
+        source->meta_entries.emplace(vcf::INFO,
+            vcf::MetaEntry{
+                1,
+                vcf::INFO,
+                {
+                    { vcf::ID, vcf::AN },
+                    { vcf::NUMBER, "1" },
+                    { vcf::TYPE, vcf::INTEGER },
+                    { vcf::DESCRIPTION, "Allele number" }
+                },
+                source
+        });
+
+        auto build_record = [&source](std::vector<std::unique_ptr<vcf::Error>> * errors) {
+            return vcf::Record{
+                    1,
+                    "chr 1:2",
+                    123456,
+                    { "id123" },
+                    "A",
+                    { "A" },
+                    -1.0,
+                    { "0" },
+                    { {vcf::AN, "x"} },
+                    { vcf::GT },
+                    { "0/1" },
+                    source,
+                    errors};
+        };
+
+        SECTION("The first error is thrown by default")
+        {
+            CHECK_THROWS_AS( build_record(nullptr), vcf::ChromosomeBodyError* );
+        }
+
+        SECTION("All the checks run when collecting the errors")
+        {
+            std::vector<std::unique_ptr<vcf::Error>> errors;
+            CHECK_NOTHROW( build_record(&errors) );
+            REQUIRE( errors.size() == 6 );
+            CHECK( dynamic_cast<vcf::ChromosomeBodyError*>(errors[0].get()) != nullptr );
+            CHECK( dynamic_cast<vcf::ChromosomeBodyError*>(errors[1].get()) != nullptr );
+            CHECK( dynamic_cast<vcf::AlternateAllelesBodyError*>(errors[2].get()) != nullptr );
+            CHECK( dynamic_cast<vcf::QualityBodyError*>(errors[3].get()) != nullptr );
+            CHECK( dynamic_cast<vcf::FilterBodyError*>(errors[4].get()) != nullptr );
+            CHECK( dynamic_cast<vcf::InfoBodyError*>(errors[5].get()) != nullptr );
+        }
+    }
+
+    TEST_CASE("Plans of the FORMAT column", "[constructor][format_plan]")
+    {
+        std::shared_ptr<vcf::Source> source{
+            new vcf::Source{
+                "Example VCF source",
+                vcf::InputFormat::VCF_FILE_VCF,
+                vcf::Version::v43,
+                vcf::Ploidy{2},
+                {},
+                { "Sample1" }}};
+
+        source->meta_entries.emplace(vcf::FORMAT,
+            vcf::MetaEntry{
+                1,
+                vcf::FORMAT,
+                { { vcf::ID, vcf::DP }, { vcf::NUMBER, "1" }, { vcf::TYPE, vcf::INTEGER }, { vcf::DESCRIPTION, "Depth" } },
+                source
+        });
+
+        auto build_record = [&](std::vector<std::string> const & format, std::string const & sample) {
+            return vcf::Record{1, "chr1", 123456, { vcf::MISSING_VALUE }, "A", { "C" }, 1.0, { vcf::PASS },
+                               { {vcf::MISSING_VALUE, ""} }, format, { sample }, source};
+        };
+
+        SECTION("The fields are resolved against the meta section")
+        {
+            auto & plan = source->get_format_plan({ vcf::GT, vcf::DP, "XX" });
+            CHECK_FALSE( plan.gt_misplaced );
+            CHECK_FALSE( plan.has_duplicates );
+            REQUIRE( plan.fields.size() == 3 );
+            CHECK_FALSE( plan.fields[0].in_meta );
+            CHECK( plan.fields[1].in_meta );
+            CHECK( plan.fields[1].number == "1" );
+            CHECK( plan.fields[1].type == vcf::INTEGER );
+            CHECK_FALSE( plan.fields[2].in_meta );
+
+            CHECK( &source->get_format_plan({ vcf::GT, vcf::DP, "XX" }) == &plan );
+            CHECK( source->get_format_plan({ vcf::DP, vcf::GT }).gt_misplaced );
+            CHECK( source->get_format_plan({ vcf::GT, vcf::DP, vcf::DP }).has_duplicates );
+        }
+
+        SECTION("Records with the same FORMAT column share its plan")
+        {
+            CHECK_NOTHROW( build_record({ vcf::GT, vcf::DP }, "0/1:12") );
+            CHECK_THROWS_AS( build_record({ vcf::GT, vcf::DP }, "0/1:x"), vcf::SamplesFieldBodyError* );
+            CHECK_THROWS_AS( build_record({ vcf::DP, vcf::GT }, "12:0/1"), vcf::FormatBodyError* );
+            CHECK_THROWS_AS( build_record({ vcf::GT, vcf::DP, vcf::DP }, "0/1:12:12"), vcf::FormatBodyError* );
+        }
+
+        SECTION("The plans are resolved again when the meta entries are notified as changed")
+        {
+            CHECK_NOTHROW( build_record({ vcf::GT, "XX" }, "0/1:x") );
+            CHECK( source->find_info_meta("XX") == nullptr );
+
+            for (auto meta_type : { vcf::FORMAT, vcf::INFO }) {
+                source->meta_entries.emplace(meta_type,
+                    vcf::MetaEntry{
+                        1,
+                        meta_type,
+                        { { vcf::ID, "XX" }, { vcf::NUMBER, "1" }, { vcf::TYPE, vcf::INTEGER }, { vcf::DESCRIPTION, "XX" } },
+                        source
+                });
+            }
+            CHECK_NOTHROW( build_record({ vcf::GT, "XX" }, "0/1:x") );
+            CHECK( source->find_info_meta("XX") == nullptr );
+
+            source->meta_entries_changed();
+            CHECK_THROWS_AS( build_record({ vcf::GT, "XX" }, "0/1:x"), vcf::SamplesFieldBodyError* );
+            REQUIRE( source->find_info_meta("XX") != nullptr );
+            CHECK( source->find_info_meta("XX")->type == vcf::INTEGER );
+        }
+    }
+
 }
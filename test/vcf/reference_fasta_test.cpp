@@ -0,0 +1,206 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "catch/catch.hpp"
+
+#include "util/memory_budget.hpp"
+#include "vcf/normalizer.hpp"
+#include "vcf/record_cache.hpp"
+#include "vcf/reference_fasta.hpp"
+#include "vcf/validator.hpp"
+#include "test_utils.hpp"
+
+namespace ebi
+{
+  void write_file(boost::filesystem::path const &path, std::string const &content)
+  {
+      std::ofstream file{path.string()};
+      file << content;
+  }
+
+  TEST_CASE("Reference sequence from a FASTA file", "[reference_fasta]")
+  {
+      auto directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+      boost::filesystem::create_directories(directory);
+      auto fasta = (directory / "ref.fa").string();
+
+      // contig 1: ACGTACGTAC GGGGGTTTTT CACACACACA AAAAA, contig 2 in lower case
+      write_file(fasta, ">1\n"
+                        "ACGTACGTAC\n"
+                        "GGGGGTTTTT\n"
+                        "CACACACACA\n"
+                        "AAAAA\n"
+                        ">2 description\n"
+                        "acgtn\n");
+      write_file(fasta + ".fai", "1\t35\t3\t10\t11\n"
+                                 "2\t5\t57\t5\t6\n");
+
+      SECTION("Bases are read from any line")
+      {
+          vcf::ReferenceFasta reference{fasta};
+          auto contig = reference.find_contig("1");
+          REQUIRE(contig != nullptr);
+          CHECK(contig->length == 35);
+          CHECK(reference.base(*contig, 1) == 'A');
+          CHECK(reference.base(*contig, 11) == 'G');
+          CHECK(reference.base(*contig, 35) == 'A');
+          CHECK(reference.base(*reference.find_contig("2"), 2) == 'C');
+          CHECK(reference.find_contig("3") == nullptr);
+
+          CHECK(reference.matches(*contig, 9, "ACGG"));
+          CHECK(reference.matches(*contig, 9, "acgg"));
+          CHECK(reference.matches(*contig, 9, "NCGN"));
+          CHECK_FALSE(reference.matches(*contig, 9, "ACGA"));
+          CHECK(reference.matches(*contig, 19, "TTCACACACACAA"));
+          CHECK_FALSE(reference.matches(*contig, 34, "AAA"));
+
+          // an ambiguous base in the reference matches anything
+          CHECK(reference.matches(*reference.find_contig("2"), 4, "TG"));
+      }
+
+      SECTION("An index that doesn't match the file is rejected")
+      {
+          write_file(fasta + ".fai", "1\t35\t3\t10\t11\n"
+                                     "2\t50\t57\t5\t6\n");
+          CHECK_THROWS_AS(vcf::ReferenceFasta{fasta}, std::runtime_error);
+
+          write_file(fasta + ".fai", "1\t35\t3\tten\t11\n");
+          CHECK_THROWS_AS(vcf::ReferenceFasta{fasta}, std::runtime_error);
+
+          boost::filesystem::remove(fasta + ".fai");
+          CHECK_THROWS_AS(vcf::ReferenceFasta{fasta}, std::runtime_error);
+      }
+
+      SECTION("Reference alleles are checked against the sequence")
+      {
+          std::shared_ptr<vcf::Source> source{new vcf::Source{"ref.vcf", vcf::VCF_FILE_VCF, vcf::Version::v41,
+                                                              vcf::Ploidy{2}}};
+          source->reference = std::make_shared<vcf::ReferenceFasta>(fasta);
+          auto build_record = [&](std::string const &chromosome, size_t position, std::string const &reference_allele,
+                                  std::string const &alternate) {
+              return vcf::Record{1, chromosome, position, {vcf::MISSING_VALUE}, reference_allele, {alternate}, 0,
+                                 {vcf::PASS}, {{vcf::MISSING_VALUE, ""}}, {}, {}, source};
+          };
+
+          CHECK_NOTHROW(build_record("1", 10, "CG", "C"));
+          CHECK_NOTHROW(build_record("2", 4, "T", "C"));
+          CHECK_NOTHROW(build_record("3", 4, "T", "C"));
+          CHECK_THROWS_AS(build_record("1", 10, "A", "C"), vcf::ReferenceAlleleBodyError *);
+          CHECK_THROWS_AS(build_record("1", 35, "AA", "A"), vcf::ReferenceAlleleBodyError *);
+      }
+
+      SECTION("Indels are left-aligned with the sequence")
+      {
+          vcf::ReferenceFasta reference{fasta};
+
+          // deletion of one base of GGGGG, and insertion of CA in CACACACACA
+          auto deletion = build_mock_record({14, "GG", {"G"}});
+          CHECK((vcf::normalize(deletion) == std::vector<vcf::RecordCore>{{1, "1", 14, "G", ""}}));
+          CHECK((vcf::normalize_left_alignment(deletion, reference)
+                 == std::vector<vcf::RecordCore>{{1, "1", 11, "G", ""}}));
+          CHECK((vcf::normalize_left_alignment(build_mock_record({10, "CG", {"C"}}), reference)
+                 == std::vector<vcf::RecordCore>{{1, "1", 11, "G", ""}}));
+
+          CHECK((vcf::normalize_left_alignment(build_mock_record({26, "A", {"ACA", "T"}}), reference)
+                 == std::vector<vcf::RecordCore>{{1, "1", 21, "", "CA"}, {1, "1", 26, "A", "T"}}));
+
+          // nothing to align with in the first position
+          CHECK((vcf::normalize_left_alignment(build_mock_record({1, "AC", {"C"}}), reference)
+                 == std::vector<vcf::RecordCore>{{1, "1", 1, "A", ""}}));
+      }
+
+      SECTION("Duplicates are found after aligning")
+      {
+          std::shared_ptr<vcf::Source> source{new vcf::Source{"ref.vcf", vcf::VCF_FILE_VCF, vcf::Version::v41,
+                                                              vcf::Ploidy{2}}};
+          auto build_record = [&](size_t line, size_t position, std::string const &reference_allele) {
+              return vcf::Record{line, "1", position, {vcf::MISSING_VALUE}, reference_allele, {"G"}, 0, {vcf::PASS},
+                                 {{vcf::MISSING_VALUE, ""}}, {}, {}, source};
+          };
+
+          vcf::RecordCache without_reference;
+          CHECK(without_reference.check_duplicates(build_record(1, 12, "GG")).empty());
+          CHECK(without_reference.check_duplicates(build_record(2, 14, "GG")).empty());
+
+          source->reference = std::make_shared<vcf::ReferenceFasta>(fasta);
+          vcf::RecordCache with_reference;
+          CHECK(with_reference.check_duplicates(build_record(1, 12, "GG")).empty());
+          CHECK(with_reference.check_duplicates(build_record(2, 14, "GG")).size() == 2);
+      }
+
+      SECTION("The validation reports the mismatches and the contigs missing in the reference")
+      {
+          std::stringstream input{"##fileformat=VCFv4.1\n"
+                                  "##reference=ref.fa\n"
+                                  "##contig=<ID=1>\n"
+                                  "##contig=<ID=3>\n"
+                                  "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n"
+                                  "1\t1\t.\tT\tC\t.\tPASS\t.\n"
+                                  "1\t2\t.\tC\tG\t.\tPASS\t.\n"
+                                  "3\t4\t.\tA\tC\t.\tPASS\t.\n"
+                                  "3\t5\t.\tA\tC\t.\tPASS\t.\n"};
+          std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+          outputs.emplace_back(new MemoryReportWriter{});
+          auto & report = static_cast<MemoryReportWriter &>(*outputs[0]);
+
+          vcf::ValidationOptions options;
+          options.reference = std::make_shared<vcf::ReferenceFasta>(fasta);
+          CHECK_FALSE(vcf::is_valid_vcf_file(input, "ref.vcf", vcf::ValidationLevel::warning, vcf::Ploidy{2}, outputs,
+                                             options));
+          CHECK(report.errors == std::vector<size_t>{6});
+          // the missing contig is only reported once
+          CHECK(report.warnings == std::vector<size_t>{8});
+      }
+
+      SECTION("A contig missing in the reference is reported once even when the memory limit is reached")
+      {
+          vcf::ValidationOptions options;
+          options.reference = std::make_shared<vcf::ReferenceFasta>(fasta);
+          std::unique_ptr<vcf::Parser> validator = vcf::build_parser("ref.vcf", vcf::ValidationLevel::warning,
+                                                                     vcf::Version::v41, vcf::Ploidy{2}, options);
+          validator->parse(std::string{"##fileformat=VCFv4.1\n"
+                                       "##reference=ref.fa\n"
+                                       "##contig=<ID=3>\n"
+                                       "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n"});
+
+          util::MemoryBudget & budget = util::memory_budget();
+          budget.set_limit(budget.get_used());
+
+          std::vector<size_t> warnings;
+          for (size_t position = 4; position <= 6; ++position) {
+              validator->parse("3\t" + std::to_string(position) + "\t.\tA\tC\t.\tPASS\t.\n");
+              for (auto & warning : validator->warnings()) {
+                  warnings.push_back(warning->line);
+              }
+          }
+          validator->end();
+          budget.set_limit(0);
+
+          CHECK(validator->errors().empty());
+          CHECK(warnings == std::vector<size_t>{5});
+      }
+
+      boost::filesystem::remove_all(directory);
+  }
+}
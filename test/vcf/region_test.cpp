@@ -0,0 +1,134 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "vcf/region.hpp"
+#include "test_utils.hpp"
+
+namespace ebi
+{
+  std::vector<char> to_line(std::string const & line)
+  {
+      return std::vector<char>{line.begin(), line.end()};
+  }
+
+  TEST_CASE("Parse regions", "[region]")
+  {
+      auto whole = vcf::parse_region("20");
+      CHECK(whole.chromosome == "20");
+      CHECK(whole.contains("20", 1));
+      CHECK(whole.contains("20", 300000000));
+
+      auto open = vcf::parse_region("chr20:1000");
+      CHECK(open.chromosome == "chr20");
+      CHECK_FALSE(open.contains("chr20", 999));
+      CHECK(open.contains("chr20", 1000000));
+
+      auto closed = vcf::parse_region("X:1000-2000");
+      CHECK(closed.contains("X", 1000));
+      CHECK(closed.contains("X", 2000));
+      CHECK_FALSE(closed.contains("X", 2001));
+      CHECK_FALSE(closed.contains("Y", 1500));
+
+      CHECK_THROWS_AS(vcf::parse_region("X:a-2000"), std::invalid_argument);
+      CHECK_THROWS_AS(vcf::parse_region("X:2000-1000"), std::invalid_argument);
+      CHECK_THROWS_AS(vcf::parse_region(":1-2"), std::invalid_argument);
+  }
+
+  TEST_CASE("Parse regions of contigs whose names contain ':'", "[region]")
+  {
+      auto whole = vcf::parse_region("{HLA-A*01:01}");
+      CHECK(whole.chromosome == "HLA-A*01:01");
+      CHECK(whole.contains("HLA-A*01:01", 1));
+      CHECK(whole.contains("HLA-A*01:01", 300000000));
+
+      auto closed = vcf::parse_region("{HLA-A*01:01}:1-100");
+      CHECK(closed.chromosome == "HLA-A*01:01");
+      CHECK(closed.contains("HLA-A*01:01", 100));
+      CHECK_FALSE(closed.contains("HLA-A*01:01", 101));
+      CHECK_FALSE(closed.contains("HLA-A*01", 50));
+
+      // a range of the contig "a:b" or the whole contig "a:b:1"
+      CHECK_THROWS_AS(vcf::parse_region("a:b:1"), std::invalid_argument);
+      CHECK_THROWS_AS(vcf::parse_region("HLA-A*01:01:1-100"), std::invalid_argument);
+
+      CHECK_THROWS_AS(vcf::parse_region("{HLA-A*01:01"), std::invalid_argument);
+      CHECK_THROWS_AS(vcf::parse_region("{HLA-A*01:01}1-100"), std::invalid_argument);
+      CHECK_THROWS_AS(vcf::parse_region("{}:1-100"), std::invalid_argument);
+  }
+
+  TEST_CASE("Select lines in regions", "[region]")
+  {
+      std::vector<vcf::Region> regions{vcf::parse_region("1:100-200"), vcf::parse_region("2")};
+
+      CHECK(vcf::is_in_regions(to_line("1\t150\t.\tA\tC\t.\t.\t.\n"), regions));
+      CHECK_FALSE(vcf::is_in_regions(to_line("1\t250\t.\tA\tC\t.\t.\t.\n"), regions));
+      CHECK(vcf::is_in_regions(to_line("2\t250\t.\tA\tC\t.\t.\t.\n"), regions));
+      CHECK_FALSE(vcf::is_in_regions(to_line("10\t150\t.\tA\tC\t.\t.\t.\n"), regions));
+
+      // the position can't be read, so the line is left to the validator
+      CHECK(vcf::is_in_regions(to_line("1\tabc\t.\tA\tC\t.\t.\t.\n"), regions));
+      CHECK(vcf::is_in_regions(to_line("1\n"), regions));
+  }
+
+  TEST_CASE("Validate the records in some regions", "[region]")
+  {
+      std::string vcf_content{"##fileformat=VCFv4.1\n"
+                              "##contig=<ID=1>\n"
+                              "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n"
+                              "1\t100\t.\tA\tC\t.\t.\t.\n"
+                              "1\t200\t.\tA\t.\t.\t.\t.\t.\n"
+                              "2\t100\t.\tA\tC\t.\t.\t.\n"
+                              "2\t200\t.\tA\t.\t.\t.\t.\t.\n"};
+
+      std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+      outputs.emplace_back(new MemoryReportWriter{});
+      auto & report = static_cast<MemoryReportWriter &>(*outputs[0]);
+
+      SECTION("Errors outside the regions are not reported")
+      {
+          std::stringstream input{vcf_content};
+          CHECK(vcf::is_valid_vcf_file_regions(input, "regions.vcf", vcf::ValidationLevel::error, vcf::Ploidy{2},
+                                               outputs, {vcf::parse_region("1:1-150"), vcf::parse_region("2:1-150")}));
+          CHECK(report.errors.empty());
+          CHECK(report.messages.back() == "Validated 2 records in the requested regions, 2 records outside them were skipped");
+      }
+
+      SECTION("Errors inside the regions keep their line numbers")
+      {
+          std::stringstream input{vcf_content};
+          CHECK_FALSE(vcf::is_valid_vcf_file_regions(input, "regions.vcf", vcf::ValidationLevel::error, vcf::Ploidy{2},
+                                                     outputs, {vcf::parse_region("2")}));
+          CHECK(report.errors == std::vector<size_t>{7});
+      }
+
+      SECTION("Contigs whose names contain ':' can be selected")
+      {
+          std::stringstream input{"##fileformat=VCFv4.1\n"
+                                  "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n"
+                                  "HLA-A*01\t1\t.\tA\t.\t.\t.\t.\t.\n"
+                                  "HLA-A*01:01\t100\t.\tA\tC\t.\t.\t.\n"};
+          CHECK_FALSE(vcf::is_valid_vcf_file_regions(input, "regions.vcf", vcf::ValidationLevel::error, vcf::Ploidy{2},
+                                                     outputs, {vcf::parse_region("{HLA-A*01:01}")}));
+          CHECK(report.errors == std::vector<size_t>{4});
+      }
+  }
+}
@@ -190,6 +190,58 @@ namespace ebi
 
   }
 
+  TEST_CASE("Unit test: buffered text reports", "[output]")
+  {
+      auto path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+      std::vector<std::unique_ptr<ebi::vcf::Error>> errors;
+      errors.emplace_back(new ebi::vcf::BodySectionError{5, "first error"});
+      errors.emplace_back(new ebi::vcf::BodySectionError{5, "second error"});
+      std::vector<std::unique_ptr<ebi::vcf::Error>> warnings;
+      warnings.emplace_back(new ebi::vcf::NoMetaDefinitionError{6, "no definition", "INFO", "DP"});
+      warnings.emplace_back(new ebi::vcf::NoMetaDefinitionError{7, "no definition", "INFO", "DP"});
+
+      {
+          ebi::vcf::SummaryReportWriter report{path.string()};
+          report.write_batch(errors, ebi::vcf::Severity::ERROR);
+          report.write_batch(warnings, ebi::vcf::Severity::WARNING);
+
+          CHECK(boost::filesystem::file_size(path) == 0);
+          report.flush();
+          CHECK(boost::filesystem::file_size(path) > 0);
+      }
+
+      std::ifstream file{path.string()};
+      std::vector<std::string> lines;
+      for (std::string line; std::getline(file, line); ) {
+          lines.push_back(line);
+      }
+      boost::filesystem::remove(path);
+
+      REQUIRE(lines.size() == 3);
+      CHECK(lines[0] == "Line 5: first error");
+      CHECK(lines[1] == "Line 5: second error");
+      CHECK(lines[2] == "Line 6: no definition (warning)");
+  }
+
+  TEST_CASE("Unit test: periodic flush of the reports", "[output]")
+  {
+      auto path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+      std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> outputs;
+      outputs.emplace_back(new ebi::vcf::FileReportWriter{path.string()});
+      ebi::vcf::BodySectionError error{5, "first error"};
+      outputs[0]->write_error(error);
+
+      // the clock is checked every 2 lines, and the interval has always passed
+      ebi::vcf::ReportFlusher flusher{std::chrono::milliseconds{0}, 2};
+      flusher.line_validated(outputs);
+      CHECK(boost::filesystem::file_size(path) == 0);
+      flusher.line_validated(outputs);
+      CHECK(boost::filesystem::file_size(path) > 0);
+
+      outputs.clear();
+      boost::filesystem::remove(path);
+  }
+
   TEST_CASE("Unit test: summary report", "[output]")
   {
       SECTION("SummaryTracker should skip repeated NoMetaDefinitionError")
@@ -0,0 +1,89 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "vcf/validator.hpp"
+#include "test_utils.hpp"
+
+namespace ebi
+{
+  bool is_valid_selection(std::string const & content,
+                          vcf::SampleSelection const & selection,
+                          std::vector<std::unique_ptr<vcf::ReportWriter>> &outputs)
+  {
+      std::stringstream input{content};
+      vcf::ValidationOptions options;
+      options.sample_selection = selection;
+      return vcf::is_valid_vcf_file(input, "selection.vcf", vcf::ValidationLevel::warning, vcf::Ploidy{2}, outputs,
+                                    options);
+  }
+
+  TEST_CASE("Validate a selection of samples", "[sample_selection]")
+  {
+      std::string header{"##fileformat=VCFv4.1\n"
+                         "##reference=ref.fasta\n"
+                         "##contig=<ID=1>\n"
+                         "##FORMAT=<ID=GT,Number=1,Type=String,Description=\"Genotype\">\n"
+                         "##FORMAT=<ID=DP,Number=1,Type=Integer,Description=\"Depth\">\n"
+                         "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\tFORMAT\tS1\tS2\tS3\n"};
+
+      // the allele index of S2 is out of range and its depth is not an integer
+      std::string wrong_s2{header + "1\t100\t.\tA\tC\t.\t.\t.\tGT:DP\t0/1:5\t0/2:x\t1/1:7\n"};
+
+      std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+      outputs.emplace_back(new MemoryReportWriter{});
+      auto & report = static_cast<MemoryReportWriter &>(*outputs[0]);
+
+      SECTION("All samples")
+      {
+          CHECK_FALSE(is_valid_selection(wrong_s2, vcf::SampleSelection{}, outputs));
+          CHECK(report.errors == std::vector<size_t>{7});
+      }
+
+      SECTION("Samples without errors")
+      {
+          CHECK(is_valid_selection(wrong_s2, vcf::SampleSelection{{"S1", "S3"}}, outputs));
+          CHECK(report.errors.empty());
+      }
+
+      SECTION("Sample with errors")
+      {
+          CHECK_FALSE(is_valid_selection(wrong_s2, vcf::SampleSelection{{"S2"}}, outputs));
+      }
+
+      SECTION("Sites only")
+      {
+          CHECK(is_valid_selection(wrong_s2, vcf::SampleSelection{std::set<std::string>{}}, outputs));
+      }
+
+      SECTION("The amount of samples is still checked")
+      {
+          CHECK_FALSE(is_valid_selection(header + "1\t100\t.\tA\tC\t.\t.\t.\tGT:DP\t0/1:5\t0/1:5\n",
+                                         vcf::SampleSelection{std::set<std::string>{}}, outputs));
+      }
+
+      SECTION("The syntax of the samples not selected is still checked")
+      {
+          CHECK_FALSE(is_valid_selection(header + "1\t100\t.\tA\tC\t.\t.\t.\tGT:DP\t0/1:5\t0/1:5\t0/1\t\n",
+                                         vcf::SampleSelection{{"S1"}}, outputs));
+      }
+  }
+}
@@ -0,0 +1,120 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "vcf/sampling.hpp"
+#include "test_utils.hpp"
+
+namespace ebi
+{
+  /**
+   * Builds a VCF with `records` records, where every `error_period`-th one has an invalid chromosome
+   */
+  std::string build_vcf(size_t records, size_t error_period)
+  {
+      std::stringstream vcf;
+      vcf << "##fileformat=VCFv4.1\n"
+          << "##contig=<ID=1>\n"
+          << "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n";
+      for (size_t i = 1; i <= records; ++i) {
+          vcf << (error_period != 0 && i % error_period == 0 ? "1:1" : "1") << "\t" << i * 10 << "\t.\tA\tC\t.\t.\t.\n";
+      }
+      return vcf.str();
+  }
+
+  bool is_valid_sample(std::string const & content,
+                       vcf::SamplingOptions options,
+                       std::vector<std::unique_ptr<vcf::ReportWriter>> &outputs)
+  {
+      std::stringstream input{content};
+      return vcf::is_valid_vcf_file_sample(input, "sample.vcf", vcf::ValidationLevel::warning, vcf::Ploidy{2},
+                                           outputs, options);
+  }
+
+  TEST_CASE("Validate a sample of a file", "[sampling]")
+  {
+      std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+      outputs.emplace_back(new MemoryReportWriter{});
+      auto & report = static_cast<MemoryReportWriter &>(*outputs[0]);
+
+      SECTION("Valid file")
+      {
+          CHECK(is_valid_sample(build_vcf(1000, 0), vcf::SamplingOptions{10, 5}, outputs));
+          CHECK(report.errors.empty());
+          CHECK(report.messages.front() == "Sample window 1 starts at byte 76; its records are reported as lines 4 to 8");
+          CHECK(report.messages.back().find("Validated 50 sampled records out of about ") == 0);
+      }
+
+      SECTION("Invalid file")
+      {
+          CHECK_FALSE(is_valid_sample(build_vcf(1000, 2), vcf::SamplingOptions{10, 20}, outputs));
+          CHECK(report.errors.size() == 100);
+          CHECK(report.messages.back().find("Estimated rate of records with ChromosomeBodyError: 50%") == 0);
+      }
+
+      SECTION("Windows that would overlap read every record once")
+      {
+          CHECK_FALSE(is_valid_sample(build_vcf(30, 3), vcf::SamplingOptions{10, 100}, outputs));
+          CHECK(report.errors.size() == 10);
+          CHECK(report.messages[report.messages.size() - 2] == "Validated 30 sampled records out of about 30 in the file");
+      }
+
+      SECTION("Sortedness is only checked inside each window")
+      {
+          // the windows start in the middle of each run of records, so only the unsorted contig 1 after contig 2
+          // is out of them
+          std::stringstream vcf;
+          vcf << "##fileformat=VCFv4.1\n"
+              << "##contig=<ID=1>\n"
+              << "##contig=<ID=2>\n"
+              << "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n";
+          std::vector<std::pair<std::string, size_t>> runs = {{"1", 50}, {"2", 100}, {"1", 150}};
+          for (auto &run : runs) {
+              for (size_t i = 1; i <= run.second; ++i) {
+                  vcf << run.first << "\t" << i * 10 << "\t.\tA\tC\t.\t.\t.\n";
+              }
+          }
+          CHECK(is_valid_sample(vcf.str(), vcf::SamplingOptions{3, 10}, outputs));
+          CHECK(report.errors.empty());
+          CHECK(report.messages.back().find("Validated 30 sampled records out of about ") == 0);
+      }
+
+      SECTION("Empty body")
+      {
+          CHECK(is_valid_sample(build_vcf(0, 0), vcf::SamplingOptions{10, 100}, outputs));
+          CHECK(report.messages.back() == "Validated 0 sampled records out of about 0 in the file");
+      }
+  }
+
+  TEST_CASE("Error rate estimates", "[sampling]")
+  {
+      auto none = vcf::estimate_error_rate("Error", 0, 100);
+      CHECK(none.rate == 0);
+      CHECK(none.lower_bound == 0);
+      CHECK(none.upper_bound == Approx(0.037).epsilon(0.01));
+
+      auto half = vcf::estimate_error_rate("Error", 50, 100);
+      CHECK(half.rate == Approx(0.5));
+      CHECK(half.lower_bound == Approx(1 - half.upper_bound));
+      CHECK(half.lower_bound < 0.5);
+  }
+}
@@ -0,0 +1,103 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "catch/catch.hpp"
+
+#include "vcf/structured_report_writer.hpp"
+
+namespace ebi
+{
+  std::string read_report(boost::filesystem::path const & path)
+  {
+      std::ifstream file{path.string(), std::ios::binary};
+      std::stringstream content;
+      content << file.rdbuf();
+      return content.str();
+  }
+
+  TEST_CASE("Structured reports", "[structured_report]")
+  {
+      auto path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+      vcf::InfoBodyError info_error{12, "INFO \"DP\" is not valid", vcf::ErrorFix::IRRECOVERABLE_VALUE, "DP"};
+      vcf::NoMetaDefinitionError warning{3, "no definition", "FILTER", "q10"};
+
+      SECTION("Fields of each class of error")
+      {
+          vcf::ErrorFields fields = vcf::get_error_fields(info_error);
+          CHECK(fields.code == 13);
+          CHECK(fields.field == "DP");
+          CHECK(fields.column == "");
+
+          vcf::MetaSectionError meta_error{2, "wrong Type", vcf::ErrorFix::RECOVERABLE_VALUE, "Type", "Integer"};
+          fields = vcf::get_error_fields(meta_error);
+          CHECK(fields.code == 1);
+          CHECK(fields.value == "Type");
+          CHECK(fields.expected_value == "Integer");
+      }
+
+      SECTION("JSON lines")
+      {
+          {
+              vcf::JsonReportWriter report{path.string()};
+              report.write_error(info_error);
+              report.write_warning(warning);
+              report.write_message("done\twith\\tabs");
+          }
+          CHECK(read_report(path) ==
+                "{\"severity\":\"error\",\"code\":\"InfoBodyError\",\"line\":12,"
+                "\"message\":\"INFO \\\"DP\\\" is not valid\",\"field\":\"DP\"}\n"
+                "{\"severity\":\"warning\",\"code\":\"NoMetaDefinitionError\",\"line\":3,"
+                "\"message\":\"no definition\",\"column\":\"FILTER\",\"field\":\"q10\"}\n"
+                "{\"severity\":\"message\",\"message\":\"done\\twith\\\\tabs\"}\n");
+      }
+
+      SECTION("Binary records")
+      {
+          {
+              vcf::BinaryReportWriter report{path.string()};
+              report.write_warning(warning);
+              report.write_message("done");
+          }
+          std::string content = read_report(path);
+          REQUIRE(content.size() > 8);
+          CHECK(content.substr(0, 8) == "VCFRB001");
+
+          std::string first_record{"\x01\x04\x03\0\0\0\0\0\0\0"
+                                   "\x0d\0\0\0no definition"
+                                   "\x06\0\0\0FILTER"
+                                   "\x03\0\0\0q10"
+                                   "\0\0\0\0"
+                                   "\0\0\0\0", 52};
+          CHECK((content.substr(8, 4) == std::string{"\x34\0\0\0", 4}));
+          CHECK(content.substr(12, first_record.size()) == first_record);
+
+          std::string second_record{"\x02\0\0\0\0\0\0\0\0\0"
+                                    "\x04\0\0\0done"
+                                    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0", 34};
+          CHECK((content.substr(64, 4) == std::string{"\x22\0\0\0", 4}));
+          CHECK(content.substr(68) == second_record);
+      }
+
+      boost::filesystem::remove(path);
+  }
+}
@@ -23,6 +23,8 @@
 #include <algorithm>
 
 #include "vcf/file_structure.hpp"
+#include "vcf/report_reader.hpp"
+#include "vcf/report_writer.hpp"
 
 namespace ebi
 {
@@ -68,6 +70,37 @@ namespace ebi
                          0, {vcf::MISSING_VALUE}, {{vcf::MISSING_VALUE, ""}}, {vcf::GT}, {"0/0", "0/1", "0/1", "1/1"}, source};
   }
 
+  /** keeps the line of every error and warning and the messages, to check what a validation reported */
+  class MemoryReportWriter : public vcf::ReportWriter
+  {
+    public:
+      virtual void write_error(vcf::Error &error) override { errors.push_back(error.line); }
+      virtual void write_warning(vcf::Error &error) override { warnings.push_back(error.line); }
+      virtual void write_message(std::string const &message) override { messages.push_back(message); }
+
+      std::vector<size_t> errors;
+      std::vector<size_t> warnings;
+      std::vector<std::string> messages;
+  };
+
+  /** report reader over some errors built in the test */
+  class MemoryReportReader : public vcf::ReportReader
+  {
+    public:
+      MemoryReportReader(std::vector<std::shared_ptr<vcf::Error>> errors) : errors{errors} { }
+
+      virtual size_t count_errors() override { return errors.size(); }
+      virtual void for_each_error(std::function<void(std::shared_ptr<vcf::Error>)> user_function) override
+      {
+          std::for_each(errors.begin(), errors.end(), user_function);
+      }
+      virtual size_t count_warnings() override { return 0; }
+      virtual void for_each_warning(std::function<void(std::shared_ptr<vcf::Error>)> user_function) override { }
+
+    private:
+      std::vector<std::shared_ptr<vcf::Error>> errors;
+  };
+
   /** simple count for small tests, no need to optimize further */
   inline long count_lines(std::istream &input_stream)
   {